@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Core.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <string>
+#include <utility>
+
+// Error of a kernel against an extended precision (long double) reference, in units in the last place of the result type.
+// The error is |actual - reference| / Ulp(reference), so a correctly rounded result is at most 0.5 ULP.
+// NaN and infinity have no error in ULP, a result that disagrees with the reference on them is counted as a mismatch instead.
+namespace Pulsarion::Math::Accuracy
+{
+    // The backend the kernels were compiled for
+#if defined(PULSARION_MATH_SIMD_SSE4_1) && defined(PULSARION_MATH_DETERMINISTIC)
+    inline constexpr const char* Backend = "SSE4.1 (deterministic)";
+#elif defined(PULSARION_MATH_SIMD_SSE4_1)
+    inline constexpr const char* Backend = "SSE4.1";
+#else
+    inline constexpr const char* Backend = "Scalar";
+#endif
+
+    // Spacing of T around the value, the same for every denormal
+    template<FloatingPoint_t T>
+    inline long double Ulp(long double value) noexcept
+    {
+        int exponent = std::numeric_limits<T>::min_exponent;
+        if (value != 0.0L && std::isfinite(value))
+            std::frexp(value, &exponent);
+        return std::ldexp(1.0L, std::max(exponent, std::numeric_limits<T>::min_exponent) - std::numeric_limits<T>::digits);
+    }
+
+    struct UlpStats
+    {
+        std::string kernel;
+        std::uint64_t samples = 0;
+        std::uint64_t mismatches = 0; // NaN or infinity on only one side
+        long double maxUlp = 0.0L;
+        long double totalUlp = 0.0L;
+        // The sample with the largest error
+        long double worstReference = 0.0L;
+        long double worstActual = 0.0L;
+
+        explicit UlpStats(std::string kernel) : kernel(std::move(kernel)) {}
+
+        [[nodiscard]] inline long double MeanUlp() const noexcept { return samples == 0 ? 0.0L : totalUlp / static_cast<long double>(samples); }
+
+        template<FloatingPoint_t T>
+        inline void Add(long double reference, T actual) noexcept
+        {
+            Add(reference, actual, reference);
+        }
+
+        // Measured in ULP of the magnitude instead of the reference, for sums that can cancel (e.g. the sum of |left * right| of a dot product)
+        template<FloatingPoint_t T>
+        inline void Add(long double reference, T actual, long double magnitude) noexcept
+        {
+            ++samples;
+            if (std::isnan(reference) || std::isnan(actual))
+            {
+                mismatches += std::isnan(reference) != std::isnan(actual);
+                return;
+            }
+
+            // Overflowing the reference to infinity is the same as the kernel doing so
+            const T rounded = static_cast<T>(reference);
+            if (std::isinf(rounded) || std::isinf(actual))
+            {
+                mismatches += rounded != actual;
+                return;
+            }
+
+            const long double error = std::abs(static_cast<long double>(actual) - reference) / Ulp<T>(magnitude);
+            totalUlp += error;
+            if (error > maxUlp)
+            {
+                maxUlp = error;
+                worstReference = reference;
+                worstActual = actual;
+            }
+        }
+    };
+
+    inline void Dump(std::ostream& stream, std::span<const UlpStats> stats)
+    {
+        stream << "Backend: " << Backend << '\n';
+        stream << std::left << std::setw(40) << "Kernel" << std::right << std::setw(12) << "Samples" << std::setw(12) << "Max ULP"
+               << std::setw(12) << "Mean ULP" << std::setw(12) << "Mismatches" << "  Worst (expected / actual)" << '\n';
+        for (const UlpStats& kernel : stats)
+        {
+            stream << std::left << std::setw(40) << kernel.kernel << std::right << std::setw(12) << kernel.samples << std::fixed << std::setprecision(3)
+                   << std::setw(12) << static_cast<double>(kernel.maxUlp) << std::setw(12) << static_cast<double>(kernel.MeanUlp()) << std::setw(12) << kernel.mismatches
+                   << std::defaultfloat << std::setprecision(9) << "  " << static_cast<double>(kernel.worstReference) << " / " << static_cast<double>(kernel.worstActual) << '\n';
+        }
+    }
+}
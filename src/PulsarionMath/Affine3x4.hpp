@@ -0,0 +1,96 @@
+#pragma once
+
+#ifndef PULSARION_MATH_MATRIX_HPP
+#include "Matrix.hpp"
+#endif
+
+namespace Pulsarion::Math
+{
+    // Affine matrix, the fourth row is implicitly (0, 0, 0, 1). A type of its own, Matrix<3, 4, T> is the general 3x4 matrix.
+    // It is always stored as three rows (regardless of the major order), so each row is a single SIMD register
+    // and the whole matrix is 3/4 of the size of a Matrix<4, 4, T>.
+    template<Arithmetic_t T>
+    class Affine3x4
+    {
+    public:
+        PULSARION_MATH_ALIGN Vector<4, T, Qualifier::Aligned> data[3];
+
+        // ---- Constructors ----
+        inline constexpr Affine3x4(const T& m00, const T& m01, const T& m02, const T& m03,
+                                   const T& m10, const T& m11, const T& m12, const T& m13,
+                                   const T& m20, const T& m21, const T& m22, const T& m23) noexcept
+            : data{ Vector<4, T, Qualifier::Aligned>(m00, m01, m02, m03),
+                    Vector<4, T, Qualifier::Aligned>(m10, m11, m12, m13),
+                    Vector<4, T, Qualifier::Aligned>(m20, m21, m22, m23) } {}
+
+        explicit inline constexpr Affine3x4(const T& value) noexcept : Affine3x4(value, 0, 0, 0,
+                                                                                 0, value, 0, 0,
+                                                                                 0, 0, value, 0) {}
+
+        // Identity matrix by default
+        inline constexpr Affine3x4() noexcept : Affine3x4(1) {}
+
+        // Drops the last row, which should be (0, 0, 0, 1)
+        explicit inline constexpr Affine3x4(const Matrix<4, 4, T>& matrix) noexcept
+            : Affine3x4(matrix.Get(0, 0), matrix.Get(0, 1), matrix.Get(0, 2), matrix.Get(0, 3),
+                        matrix.Get(1, 0), matrix.Get(1, 1), matrix.Get(1, 2), matrix.Get(1, 3),
+                        matrix.Get(2, 0), matrix.Get(2, 1), matrix.Get(2, 2), matrix.Get(2, 3)) {}
+
+        // ---- Accessors ----
+        inline constexpr T& Get(std::size_t row, std::size_t column) noexcept { return data[row][column]; }
+        [[nodiscard]] inline constexpr const T& Get(std::size_t row, std::size_t column) const noexcept { return data[row][column]; }
+
+        [[nodiscard]] inline constexpr bool IsSquare() const noexcept { return false; }
+        [[nodiscard]] inline constexpr bool IsColumnMajor() const noexcept { return false; }
+        [[nodiscard]] inline constexpr bool IsRowMajor() const noexcept { return true; }
+
+        inline constexpr Vector<4, T, Qualifier::Aligned>& operator[](std::size_t index) noexcept { return data[index]; }
+        inline constexpr const Vector<4, T, Qualifier::Aligned>& operator[](std::size_t index) const noexcept { return data[index]; }
+
+        [[nodiscard]] inline constexpr const Vector<4, T, Qualifier::Aligned>& Row(std::size_t index) const noexcept { return data[index]; }
+
+        [[nodiscard]] inline constexpr Matrix<4, 4, T> ToMatrix4x4() const noexcept
+        {
+            return Matrix<4, 4, T>(Get(0, 0), Get(0, 1), Get(0, 2), Get(0, 3),
+                                   Get(1, 0), Get(1, 1), Get(1, 2), Get(1, 3),
+                                   Get(2, 0), Get(2, 1), Get(2, 2), Get(2, 3),
+                                   0, 0, 0, 1);
+        }
+
+        // Equivalent to multiplying the promoted 4x4 matrices
+        inline Affine3x4<T> operator*(const Affine3x4<T>& other) const noexcept
+        {
+            return Affine3x4Functions<T>::Multiply(*this, other);
+        }
+
+        // The w component is passed through, like the 4x4 multiply with an implicit (0, 0, 0, 1) row
+        inline Vector<4, T, Qualifier::Aligned> operator*(const Vector<4, T, Qualifier::Aligned>& other) const noexcept
+        {
+            return Affine3x4Functions<T>::VecMultiply(*this, other);
+        }
+
+        // Treats w as 1, the result has w = 1
+        [[nodiscard]] inline Vector<4, T, Qualifier::Aligned> TransformPoint(const Vector<4, T, Qualifier::Aligned>& point) const noexcept
+        {
+            return Affine3x4Functions<T>::TransformPoint(*this, point);
+        }
+
+        // Treats w as 0 (translation is ignored), the result has w = 0
+        [[nodiscard]] inline Vector<4, T, Qualifier::Aligned> TransformDirection(const Vector<4, T, Qualifier::Aligned>& direction) const noexcept
+        {
+            return Affine3x4Functions<T>::TransformDirection(*this, direction);
+        }
+
+        // The 3x3 part must be invertible
+        [[nodiscard]] inline Affine3x4<T> Inverse() const noexcept
+        {
+            return Affine3x4Functions<T>::Inverse(*this);
+        }
+
+        // Only valid if the 3x3 part is orthonormal (rotation + translation), but much cheaper than Inverse
+        [[nodiscard]] inline Affine3x4<T> InverseOrthonormal() const noexcept
+        {
+            return Affine3x4Functions<T>::InverseOrthonormal(*this);
+        }
+    };
+}
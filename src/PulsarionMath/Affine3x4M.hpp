@@ -0,0 +1,120 @@
+#pragma once
+
+#ifndef PULSARION_MATH_MATRIX_HPP
+#include "Matrix.hpp"
+#endif
+
+namespace Pulsarion::Math
+{
+    template<Arithmetic_t T>
+    struct Affine3x4Functions
+    {
+        inline static Affine3x4<T> Multiply(const Affine3x4<T>& left, const Affine3x4<T>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Affine3x4::Multiply");
+            Affine3x4<T> result;
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                for (std::size_t j = 0; j < 4; ++j)
+                {
+                    result.Get(i, j) = left.Get(i, 0) * right.Get(0, j) +
+                                       left.Get(i, 1) * right.Get(1, j) +
+                                       left.Get(i, 2) * right.Get(2, j);
+                }
+                // Implicit (0, 0, 0, 1) row of the right matrix
+                result.Get(i, 3) += left.Get(i, 3);
+            }
+            return result;
+        }
+
+        inline static Vector<4, T, Qualifier::Aligned> VecMultiply(const Affine3x4<T>& left, const Vector<4, T, Qualifier::Aligned>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Affine3x4::VecMultiply");
+            Vector<4, T, Qualifier::Aligned> result;
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                result[i] = left.Get(i, 0) * right[0] +
+                            left.Get(i, 1) * right[1] +
+                            left.Get(i, 2) * right[2] +
+                            left.Get(i, 3) * right[3];
+            }
+            result[3] = right[3];
+            return result;
+        }
+
+        inline static Vector<4, T, Qualifier::Aligned> TransformPoint(const Affine3x4<T>& left, const Vector<4, T, Qualifier::Aligned>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Affine3x4::TransformPoint");
+            Vector<4, T, Qualifier::Aligned> result;
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                result[i] = left.Get(i, 0) * right[0] +
+                            left.Get(i, 1) * right[1] +
+                            left.Get(i, 2) * right[2] +
+                            left.Get(i, 3);
+            }
+            result[3] = 1;
+            return result;
+        }
+
+        inline static Vector<4, T, Qualifier::Aligned> TransformDirection(const Affine3x4<T>& left, const Vector<4, T, Qualifier::Aligned>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Affine3x4::TransformDirection");
+            Vector<4, T, Qualifier::Aligned> result;
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                result[i] = left.Get(i, 0) * right[0] +
+                            left.Get(i, 1) * right[1] +
+                            left.Get(i, 2) * right[2];
+            }
+            result[3] = 0;
+            return result;
+        }
+
+        inline static Affine3x4<T> Inverse(const Affine3x4<T>& matrix) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Affine3x4::Inverse");
+            // The inverse of the 3x3 part is the transposed cofactor matrix divided by the determinant
+            const T c00 = matrix.Get(1, 1) * matrix.Get(2, 2) - matrix.Get(1, 2) * matrix.Get(2, 1);
+            const T c01 = matrix.Get(1, 2) * matrix.Get(2, 0) - matrix.Get(1, 0) * matrix.Get(2, 2);
+            const T c02 = matrix.Get(1, 0) * matrix.Get(2, 1) - matrix.Get(1, 1) * matrix.Get(2, 0);
+            const T invDet = T(1) / (matrix.Get(0, 0) * c00 + matrix.Get(0, 1) * c01 + matrix.Get(0, 2) * c02);
+
+            Affine3x4<T> result;
+            result.Get(0, 0) = c00 * invDet;
+            result.Get(1, 0) = c01 * invDet;
+            result.Get(2, 0) = c02 * invDet;
+            result.Get(0, 1) = (matrix.Get(0, 2) * matrix.Get(2, 1) - matrix.Get(0, 1) * matrix.Get(2, 2)) * invDet;
+            result.Get(1, 1) = (matrix.Get(0, 0) * matrix.Get(2, 2) - matrix.Get(0, 2) * matrix.Get(2, 0)) * invDet;
+            result.Get(2, 1) = (matrix.Get(0, 1) * matrix.Get(2, 0) - matrix.Get(0, 0) * matrix.Get(2, 1)) * invDet;
+            result.Get(0, 2) = (matrix.Get(0, 1) * matrix.Get(1, 2) - matrix.Get(0, 2) * matrix.Get(1, 1)) * invDet;
+            result.Get(1, 2) = (matrix.Get(0, 2) * matrix.Get(1, 0) - matrix.Get(0, 0) * matrix.Get(1, 2)) * invDet;
+            result.Get(2, 2) = (matrix.Get(0, 0) * matrix.Get(1, 1) - matrix.Get(0, 1) * matrix.Get(1, 0)) * invDet;
+
+            // The translation is -(inverse * translation)
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                result.Get(i, 3) = -(result.Get(i, 0) * matrix.Get(0, 3) +
+                                     result.Get(i, 1) * matrix.Get(1, 3) +
+                                     result.Get(i, 2) * matrix.Get(2, 3));
+            }
+            return result;
+        }
+
+        inline static Affine3x4<T> InverseOrthonormal(const Affine3x4<T>& matrix) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Affine3x4::InverseOrthonormal");
+            Affine3x4<T> result;
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                result.Get(i, 0) = matrix.Get(0, i);
+                result.Get(i, 1) = matrix.Get(1, i);
+                result.Get(i, 2) = matrix.Get(2, i);
+                result.Get(i, 3) = -(matrix.Get(0, i) * matrix.Get(0, 3) +
+                                     matrix.Get(1, i) * matrix.Get(1, 3) +
+                                     matrix.Get(2, i) * matrix.Get(2, 3));
+            }
+            return result;
+        }
+    };
+}
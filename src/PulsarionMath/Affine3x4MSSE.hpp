@@ -0,0 +1,184 @@
+#pragma once
+
+#include "PulsarionMath/Qualifier.hpp"
+#ifndef PULSARION_MATH_MATRIX_HPP
+#include "Matrix.hpp"
+#endif
+#include <immintrin.h>
+
+namespace Pulsarion::Math
+{
+    template<>
+    struct Affine3x4Functions<float>
+    {
+        inline static Affine3x4<float> Multiply(const Affine3x4<float>& left, const Affine3x4<float>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Affine3x4::Multiply");
+            __m128 in2[] = {
+                _mm_load_ps(&right[0].x()),
+                _mm_load_ps(&right[1].x()),
+                _mm_load_ps(&right[2].x()),
+            };
+            // Only the translation survives the implicit (0, 0, 0, 1) row of the right matrix
+            __m128 wMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+            Affine3x4<float> result;
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                __m128 row = _mm_load_ps(&left[i].x());
+                __m128 e0 = _mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0));
+                __m128 e1 = _mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1));
+                __m128 e2 = _mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2));
+
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 m0 = _mm_mul_ps(in2[0], e0);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 m1 = _mm_mul_ps(in2[1], e1);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 m2 = _mm_mul_ps(in2[2], e2);
+
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 a0 = _mm_add_ps(m0, m1);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 a1 = _mm_add_ps(m2, _mm_and_ps(row, wMask));
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 a2 = _mm_add_ps(a0, a1);
+
+                _mm_store_ps(&result[i].x(), a2);
+            }
+            return result;
+        }
+
+        inline static Vector<4, float, Qualifier::Aligned> VecMultiply(const Affine3x4<float>& matrix, const Vector<4, float, Qualifier::Aligned>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Affine3x4::VecMultiply");
+            __m128 v = _mm_load_ps(&vector.x());
+            __m128 result = Transform<0b11110000>(matrix, v);
+            // w is passed through
+            result = _mm_blend_ps(result, v, 0b1000);
+
+            Vector<4, float, Qualifier::Aligned> resultVector;
+            _mm_store_ps(&resultVector.x(), result);
+            return resultVector;
+        }
+
+        inline static Vector<4, float, Qualifier::Aligned> TransformPoint(const Affine3x4<float>& matrix, const Vector<4, float, Qualifier::Aligned>& point) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Affine3x4::TransformPoint");
+            __m128 one = _mm_set1_ps(1.0f);
+            __m128 v = _mm_blend_ps(_mm_load_ps(&point.x()), one, 0b1000);
+            __m128 result = _mm_blend_ps(Transform<0b11110000>(matrix, v), one, 0b1000);
+
+            Vector<4, float, Qualifier::Aligned> resultVector;
+            _mm_store_ps(&resultVector.x(), result);
+            return resultVector;
+        }
+
+        inline static Vector<4, float, Qualifier::Aligned> TransformDirection(const Affine3x4<float>& matrix, const Vector<4, float, Qualifier::Aligned>& direction) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Affine3x4::TransformDirection");
+            // Leaving w out of the dot products ignores the translation, and leaves 0 in the w lane
+            __m128 result = Transform<0b01110000>(matrix, _mm_load_ps(&direction.x()));
+
+            Vector<4, float, Qualifier::Aligned> resultVector;
+            _mm_store_ps(&resultVector.x(), result);
+            return resultVector;
+        }
+
+        inline static Affine3x4<float> Inverse(const Affine3x4<float>& matrix) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Affine3x4::Inverse");
+            __m128 xyzMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+            __m128 row0 = _mm_load_ps(&matrix[0].x());
+            __m128 row1 = _mm_load_ps(&matrix[1].x());
+            __m128 row2 = _mm_load_ps(&matrix[2].x());
+            __m128 a0 = _mm_and_ps(row0, xyzMask);
+            __m128 a1 = _mm_and_ps(row1, xyzMask);
+            __m128 a2 = _mm_and_ps(row2, xyzMask);
+
+            // The columns of the inverse are the cross products of the rows, divided by the determinant
+            __m128 c0 = Cross(a1, a2);
+            __m128 c1 = Cross(a2, a0);
+            __m128 c2 = Cross(a0, a1);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), _mm_dp_ps(a0, c0, 0b01111111));
+
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            c0 = _mm_mul_ps(c0, invDet);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            c1 = _mm_mul_ps(c1, invDet);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            c2 = _mm_mul_ps(c2, invDet);
+
+            __m128 translation = NegatedTranslation(c0, c1, c2, row0, row1, row2);
+            _MM_TRANSPOSE4_PS(c0, c1, c2, translation);
+
+            Affine3x4<float> result;
+            _mm_store_ps(&result[0].x(), c0);
+            _mm_store_ps(&result[1].x(), c1);
+            _mm_store_ps(&result[2].x(), c2);
+            return result;
+        }
+
+        inline static Affine3x4<float> InverseOrthonormal(const Affine3x4<float>& matrix) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Affine3x4::InverseOrthonormal");
+            __m128 xyzMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+            __m128 row0 = _mm_load_ps(&matrix[0].x());
+            __m128 row1 = _mm_load_ps(&matrix[1].x());
+            __m128 row2 = _mm_load_ps(&matrix[2].x());
+            // The rows of the 3x3 part are the columns of its inverse
+            __m128 a0 = _mm_and_ps(row0, xyzMask);
+            __m128 a1 = _mm_and_ps(row1, xyzMask);
+            __m128 a2 = _mm_and_ps(row2, xyzMask);
+
+            __m128 translation = NegatedTranslation(a0, a1, a2, row0, row1, row2);
+            _MM_TRANSPOSE4_PS(a0, a1, a2, translation);
+
+            Affine3x4<float> result;
+            _mm_store_ps(&result[0].x(), a0);
+            _mm_store_ps(&result[1].x(), a1);
+            _mm_store_ps(&result[2].x(), a2);
+            return result;
+        }
+
+    private:
+        // Dot products of the three rows with v, Mask selects the multiplied lanes (the low bits are filled in here)
+        template<int Mask>
+        inline static __m128 Transform(const Affine3x4<float>& matrix, __m128 v) noexcept
+        {
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 x = _mm_dp_ps(_mm_load_ps(&matrix[0].x()), v, Mask | 0b0001);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 y = _mm_dp_ps(_mm_load_ps(&matrix[1].x()), v, Mask | 0b0010);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 z = _mm_dp_ps(_mm_load_ps(&matrix[2].x()), v, Mask | 0b0100);
+            return _mm_or_ps(_mm_or_ps(x, y), z);
+        }
+
+        inline static __m128 Cross(__m128 left, __m128 right) noexcept
+        {
+            __m128 left0 = _mm_shuffle_ps(left, left, _MM_SHUFFLE(3, 0, 2, 1));
+            __m128 right0 = _mm_shuffle_ps(right, right, _MM_SHUFFLE(3, 1, 0, 2));
+            __m128 left1 = _mm_shuffle_ps(left, left, _MM_SHUFFLE(3, 1, 0, 2));
+            __m128 right1 = _mm_shuffle_ps(right, right, _MM_SHUFFLE(3, 0, 2, 1));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_sub_ps(_mm_mul_ps(left0, right0), _mm_mul_ps(left1, right1));
+        }
+
+        // -(c0 * t.x + c1 * t.y + c2 * t.z), where c are the columns of the inverted 3x3 part, and t is the w lane of the rows
+        inline static __m128 NegatedTranslation(__m128 c0, __m128 c1, __m128 c2, __m128 row0, __m128 row1, __m128 row2) noexcept
+        {
+            __m128 t0 = _mm_shuffle_ps(row0, row0, _MM_SHUFFLE(3, 3, 3, 3));
+            __m128 t1 = _mm_shuffle_ps(row1, row1, _MM_SHUFFLE(3, 3, 3, 3));
+            __m128 t2 = _mm_shuffle_ps(row2, row2, _MM_SHUFFLE(3, 3, 3, 3));
+
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 a0 = _mm_add_ps(_mm_mul_ps(c0, t0), _mm_mul_ps(c1, t1));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 a1 = _mm_add_ps(a0, _mm_mul_ps(c2, t2));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_sub_ps(_mm_setzero_ps(), a1);
+        }
+    };
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Core.hpp"
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace Pulsarion::Math
+{
+    // Allocator for std::vector (and friends) that aligns the storage, cache line aligned by default
+    template<typename T, std::size_t Alignment = 64>
+    struct AlignedAllocator
+    {
+        using value_type = T;
+
+        template<typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() noexcept = default;
+        template<typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+        [[nodiscard]] T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ Alignment }));
+        }
+
+        void deallocate(T* pointer, std::size_t) noexcept
+        {
+            ::operator delete(pointer, std::align_val_t{ Alignment });
+        }
+
+        template<typename U>
+        inline constexpr bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+    };
+
+    template<typename T, std::size_t Alignment = 64>
+    using AlignedVector = std::vector<T, AlignedAllocator<T, Alignment>>;
+}
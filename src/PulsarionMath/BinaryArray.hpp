@@ -0,0 +1,394 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Vector.hpp"
+#include "Matrix.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// A self describing container for arrays of vectors or matrices: a 64 byte header, then the elements exactly as they are in memory.
+// MappedBinaryArray maps the file and hands out spans straight into the mapping, so nothing is parsed or copied,
+// and the pages are only read when they are first touched.
+// The file is only valid for the element type, SIMD backend (which changes the size of aligned vectors) and major order it was written with,
+// As<E>() checks all of them against the header and returns an empty span when they don't match.
+namespace Pulsarion::Math
+{
+    enum class BinaryArrayStatus : std::uint8_t
+    {
+        Ok,
+        OpenFailed,
+        MapFailed,
+        WriteFailed,
+        NotOpen,
+        BadMagic,
+        UnsupportedVersion,
+        WrongEndianness,
+        TypeMismatch,   // A different kind, scalar, size, alignment or qualifier
+        LayoutMismatch, // Matrices written with the other major order
+        Truncated,
+    };
+
+    [[nodiscard]] inline constexpr const char* ToString(BinaryArrayStatus status) noexcept
+    {
+        switch (status)
+        {
+        case BinaryArrayStatus::Ok: return "Ok";
+        case BinaryArrayStatus::OpenFailed: return "OpenFailed";
+        case BinaryArrayStatus::MapFailed: return "MapFailed";
+        case BinaryArrayStatus::WriteFailed: return "WriteFailed";
+        case BinaryArrayStatus::NotOpen: return "NotOpen";
+        case BinaryArrayStatus::BadMagic: return "BadMagic";
+        case BinaryArrayStatus::UnsupportedVersion: return "UnsupportedVersion";
+        case BinaryArrayStatus::WrongEndianness: return "WrongEndianness";
+        case BinaryArrayStatus::TypeMismatch: return "TypeMismatch";
+        case BinaryArrayStatus::LayoutMismatch: return "LayoutMismatch";
+        case BinaryArrayStatus::Truncated: return "Truncated";
+        }
+        return "Unknown";
+    }
+
+    enum class BinaryArrayKind : std::uint8_t { Vector = 1, Matrix = 2 };
+    enum class BinaryScalar : std::uint8_t { Float32 = 1, Float64, Int8, UInt8, Int16, UInt16, Int32, UInt32, Int64, UInt64 };
+    enum class BinaryLayout : std::uint8_t { None = 0, ColumnMajor = 1, RowMajor = 2 };
+
+    struct BinaryArrayHeader
+    {
+        static constexpr char Magic[8] = { 'P', 'M', 'A', 'T', 'H', 'A', 'R', 'R' };
+        static constexpr std::uint32_t CurrentVersion = 1;
+        // The payload starts at a multiple of this, so it is aligned for any element (and a cache line) in a page aligned mapping
+        static constexpr std::uint64_t PayloadAlignment = 64;
+
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t headerSize;
+        BinaryArrayKind kind;
+        BinaryScalar scalar;
+        std::uint8_t rows; // The size of a vector
+        std::uint8_t columns; // 1 for a vector
+        std::uint8_t qualifier; // Of a vector, the storage vectors of matrices are always aligned
+        BinaryLayout layout;
+        std::uint8_t littleEndian;
+        std::uint8_t reserved0;
+        std::uint32_t elementSize;
+        std::uint32_t elementAlignment;
+        std::uint64_t count;
+        std::uint64_t payloadOffset;
+        std::uint8_t reserved1[16];
+    };
+    static_assert(sizeof(BinaryArrayHeader) == BinaryArrayHeader::PayloadAlignment, "The header fills exactly the space before the payload");
+    static_assert(std::is_trivially_copyable_v<BinaryArrayHeader>);
+
+    namespace Detail
+    {
+        // Only the builtin scalars, the other arithmetic types (Fixed) would be read back as plain integers
+        template<Arithmetic_t T>
+        inline constexpr BinaryScalar BinaryScalarOf() noexcept
+        {
+            static_assert(std::is_arithmetic_v<T>, "There is no binary format for this scalar");
+            static_assert(sizeof(T) <= 8 && (!std::is_floating_point_v<T> || sizeof(T) >= 4), "There is no binary format for this scalar");
+            if constexpr (std::is_floating_point_v<T>)
+                return sizeof(T) == 4 ? BinaryScalar::Float32 : BinaryScalar::Float64;
+            else if constexpr (sizeof(T) == 1)
+                return std::is_signed_v<T> ? BinaryScalar::Int8 : BinaryScalar::UInt8;
+            else if constexpr (sizeof(T) == 2)
+                return std::is_signed_v<T> ? BinaryScalar::Int16 : BinaryScalar::UInt16;
+            else if constexpr (sizeof(T) == 4)
+                return std::is_signed_v<T> ? BinaryScalar::Int32 : BinaryScalar::UInt32;
+            else
+                return std::is_signed_v<T> ? BinaryScalar::Int64 : BinaryScalar::UInt64;
+        }
+    }
+
+    // What an element type looks like in the header, only vectors and matrices can be stored
+    template<typename E>
+    struct BinaryArrayElement;
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    struct BinaryArrayElement<Vector<N, T, Q>>
+    {
+        static constexpr BinaryArrayKind Kind = BinaryArrayKind::Vector;
+        static constexpr BinaryScalar Scalar = Detail::BinaryScalarOf<T>();
+        static constexpr std::uint8_t Rows = N;
+        static constexpr std::uint8_t Columns = 1;
+        static constexpr Qualifier ElementQualifier = Q;
+        static constexpr BinaryLayout Layout = BinaryLayout::None;
+    };
+
+    template<std::size_t R, std::size_t C, Arithmetic_t T>
+    struct BinaryArrayElement<Matrix<R, C, T>>
+    {
+        static constexpr BinaryArrayKind Kind = BinaryArrayKind::Matrix;
+        static constexpr BinaryScalar Scalar = Detail::BinaryScalarOf<T>();
+        static constexpr std::uint8_t Rows = R;
+        static constexpr std::uint8_t Columns = C;
+        static constexpr Qualifier ElementQualifier = Qualifier::Aligned;
+#ifdef PULSARION_MATH_MATRIX_COLUMN_MAJOR
+        static constexpr BinaryLayout Layout = BinaryLayout::ColumnMajor;
+#else
+        static constexpr BinaryLayout Layout = BinaryLayout::RowMajor;
+#endif
+    };
+
+    // Stored as three rows whatever the major order
+    template<Arithmetic_t T>
+    struct BinaryArrayElement<Affine3x4<T>>
+    {
+        static constexpr BinaryArrayKind Kind = BinaryArrayKind::Matrix;
+        static constexpr BinaryScalar Scalar = Detail::BinaryScalarOf<T>();
+        static constexpr std::uint8_t Rows = 3;
+        static constexpr std::uint8_t Columns = 4;
+        static constexpr Qualifier ElementQualifier = Qualifier::Aligned;
+        static constexpr BinaryLayout Layout = BinaryLayout::RowMajor;
+    };
+
+    template<typename E>
+    inline BinaryArrayHeader MakeBinaryArrayHeader(std::uint64_t count) noexcept
+    {
+        using Element = BinaryArrayElement<E>;
+        static_assert(std::is_trivially_copyable_v<E>, "Only trivially copyable elements can be mapped");
+        static_assert(alignof(E) <= BinaryArrayHeader::PayloadAlignment);
+
+        BinaryArrayHeader header{};
+        std::memcpy(header.magic, BinaryArrayHeader::Magic, sizeof(header.magic));
+        header.version = BinaryArrayHeader::CurrentVersion;
+        header.headerSize = sizeof(BinaryArrayHeader);
+        header.kind = Element::Kind;
+        header.scalar = Element::Scalar;
+        header.rows = Element::Rows;
+        header.columns = Element::Columns;
+        header.qualifier = static_cast<std::uint8_t>(Element::ElementQualifier);
+        header.layout = Element::Layout;
+        header.littleEndian = std::endian::native == std::endian::little;
+        header.elementSize = sizeof(E);
+        header.elementAlignment = alignof(E);
+        header.count = count;
+        header.payloadOffset = BinaryArrayHeader::PayloadAlignment;
+        return header;
+    }
+
+    // Checks the header of a file of fileSize bytes against E, every field that changes the meaning of the payload has to match
+    template<typename E>
+    [[nodiscard]] inline BinaryArrayStatus ValidateBinaryArrayHeader(const BinaryArrayHeader& header, std::uint64_t fileSize) noexcept
+    {
+        if (fileSize < sizeof(BinaryArrayHeader))
+            return BinaryArrayStatus::Truncated;
+        if (std::memcmp(header.magic, BinaryArrayHeader::Magic, sizeof(header.magic)) != 0)
+            return BinaryArrayStatus::BadMagic;
+        if (header.version != BinaryArrayHeader::CurrentVersion || header.headerSize != sizeof(BinaryArrayHeader))
+            return BinaryArrayStatus::UnsupportedVersion;
+        if (header.littleEndian != (std::endian::native == std::endian::little))
+            return BinaryArrayStatus::WrongEndianness;
+
+        const BinaryArrayHeader expected = MakeBinaryArrayHeader<E>(header.count);
+        if (header.kind != expected.kind || header.scalar != expected.scalar || header.rows != expected.rows || header.columns != expected.columns
+            || header.qualifier != expected.qualifier || header.elementSize != expected.elementSize || header.elementAlignment != expected.elementAlignment)
+            return BinaryArrayStatus::TypeMismatch;
+        if (header.layout != expected.layout)
+            return BinaryArrayStatus::LayoutMismatch;
+
+        if (header.payloadOffset < sizeof(BinaryArrayHeader) || header.payloadOffset % BinaryArrayHeader::PayloadAlignment != 0
+            || header.payloadOffset > fileSize || header.count > (fileSize - header.payloadOffset) / sizeof(E))
+            return BinaryArrayStatus::Truncated;
+        return BinaryArrayStatus::Ok;
+    }
+
+    // Writes the header and the elements as they are in memory (including any padding of aligned vectors)
+    template<typename E>
+    [[nodiscard]] inline BinaryArrayStatus WriteBinaryArray(const std::filesystem::path& path, std::type_identity_t<std::span<const E>> elements)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            return BinaryArrayStatus::OpenFailed;
+
+        const BinaryArrayHeader header = MakeBinaryArrayHeader<E>(elements.size());
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(elements.data()), static_cast<std::streamsize>(elements.size_bytes()));
+        file.flush();
+        return file ? BinaryArrayStatus::Ok : BinaryArrayStatus::WriteFailed;
+    }
+
+    // A read only mapping of a whole file, unmapped when it is destroyed
+    class MappedFile
+    {
+    public:
+        MappedFile() noexcept = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        inline MappedFile(MappedFile&& other) noexcept
+            : m_Data(std::exchange(other.m_Data, nullptr)), m_Size(std::exchange(other.m_Size, 0))
+#ifdef _WIN32
+            , m_Mapping(std::exchange(other.m_Mapping, nullptr))
+#endif
+        {
+        }
+        inline MappedFile& operator=(MappedFile&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Close();
+                m_Data = std::exchange(other.m_Data, nullptr);
+                m_Size = std::exchange(other.m_Size, 0);
+#ifdef _WIN32
+                m_Mapping = std::exchange(other.m_Mapping, nullptr);
+#endif
+            }
+            return *this;
+        }
+        inline ~MappedFile() { Close(); }
+
+        // An empty file opens, but has no data
+        [[nodiscard]] inline BinaryArrayStatus Open(const std::filesystem::path& path) noexcept
+        {
+            Close();
+#ifdef _WIN32
+            HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+                return BinaryArrayStatus::OpenFailed;
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file, &size))
+            {
+                CloseHandle(file);
+                return BinaryArrayStatus::OpenFailed;
+            }
+            if (size.QuadPart == 0)
+            {
+                CloseHandle(file);
+                return BinaryArrayStatus::Ok;
+            }
+            m_Mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(file); // The mapping keeps the file open
+            if (m_Mapping == nullptr)
+                return BinaryArrayStatus::MapFailed;
+            void* data = MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0);
+            if (data == nullptr)
+            {
+                Close();
+                return BinaryArrayStatus::MapFailed;
+            }
+            m_Data = static_cast<const std::byte*>(data);
+            m_Size = static_cast<std::size_t>(size.QuadPart);
+#else
+            const int file = ::open(path.c_str(), O_RDONLY);
+            if (file < 0)
+                return BinaryArrayStatus::OpenFailed;
+            struct stat status;
+            if (::fstat(file, &status) != 0)
+            {
+                ::close(file);
+                return BinaryArrayStatus::OpenFailed;
+            }
+            if (status.st_size == 0)
+            {
+                ::close(file);
+                return BinaryArrayStatus::Ok;
+            }
+            void* data = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+            ::close(file); // The mapping keeps the file open
+            if (data == MAP_FAILED)
+                return BinaryArrayStatus::MapFailed;
+            m_Data = static_cast<const std::byte*>(data);
+            m_Size = static_cast<std::size_t>(status.st_size);
+#endif
+            return BinaryArrayStatus::Ok;
+        }
+
+        inline void Close() noexcept
+        {
+#ifdef _WIN32
+            if (m_Data != nullptr)
+                UnmapViewOfFile(m_Data);
+            if (m_Mapping != nullptr)
+                CloseHandle(m_Mapping);
+            m_Mapping = nullptr;
+#else
+            if (m_Data != nullptr)
+                ::munmap(const_cast<std::byte*>(m_Data), m_Size);
+#endif
+            m_Data = nullptr;
+            m_Size = 0;
+        }
+
+        [[nodiscard]] inline const std::byte* Data() const noexcept { return m_Data; }
+        [[nodiscard]] inline std::size_t Size() const noexcept { return m_Size; }
+
+    private:
+        const std::byte* m_Data = nullptr;
+        std::size_t m_Size = 0;
+#ifdef _WIN32
+        HANDLE m_Mapping = nullptr;
+#endif
+    };
+
+    // A mapped binary array file, the spans it returns stay valid until it is closed or destroyed
+    class MappedBinaryArray
+    {
+    public:
+        [[nodiscard]] inline BinaryArrayStatus Open(const std::filesystem::path& path) noexcept
+        {
+            m_Header = {};
+            const BinaryArrayStatus status = m_File.Open(path);
+            if (status != BinaryArrayStatus::Ok)
+                return status;
+            if (m_File.Size() < sizeof(BinaryArrayHeader))
+            {
+                m_File.Close();
+                return BinaryArrayStatus::Truncated;
+            }
+            std::memcpy(&m_Header, m_File.Data(), sizeof(BinaryArrayHeader));
+            return BinaryArrayStatus::Ok;
+        }
+
+        inline void Close() noexcept
+        {
+            m_File.Close();
+            m_Header = {};
+        }
+
+        [[nodiscard]] inline bool IsOpen() const noexcept { return m_File.Data() != nullptr; }
+        [[nodiscard]] inline const BinaryArrayHeader& Header() const noexcept { return m_Header; }
+
+        template<typename E>
+        [[nodiscard]] inline BinaryArrayStatus Check() const noexcept
+        {
+            if (!IsOpen())
+                return BinaryArrayStatus::NotOpen;
+            return ValidateBinaryArrayHeader<E>(m_Header, m_File.Size());
+        }
+
+        // The elements, without copying them, or an empty span if the file doesn't hold elements of type E (see Check)
+        template<typename E>
+        [[nodiscard]] inline std::span<const E> As() const noexcept
+        {
+            if (Check<E>() != BinaryArrayStatus::Ok)
+                return {};
+            return { reinterpret_cast<const E*>(m_File.Data() + m_Header.payloadOffset), static_cast<std::size_t>(m_Header.count) };
+        }
+
+    private:
+        MappedFile m_File;
+        BinaryArrayHeader m_Header{};
+    };
+}
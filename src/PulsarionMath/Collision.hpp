@@ -0,0 +1,103 @@
+#pragma once
+#define PULSARION_MATH_COLLISION_HPP
+
+#include "Vector.hpp"
+#include "CollisionCommon.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+// Narrowphase tests of oriented boxes with the separating axis theorem: two boxes overlap unless their projections on one of
+// 15 axes (the 3 face normals of each, and the 9 cross products of their edges) are disjoint. Touching boxes overlap.
+// TestOBBPairs runs the test for the candidate pairs of a broadphase, several pairs at a time.
+// GJK and EPA, for any convex shapes with a support function, are in Gjk.hpp.
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct OBB
+    {
+        Vector<3, T, Qualifier::Packed> center;
+        Vector<3, T, Qualifier::Packed> axes[3]; // Orthonormal, the columns of the rotation of the box
+        Vector<3, T, Qualifier::Packed> halfExtents;
+    };
+
+    // Indices of two boxes in a span
+    struct CollisionPair
+    {
+        std::uint32_t a;
+        std::uint32_t b;
+    };
+
+    namespace Detail
+    {
+        // The projection radii and center distance of every axis, in the frame of a, with the same operations in the same order as the SIMD kernel
+        template<FloatingPoint_t T>
+        [[nodiscard]] inline bool OBBsSeparated(const OBB<T>& a, const OBB<T>& b) noexcept
+        {
+            const T epsilon = static_cast<T>(CollisionConstants::SatParallelEpsilon);
+            T r[3][3], absR[3][3], t[3];
+            T d[3];
+            for (std::size_t k = 0; k < 3; ++k)
+                d[k] = b.center[k] - a.center[k];
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                for (std::size_t j = 0; j < 3; ++j)
+                {
+                    r[i][j] = a.axes[i][0] * b.axes[j][0] + a.axes[i][1] * b.axes[j][1] + a.axes[i][2] * b.axes[j][2];
+                    absR[i][j] = std::abs(r[i][j]) + epsilon;
+                }
+                t[i] = d[0] * a.axes[i][0] + d[1] * a.axes[i][1] + d[2] * a.axes[i][2];
+            }
+
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                const T rb = b.halfExtents[0] * absR[i][0] + b.halfExtents[1] * absR[i][1] + b.halfExtents[2] * absR[i][2];
+                if (std::abs(t[i]) > a.halfExtents[i] + rb)
+                    return true;
+            }
+            for (std::size_t j = 0; j < 3; ++j)
+            {
+                const T ra = a.halfExtents[0] * absR[0][j] + a.halfExtents[1] * absR[1][j] + a.halfExtents[2] * absR[2][j];
+                if (std::abs(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) > ra + b.halfExtents[j])
+                    return true;
+            }
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                const std::size_t i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+                for (std::size_t j = 0; j < 3; ++j)
+                {
+                    const std::size_t j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+                    const T ra = a.halfExtents[i1] * absR[i2][j] + a.halfExtents[i2] * absR[i1][j];
+                    const T rb = b.halfExtents[j1] * absR[i][j2] + b.halfExtents[j2] * absR[i][j1];
+                    if (std::abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > ra + rb)
+                        return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    // The scalar test of a single pair, which the batched kernels are tested against
+    template<FloatingPoint_t T>
+    [[nodiscard]] inline bool OBBsOverlap(const OBB<T>& a, const OBB<T>& b) noexcept
+    {
+        return !Detail::OBBsSeparated(a, b);
+    }
+
+    // overlaps[i] is 1 if the boxes of pairs[i] overlap, 0 otherwise
+    template<FloatingPoint_t T>
+    inline void TestOBBPairs(std::type_identity_t<std::span<const OBB<T>>> boxes, std::span<const CollisionPair> pairs, std::span<std::uint8_t> overlaps) noexcept
+    {
+        assert(pairs.size() == overlaps.size());
+        CollisionFunctions<T>::TestOBBPairs(boxes, pairs, overlaps);
+    }
+}
+
+#include "CollisionGeneric.hpp"
+
+#if defined(PULSARION_MATH_SIMD_SSE4_1)
+#include "CollisionSSE.hpp"
+#endif
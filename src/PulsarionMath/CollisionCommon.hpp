@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct CollisionFunctions; // Separating axis tests of spans of box pairs.
+
+    struct CollisionConstants
+    {
+        // Added to the absolute rotation terms, so the cross product axes of nearly parallel edges (close to zero) can't separate by rounding
+        static constexpr double SatParallelEpsilon = 1e-6;
+
+        static constexpr std::size_t GjkMaxIterations = 64;
+        static constexpr std::size_t EpaMaxIterations = 64;
+        // EPA stops once a new support point is at most this much farther than the closest face
+        static constexpr float EpaTolerance = 1e-4f;
+        static constexpr std::size_t EpaMaxVertices = EpaMaxIterations + 4;
+        static constexpr std::size_t EpaMaxFaces = 2 * EpaMaxVertices;
+    };
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#ifndef PULSARION_MATH_COLLISION_HPP
+#include "Collision.hpp"
+#endif
+
+#include <cstdint>
+#include <span>
+
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct CollisionFunctions
+    {
+        static inline void TestOBBPairs(std::span<const OBB<T>> boxes, std::span<const CollisionPair> pairs, std::span<std::uint8_t> overlaps) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Collision::TestOBBPairs");
+            for (std::size_t i = 0; i < pairs.size(); ++i)
+                overlaps[i] = Detail::OBBsSeparated(boxes[pairs[i].a], boxes[pairs[i].b]) ? 0 : 1;
+        }
+    };
+}
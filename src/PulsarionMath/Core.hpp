@@ -2,6 +2,8 @@
 
 #include <PulsarionCore/Core.hpp>
 #include <concepts>
+#include <type_traits>
+#include <utility>
 
 #ifdef PULSARION_BUILD_SHARED_LIB
 #ifdef PULSARION_BUILD_DLL
@@ -15,13 +17,26 @@
 
 namespace Pulsarion::Math
 {
+    // Scalar types other than the built in ones (e.g. Fixed) opt in to Vector and Matrix by specializing this
     template<typename T>
-    concept Arithmetic_t = std::is_arithmetic_v<T>;
+    struct IsArithmetic : std::is_arithmetic<T> {};
+
+    template<typename T>
+    concept Arithmetic_t = IsArithmetic<T>::value;
 
     template<typename T>
     concept Integral_t = std::is_integral_v<T>;
 
     template<typename T>
     concept FloatingPoint_t = std::is_floating_point_v<T>;
+
+    // Calls func(std::integral_constant<std::size_t, I>{}) for every I in [0, N), unrolled at compile time
+    template<std::size_t N, typename Func>
+    inline constexpr void StaticFor(Func&& func) noexcept
+    {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (func(std::integral_constant<std::size_t, I>{}), ...);
+        }(std::make_index_sequence<N>{});
+    }
 }
 
@@ -0,0 +1,302 @@
+#pragma once
+#define PULSARION_MATH_CURVE_HPP
+
+#include "Vector.hpp"
+#include "CurveCommon.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Cubic curves (Bezier, Hermite, Catmull-Rom) kept in the power basis, p(t) = c0 + c1 t + c2 t^2 + c3 t^3,
+// so the control points are converted once and every evaluation is a Horner chain, instead of the lerps of de Casteljau.
+// A spline is a sequence of such segments, its parameter u runs from 0 to the segment count, segment i covering [i, i + 1].
+// Parameters outside the range aren't clamped, they extrapolate the first or last segment.
+// Tangents are the derivatives with respect to the parameter, their length is the speed of the curve.
+namespace Pulsarion::Math
+{
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    struct CubicCurve
+    {
+        Vector<N, T, Q> coefficients[4];
+
+        [[nodiscard]] static inline CubicCurve Bezier(const Vector<N, T, Q>& p0, const Vector<N, T, Q>& p1, const Vector<N, T, Q>& p2, const Vector<N, T, Q>& p3) noexcept
+        {
+            CubicCurve curve;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                curve.coefficients[0][i] = p0[i];
+                curve.coefficients[1][i] = T(3) * (p1[i] - p0[i]);
+                curve.coefficients[2][i] = T(3) * (p0[i] - T(2) * p1[i] + p2[i]);
+                curve.coefficients[3][i] = p3[i] - p0[i] + T(3) * (p1[i] - p2[i]);
+            }
+            return curve;
+        }
+
+        // From p0 with tangent m0 to p1 with tangent m1
+        [[nodiscard]] static inline CubicCurve Hermite(const Vector<N, T, Q>& p0, const Vector<N, T, Q>& m0, const Vector<N, T, Q>& p1, const Vector<N, T, Q>& m1) noexcept
+        {
+            CubicCurve curve;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                curve.coefficients[0][i] = p0[i];
+                curve.coefficients[1][i] = m0[i];
+                curve.coefficients[2][i] = T(3) * (p1[i] - p0[i]) - T(2) * m0[i] - m1[i];
+                curve.coefficients[3][i] = T(2) * (p0[i] - p1[i]) + m0[i] + m1[i];
+            }
+            return curve;
+        }
+
+        // The uniform Catmull-Rom segment from p1 to p2
+        [[nodiscard]] static inline CubicCurve CatmullRom(const Vector<N, T, Q>& p0, const Vector<N, T, Q>& p1, const Vector<N, T, Q>& p2, const Vector<N, T, Q>& p3) noexcept
+        {
+            Vector<N, T, Q> m1, m2;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                m1[i] = T(0.5) * (p2[i] - p0[i]);
+                m2[i] = T(0.5) * (p3[i] - p1[i]);
+            }
+            return Hermite(p1, m1, p2, m2);
+        }
+
+        [[nodiscard]] inline Vector<N, T, Q> Position(T t) const noexcept
+        {
+            Vector<N, T, Q> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result[i] = ((coefficients[3][i] * t + coefficients[2][i]) * t + coefficients[1][i]) * t + coefficients[0][i];
+            return result;
+        }
+
+        [[nodiscard]] inline Vector<N, T, Q> Tangent(T t) const noexcept
+        {
+            Vector<N, T, Q> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result[i] = (T(3) * coefficients[3][i] * t + T(2) * coefficients[2][i]) * t + coefficients[1][i];
+            return result;
+        }
+    };
+
+    namespace Detail
+    {
+        // The segment of a spline parameter and the parameter within it, the first and last segments extend to the infinities
+        template<FloatingPoint_t T>
+        inline std::size_t LocateSegment(T u, std::size_t segmentCount, T& t) noexcept
+        {
+            const std::size_t segment = u >= T(1) ? static_cast<std::size_t>(std::min(u, static_cast<T>(segmentCount - 1))) : 0;
+            t = u - static_cast<T>(segment);
+            return segment;
+        }
+    }
+
+    // Evaluates curve at every parameter (of [0, 1]), the coefficients are loaded once for the whole span
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline void EvaluateCurve(const CubicCurve<N, T, Q>& curve, std::type_identity_t<std::span<const T>> parameters, std::type_identity_t<std::span<Vector<N, T, Q>>> positions) noexcept
+    {
+        assert(parameters.size() == positions.size());
+        CurveFunctions<N, T, Q>::EvaluateSegments(std::span<const CubicCurve<N, T, Q>>(&curve, 1), parameters, positions, {});
+    }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline void EvaluateCurve(const CubicCurve<N, T, Q>& curve, std::type_identity_t<std::span<const T>> parameters, std::type_identity_t<std::span<Vector<N, T, Q>>> positions,
+                              std::type_identity_t<std::span<Vector<N, T, Q>>> tangents) noexcept
+    {
+        assert(parameters.size() == positions.size() && parameters.size() == tangents.size());
+        CurveFunctions<N, T, Q>::EvaluateSegments(std::span<const CubicCurve<N, T, Q>>(&curve, 1), parameters, positions, tangents);
+    }
+
+    // Evaluates every curve at its own parameter, curves[i] at parameters[i], e.g. the particles of a ribbon each moving along their own curve
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline void EvaluateCurves(std::type_identity_t<std::span<const CubicCurve<N, T, Q>>> curves, std::type_identity_t<std::span<const T>> parameters,
+                               std::type_identity_t<std::span<Vector<N, T, Q>>> positions) noexcept
+    {
+        assert(curves.size() == parameters.size() && parameters.size() == positions.size());
+        CurveFunctions<N, T, Q>::EvaluateEach(curves, parameters, positions, {});
+    }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline void EvaluateCurves(std::type_identity_t<std::span<const CubicCurve<N, T, Q>>> curves, std::type_identity_t<std::span<const T>> parameters,
+                               std::type_identity_t<std::span<Vector<N, T, Q>>> positions, std::type_identity_t<std::span<Vector<N, T, Q>>> tangents) noexcept
+    {
+        assert(curves.size() == parameters.size() && parameters.size() == positions.size() && parameters.size() == tangents.size());
+        CurveFunctions<N, T, Q>::EvaluateEach(curves, parameters, positions, tangents);
+    }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    class CubicSpline
+    {
+    public:
+        CubicSpline() = default;
+        explicit inline CubicSpline(std::vector<CubicCurve<N, T, Q>> segments) noexcept : m_Segments(std::move(segments)) {}
+
+        // The spline through every point, the end tangents come from mirroring the second and second to last points
+        [[nodiscard]] static inline CubicSpline CatmullRom(std::span<const Vector<N, T, Q>> points)
+        {
+            assert(points.size() >= 2);
+            const std::size_t last = points.size() - 1;
+            const auto mirror = [](const Vector<N, T, Q>& point, const Vector<N, T, Q>& other) {
+                Vector<N, T, Q> result;
+                for (std::size_t i = 0; i < N; ++i)
+                    result[i] = T(2) * point[i] - other[i];
+                return result;
+            };
+
+            std::vector<CubicCurve<N, T, Q>> segments;
+            segments.reserve(last);
+            for (std::size_t i = 0; i < last; ++i)
+            {
+                const Vector<N, T, Q> before = i == 0 ? mirror(points[0], points[1]) : points[i - 1];
+                const Vector<N, T, Q> after = i + 1 == last ? mirror(points[last], points[last - 1]) : points[i + 2];
+                segments.push_back(CubicCurve<N, T, Q>::CatmullRom(before, points[i], points[i + 1], after));
+            }
+            return CubicSpline(std::move(segments));
+        }
+
+        [[nodiscard]] inline std::size_t SegmentCount() const noexcept { return m_Segments.size(); }
+        [[nodiscard]] inline std::span<const CubicCurve<N, T, Q>> Segments() const noexcept { return m_Segments; }
+
+        [[nodiscard]] inline Vector<N, T, Q> Position(T u) const noexcept
+        {
+            assert(!m_Segments.empty());
+            T t;
+            const std::size_t segment = Detail::LocateSegment(u, m_Segments.size(), t);
+            return m_Segments[segment].Position(t);
+        }
+
+        [[nodiscard]] inline Vector<N, T, Q> Tangent(T u) const noexcept
+        {
+            assert(!m_Segments.empty());
+            T t;
+            const std::size_t segment = Detail::LocateSegment(u, m_Segments.size(), t);
+            return m_Segments[segment].Tangent(t);
+        }
+
+        // Sorted parameters are fastest, runs of parameters in the same segment reuse its coefficients
+        inline void Evaluate(std::span<const T> parameters, std::span<Vector<N, T, Q>> positions) const noexcept
+        {
+            assert(!m_Segments.empty() && parameters.size() == positions.size());
+            CurveFunctions<N, T, Q>::EvaluateSegments(m_Segments, parameters, positions, {});
+        }
+
+        inline void Evaluate(std::span<const T> parameters, std::span<Vector<N, T, Q>> positions, std::span<Vector<N, T, Q>> tangents) const noexcept
+        {
+            assert(!m_Segments.empty() && parameters.size() == positions.size() && parameters.size() == tangents.size());
+            CurveFunctions<N, T, Q>::EvaluateSegments(m_Segments, parameters, positions, tangents);
+        }
+
+    private:
+        std::vector<CubicCurve<N, T, Q>> m_Segments;
+    };
+
+    // The arc length of a spline at evenly spaced parameters, to map distances along the spline to parameters,
+    // e.g. to move a camera at a constant speed or place ribbon vertices at equal spacing
+    template<FloatingPoint_t T>
+    class ArcLengthTable
+    {
+    public:
+        ArcLengthTable() = default;
+
+        template<std::size_t N, Qualifier Q>
+        explicit ArcLengthTable(const CubicSpline<N, T, Q>& spline, std::size_t samplesPerSegment = CurveConstants::ArcLengthSamples)
+        {
+            assert(samplesPerSegment > 0);
+            const std::size_t intervals = spline.SegmentCount() * samplesPerSegment;
+            m_Step = T(1) / static_cast<T>(samplesPerSegment);
+
+            // The speed at the 3 Gauss-Legendre nodes of every interval, evaluated as one batch
+            const T nodes[3] = { T(0.5) - T(0.3872983346207417), T(0.5), T(0.5) + T(0.3872983346207417) };
+            const T weights[3] = { T(5) / T(18), T(8) / T(18), T(5) / T(18) };
+            std::vector<T> parameters(intervals * 3);
+            for (std::size_t i = 0; i < intervals; ++i)
+            {
+                for (std::size_t node = 0; node < 3; ++node)
+                    parameters[i * 3 + node] = (static_cast<T>(i) + nodes[node]) * m_Step;
+            }
+            std::vector<Vector<N, T, Q>> positions(parameters.size()), tangents(parameters.size());
+            if (!parameters.empty())
+                spline.Evaluate(parameters, positions, tangents);
+
+            m_Lengths.resize(intervals + 1);
+            m_Lengths[0] = T(0);
+            for (std::size_t i = 0; i < intervals; ++i)
+            {
+                T length = T(0);
+                for (std::size_t node = 0; node < 3; ++node)
+                {
+                    T speedSquared = T(0);
+                    for (std::size_t d = 0; d < N; ++d)
+                        speedSquared += tangents[i * 3 + node][d] * tangents[i * 3 + node][d];
+                    length += weights[node] * std::sqrt(speedSquared);
+                }
+                m_Lengths[i + 1] = m_Lengths[i] + length * m_Step;
+            }
+        }
+
+        [[nodiscard]] inline T Length() const noexcept { return m_Lengths.empty() ? T(0) : m_Lengths.back(); }
+
+        // The parameter at the distance from the start, linear between the samples, clamped to the spline
+        [[nodiscard]] inline T ParameterAt(T distance) const noexcept
+        {
+            if (m_Lengths.size() < 2 || !(distance > T(0)))
+                return T(0);
+            if (distance >= m_Lengths.back())
+                return static_cast<T>(m_Lengths.size() - 1) * m_Step;
+            const auto upper = static_cast<std::size_t>(std::upper_bound(m_Lengths.begin(), m_Lengths.end(), distance) - m_Lengths.begin());
+            return Interpolate(upper - 1, distance);
+        }
+
+        // Parameters at evenly spaced distances, the first at the start and the last at the end, found with a single walk of the table
+        inline void UniformParameters(std::span<T> parameters) const noexcept
+        {
+            if (parameters.empty())
+                return;
+            if (parameters.size() == 1 || m_Lengths.size() < 2)
+            {
+                std::fill(parameters.begin(), parameters.end(), T(0));
+                if (m_Lengths.size() >= 2)
+                    parameters.back() = static_cast<T>(m_Lengths.size() - 1) * m_Step;
+                return;
+            }
+
+            const T spacing = Length() / static_cast<T>(parameters.size() - 1);
+            std::size_t interval = 0;
+            for (std::size_t i = 0; i + 1 < parameters.size(); ++i)
+            {
+                const T distance = spacing * static_cast<T>(i);
+                while (interval + 2 < m_Lengths.size() && m_Lengths[interval + 1] <= distance)
+                    ++interval;
+                parameters[i] = Interpolate(interval, distance);
+            }
+            parameters.back() = static_cast<T>(m_Lengths.size() - 1) * m_Step;
+        }
+
+    private:
+        std::vector<T> m_Lengths; // The length up to the parameter i * m_Step
+        T m_Step = T(0);
+
+        inline T Interpolate(std::size_t interval, T distance) const noexcept
+        {
+            const T length = m_Lengths[interval + 1] - m_Lengths[interval];
+            const T fraction = length > T(0) ? (distance - m_Lengths[interval]) / length : T(0);
+            return (static_cast<T>(interval) + fraction) * m_Step;
+        }
+    };
+
+    // Positions at evenly spaced distances along the spline, the first at its start and the last at its end
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline void SampleUniform(const CubicSpline<N, T, Q>& spline, const ArcLengthTable<T>& table, std::type_identity_t<std::span<Vector<N, T, Q>>> positions)
+    {
+        std::vector<T> parameters(positions.size());
+        table.UniformParameters(parameters);
+        spline.Evaluate(parameters, positions);
+    }
+}
+
+#include "CurveGeneric.hpp"
+
+#ifdef PULSARION_MATH_SIMD_SSE4_1
+#include "CurveSSE.hpp"
+#endif
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+#include "Qualifier.hpp"
+
+namespace Pulsarion::Math
+{
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    struct CurveFunctions; // Evaluates cubic curves at spans of parameters.
+
+    struct CurveConstants
+    {
+        // Intervals per segment of an arc length table, the length of each is integrated with 3 point Gauss-Legendre
+        static constexpr std::size_t ArcLengthSamples = 16;
+    };
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#ifndef PULSARION_MATH_CURVE_HPP
+#include "Curve.hpp"
+#endif
+
+#include <span>
+
+namespace Pulsarion::Math
+{
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    struct CurveFunctions
+    {
+        // Parameter u of the spline made of segments, tangents can be empty
+        static inline void EvaluateSegments(std::span<const CubicCurve<N, T, Q>> segments, std::span<const T> parameters, std::span<Vector<N, T, Q>> positions, std::span<Vector<N, T, Q>> tangents) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Curve", N, "::EvaluateSegments");
+            if (tangents.empty())
+                Segments<false>(segments, parameters, positions, tangents);
+            else
+                Segments<true>(segments, parameters, positions, tangents);
+        }
+
+        // Parameter t of curves[i], tangents can be empty
+        static inline void EvaluateEach(std::span<const CubicCurve<N, T, Q>> curves, std::span<const T> parameters, std::span<Vector<N, T, Q>> positions, std::span<Vector<N, T, Q>> tangents) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Curve", N, "::EvaluateEach");
+            if (tangents.empty())
+                Each<false>(curves, parameters, positions, tangents);
+            else
+                Each<true>(curves, parameters, positions, tangents);
+        }
+
+    private:
+        template<bool Tangents>
+        static inline void Segments(std::span<const CubicCurve<N, T, Q>> segments, std::span<const T> parameters, std::span<Vector<N, T, Q>> positions, std::span<Vector<N, T, Q>> tangents) noexcept
+        {
+            for (std::size_t i = 0; i < parameters.size(); ++i)
+            {
+                T t;
+                const std::size_t segment = Detail::LocateSegment(parameters[i], segments.size(), t);
+                Evaluate<Tangents>(segments[segment], t, positions, tangents, i);
+            }
+        }
+
+        template<bool Tangents>
+        static inline void Each(std::span<const CubicCurve<N, T, Q>> curves, std::span<const T> parameters, std::span<Vector<N, T, Q>> positions, std::span<Vector<N, T, Q>> tangents) noexcept
+        {
+            for (std::size_t i = 0; i < parameters.size(); ++i)
+                Evaluate<Tangents>(curves[i], parameters[i], positions, tangents, i);
+        }
+
+        template<bool Tangents>
+        static inline void Evaluate(const CubicCurve<N, T, Q>& curve, T t, std::span<Vector<N, T, Q>> positions, std::span<Vector<N, T, Q>> tangents, std::size_t i) noexcept
+        {
+            // Through locals, the stores could otherwise alias the coefficients and force them to be reloaded
+            const auto& c = curve.coefficients;
+            T position[N], tangent[N];
+            for (std::size_t d = 0; d < N; ++d)
+            {
+                position[d] = ((c[3][d] * t + c[2][d]) * t + c[1][d]) * t + c[0][d];
+                if constexpr (Tangents)
+                    tangent[d] = (T(3) * c[3][d] * t + T(2) * c[2][d]) * t + c[1][d];
+            }
+            for (std::size_t d = 0; d < N; ++d)
+            {
+                positions[i][d] = position[d];
+                if constexpr (Tangents)
+                    tangents[i][d] = tangent[d];
+            }
+        }
+    };
+}
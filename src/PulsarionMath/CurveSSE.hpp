@@ -0,0 +1,112 @@
+#pragma once
+
+#ifndef PULSARION_MATH_CURVE_HPP
+#include "Curve.hpp"
+#endif
+
+#include "VectorLayoutSSE.hpp"
+
+#include <immintrin.h>
+#include <span>
+
+namespace Pulsarion::Math
+{
+    // A register per point, the 4 coefficients of its segment are registers (kept while consecutive parameters stay in the segment)
+    // and the position is 3 multiply adds with the broadcast parameter, the tangent 2 more with the coefficients scaled by 2 and 3 beforehand.
+    // The lanes are the components, so 3 component curves leave one of the 4 idle and a point is evaluated per iteration.
+    template<std::size_t N, Qualifier Q>
+    struct CurveFunctionsSSE
+    {
+        using V = Vector<N, float, Q>;
+        using Curve = CubicCurve<N, float, Q>;
+        static_assert(N == 4 || Q == Qualifier::Aligned || sizeof(V) == 3 * sizeof(float), "Packed vectors have to be contiguous");
+
+        static inline void EvaluateSegments(std::span<const Curve> segments, std::span<const float> parameters, std::span<V> positions, std::span<V> tangents) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Curve", N, "::EvaluateSegments");
+            if (tangents.empty())
+                Segments<false>(segments, parameters, positions, tangents);
+            else
+                Segments<true>(segments, parameters, positions, tangents);
+        }
+
+        static inline void EvaluateEach(std::span<const Curve> curves, std::span<const float> parameters, std::span<V> positions, std::span<V> tangents) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Curve", N, "::EvaluateEach");
+            if (tangents.empty())
+                Each<false>(curves, parameters, positions, tangents);
+            else
+                Each<true>(curves, parameters, positions, tangents);
+        }
+
+    private:
+        struct Coefficients
+        {
+            __m128 c0, c1, c2, c3;
+            __m128 twoC2, threeC3; // Of the derivative
+
+            explicit inline Coefficients(const Curve& curve) noexcept
+                : c0(Detail::LoadVectorSSE(curve.coefficients[0])), c1(Detail::LoadVectorSSE(curve.coefficients[1])),
+                  c2(Detail::LoadVectorSSE(curve.coefficients[2])), c3(Detail::LoadVectorSSE(curve.coefficients[3])),
+                  twoC2(_mm_mul_ps(_mm_set1_ps(2.0f), c2)), threeC3(_mm_mul_ps(_mm_set1_ps(3.0f), c3))
+            {
+            }
+
+            inline __m128 Position(__m128 t) const noexcept
+            {
+                return _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(c3, t), c2), t), c1), t), c0);
+            }
+
+            inline __m128 Tangent(__m128 t) const noexcept
+            {
+                return _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(threeC3, t), twoC2), t), c1);
+            }
+        };
+
+        template<bool Tangents>
+        static inline void Segments(std::span<const Curve> segments, std::span<const float> parameters, std::span<V> positions, std::span<V> tangents) noexcept
+        {
+            std::size_t current = 0;
+            Coefficients coefficients(segments[0]);
+            for (std::size_t i = 0; i < parameters.size(); ++i)
+            {
+                float local;
+                const std::size_t segment = Detail::LocateSegment(parameters[i], segments.size(), local);
+                if (segment != current)
+                {
+                    coefficients = Coefficients(segments[segment]);
+                    current = segment;
+                }
+                const __m128 t = _mm_set1_ps(local);
+                Detail::StoreVectorSSE(coefficients.Position(t), positions[i]);
+                if constexpr (Tangents)
+                    Detail::StoreVectorSSE(coefficients.Tangent(t), tangents[i]);
+            }
+        }
+
+        template<bool Tangents>
+        static inline void Each(std::span<const Curve> curves, std::span<const float> parameters, std::span<V> positions, std::span<V> tangents) noexcept
+        {
+            for (std::size_t i = 0; i < parameters.size(); ++i)
+            {
+                const Coefficients coefficients(curves[i]);
+                const __m128 t = _mm_set1_ps(parameters[i]);
+                Detail::StoreVectorSSE(coefficients.Position(t), positions[i]);
+                if constexpr (Tangents)
+                    Detail::StoreVectorSSE(coefficients.Tangent(t), tangents[i]);
+            }
+        }
+    };
+
+    template<>
+    struct CurveFunctions<4, float, Qualifier::Aligned> : CurveFunctionsSSE<4, Qualifier::Aligned> {};
+
+    template<>
+    struct CurveFunctions<4, float, Qualifier::Packed> : CurveFunctionsSSE<4, Qualifier::Packed> {};
+
+    template<>
+    struct CurveFunctions<3, float, Qualifier::Aligned> : CurveFunctionsSSE<3, Qualifier::Aligned> {};
+
+    template<>
+    struct CurveFunctions<3, float, Qualifier::Packed> : CurveFunctionsSSE<3, Qualifier::Packed> {};
+}
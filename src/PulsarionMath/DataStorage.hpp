@@ -20,7 +20,7 @@ namespace Pulsarion::Math
 
         DataStorage() = default;
         template<typename... Args>
-        explicit DataStorage(Args&&... args) : data{std::forward<Args>(args)...} {}
+        explicit constexpr DataStorage(Args&&... args) : data{std::forward<Args>(args)...} {}
         DataStorage(const DataStorage&) = default;
         DataStorage(DataStorage&&) = default;
         DataStorage& operator=(const DataStorage&) = default;
@@ -35,7 +35,40 @@ namespace Pulsarion::Math
 
         DataStorage() = default;
         template<typename... Args>
-        explicit DataStorage(Args&&... args) : data{std::forward<Args>(args)...} {}
+        explicit constexpr DataStorage(Args&&... args) : data{std::forward<Args>(args)...} {}
+        DataStorage(const DataStorage&) = default;
+        DataStorage(DataStorage&&) = default;
+        DataStorage& operator=(const DataStorage&) = default;
+        DataStorage& operator=(DataStorage&&) = default;
+    };
+
+    // Padded to the size of a 4 component vector, so it can be loaded and stored as a whole SIMD register
+    template<Arithmetic_t T>
+    class DataStorage<3, T, Qualifier::Aligned>
+    {
+    public:
+        PULSARION_MATH_ALIGN std::array<T, 3> data;
+        T padding = 0; // Kept at zero, so the unused lane doesn't hold NaNs or denormals
+
+        DataStorage() = default;
+        template<typename... Args>
+        explicit constexpr DataStorage(Args&&... args) : data{std::forward<Args>(args)...} {}
+        DataStorage(const DataStorage&) = default;
+        DataStorage(DataStorage&&) = default;
+        DataStorage& operator=(const DataStorage&) = default;
+        DataStorage& operator=(DataStorage&&) = default;
+    };
+
+    // Aligned to its own size, so two of them (e.g. a 2x2 matrix) fit in a single 16 byte register
+    template<Arithmetic_t T>
+    class DataStorage<2, T, Qualifier::Aligned>
+    {
+    public:
+        alignas(2 * sizeof(T)) std::array<T, 2> data;
+
+        DataStorage() = default;
+        template<typename... Args>
+        explicit constexpr DataStorage(Args&&... args) : data{std::forward<Args>(args)...} {}
         DataStorage(const DataStorage&) = default;
         DataStorage(DataStorage&&) = default;
         DataStorage& operator=(const DataStorage&) = default;
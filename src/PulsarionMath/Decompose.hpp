@@ -0,0 +1,130 @@
+#pragma once
+#define PULSARION_MATH_DECOMPOSE_HPP
+
+#include "Vector.hpp"
+#include "Matrix.hpp"
+#include "DecomposeCommon.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <span>
+#include <type_traits>
+
+// Decomposition of affine matrices into translation, rotation and scale, and the polar decomposition M = R * S
+// of a 3x3 matrix into a rotation (orthogonal) R and a symmetric stretch S, for matrices with shear.
+// Rotations are unit quaternions stored as x, y, z, w.
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct TRS
+    {
+        Vector<3, T, Qualifier::Aligned> translation;
+        Vector<4, T, Qualifier::Aligned> rotation; // Quaternion x, y, z, w
+        Vector<3, T, Qualifier::Aligned> scale;
+
+        // Translation * Rotation * Scale
+        [[nodiscard]] inline Matrix<4, 4, T> ToMatrix() const noexcept
+        {
+            const T x = rotation[0], y = rotation[1], z = rotation[2], w = rotation[3];
+            return Matrix<4, 4, T>((T(1) - T(2) * (y * y + z * z)) * scale[0], T(2) * (x * y - z * w) * scale[1], T(2) * (x * z + y * w) * scale[2], translation[0],
+                                   T(2) * (x * y + z * w) * scale[0], (T(1) - T(2) * (x * x + z * z)) * scale[1], T(2) * (y * z - x * w) * scale[2], translation[1],
+                                   T(2) * (x * z - y * w) * scale[0], T(2) * (y * z + x * w) * scale[1], (T(1) - T(2) * (x * x + y * y)) * scale[2], translation[2],
+                                   T(0), T(0), T(0), T(1));
+        }
+    };
+
+    template<FloatingPoint_t T>
+    struct PolarDecomposition
+    {
+        Matrix<3, 3, T> rotation; // Orthogonal, with the sign of the determinant of the matrix (a reflection if it is negative)
+        Matrix<3, 3, T> stretch;  // Symmetric
+    };
+
+    namespace Detail
+    {
+        // Shepperd's method, the largest of the four components is found from the diagonal and the others are divided by it,
+        // so nothing is taken from the square root of a small difference
+        template<FloatingPoint_t T>
+        inline Vector<4, T, Qualifier::Aligned> QuaternionFromRotation(const T (&m)[3][3]) noexcept // m[row][column]
+        {
+            const T trace = m[0][0] + m[1][1] + m[2][2];
+            Vector<4, T, Qualifier::Aligned> result;
+            if (trace > T(0))
+            {
+                const T s = std::sqrt(trace + T(1)) * T(2);
+                result = Vector<4, T, Qualifier::Aligned>((m[2][1] - m[1][2]) / s, (m[0][2] - m[2][0]) / s, (m[1][0] - m[0][1]) / s, T(0.25) * s);
+            }
+            else if (m[0][0] > m[1][1] && m[0][0] > m[2][2])
+            {
+                const T s = std::sqrt(T(1) + m[0][0] - m[1][1] - m[2][2]) * T(2);
+                result = Vector<4, T, Qualifier::Aligned>(T(0.25) * s, (m[0][1] + m[1][0]) / s, (m[0][2] + m[2][0]) / s, (m[2][1] - m[1][2]) / s);
+            }
+            else if (m[1][1] > m[2][2])
+            {
+                const T s = std::sqrt(T(1) + m[1][1] - m[0][0] - m[2][2]) * T(2);
+                result = Vector<4, T, Qualifier::Aligned>((m[0][1] + m[1][0]) / s, T(0.25) * s, (m[1][2] + m[2][1]) / s, (m[0][2] - m[2][0]) / s);
+            }
+            else
+            {
+                const T s = std::sqrt(T(1) + m[2][2] - m[0][0] - m[1][1]) * T(2);
+                result = Vector<4, T, Qualifier::Aligned>((m[0][2] + m[2][0]) / s, (m[1][2] + m[2][1]) / s, T(0.25) * s, (m[1][0] - m[0][1]) / s);
+            }
+
+            // The matrix is only nearly orthogonal after a division by the scale
+            const T length = std::sqrt(result[0] * result[0] + result[1] * result[1] + result[2] * result[2] + result[3] * result[3]);
+            for (std::size_t i = 0; i < 4; ++i)
+                result[i] /= length;
+            return result;
+        }
+    }
+
+    // The scale is the length of the columns of the 3x3 part, with the x scale negated if the matrix mirrors.
+    // Assumes there is no shear (e.g. a product of TRS matrices with uniform scales), a sheared matrix gives the
+    // rotation closest to its normalized columns, use PolarDecompose to separate the shear instead.
+    template<FloatingPoint_t T>
+    [[nodiscard]] inline TRS<T> Decompose(const Matrix<4, 4, T>& matrix) noexcept
+    {
+        return DecomposeFunctions<T>::Decompose(matrix);
+    }
+
+    // Scaled Newton iteration R = (g * R + R^-T / g) / 2, stopped when it converges or after maxIterations.
+    // The matrix has to be non singular.
+    template<FloatingPoint_t T>
+    [[nodiscard]] inline PolarDecomposition<T> PolarDecompose(const Matrix<3, 3, T>& matrix, std::size_t maxIterations = DecomposeConstants::PolarIterations) noexcept
+    {
+        return DecomposeFunctions<T>::PolarDecompose(matrix, maxIterations);
+    }
+
+    // The polar decomposition of the 3x3 part
+    template<FloatingPoint_t T>
+    [[nodiscard]] inline PolarDecomposition<T> PolarDecompose(const Matrix<4, 4, T>& matrix, std::size_t maxIterations = DecomposeConstants::PolarIterations) noexcept
+    {
+        return DecomposeFunctions<T>::PolarDecompose(Matrix<3, 3, T>(matrix.Get(0, 0), matrix.Get(0, 1), matrix.Get(0, 2),
+                                                                     matrix.Get(1, 0), matrix.Get(1, 1), matrix.Get(1, 2),
+                                                                     matrix.Get(2, 0), matrix.Get(2, 1), matrix.Get(2, 2)), maxIterations);
+    }
+
+    // ---- Batched ----
+    template<FloatingPoint_t T>
+    inline void Decompose(std::type_identity_t<std::span<const Matrix<4, 4, T>>> matrices, std::type_identity_t<std::span<TRS<T>>> results) noexcept
+    {
+        assert(matrices.size() == results.size());
+        for (std::size_t i = 0; i < matrices.size(); ++i)
+            results[i] = DecomposeFunctions<T>::Decompose(matrices[i]);
+    }
+
+    template<FloatingPoint_t T>
+    inline void PolarDecompose(std::type_identity_t<std::span<const Matrix<3, 3, T>>> matrices, std::type_identity_t<std::span<PolarDecomposition<T>>> results,
+                               std::size_t maxIterations = DecomposeConstants::PolarIterations) noexcept
+    {
+        assert(matrices.size() == results.size());
+        for (std::size_t i = 0; i < matrices.size(); ++i)
+            results[i] = DecomposeFunctions<T>::PolarDecompose(matrices[i], maxIterations);
+    }
+}
+
+#include "DecomposeGeneric.hpp"
+
+#if defined(PULSARION_MATH_SIMD_SSE4_1) && defined(PULSARION_MATH_MATRIX_COLUMN_MAJOR) && !defined(PULSARION_MATH_DETERMINISTIC)
+#include "DecomposeSSE.hpp"
+#endif
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct DecomposeFunctions; // Translation, rotation and scale of affine matrices, and polar decompositions.
+
+    struct DecomposeConstants
+    {
+        // The scaled Newton iteration of the polar decomposition converges in 5 to 8 iterations for anything that isn't nearly singular
+        static constexpr std::size_t PolarIterations = 16;
+    };
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#ifndef PULSARION_MATH_DECOMPOSE_HPP
+#include "Decompose.hpp"
+#endif
+
+#include <cmath>
+#include <limits>
+
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct DecomposeFunctions
+    {
+        static inline TRS<T> Decompose(const Matrix<4, 4, T>& matrix) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Decompose::Decompose");
+            TRS<T> result;
+            T columns[3][3];
+            for (std::size_t column = 0; column < 3; ++column)
+            {
+                result.translation[column] = matrix.Get(column, 3);
+                for (std::size_t row = 0; row < 3; ++row)
+                    columns[column][row] = matrix.Get(row, column);
+                result.scale[column] = std::sqrt(Dot(columns[column], columns[column]));
+            }
+
+            T cross[3];
+            Cross(columns[1], columns[2], cross);
+            if (Dot(columns[0], cross) < T(0))
+                result.scale[0] = -result.scale[0];
+
+            T rotation[3][3];
+            for (std::size_t column = 0; column < 3; ++column)
+            {
+                const T inverse = result.scale[column] != T(0) ? T(1) / result.scale[column] : T(0);
+                for (std::size_t row = 0; row < 3; ++row)
+                    rotation[row][column] = columns[column][row] * inverse;
+            }
+            result.rotation = Detail::QuaternionFromRotation<T>(rotation);
+            return result;
+        }
+
+        static inline PolarDecomposition<T> PolarDecompose(const Matrix<3, 3, T>& matrix, std::size_t maxIterations) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Decompose::PolarDecompose");
+            T columns[3][3], q[3][3];
+            for (std::size_t column = 0; column < 3; ++column)
+            {
+                for (std::size_t row = 0; row < 3; ++row)
+                    q[column][row] = columns[column][row] = matrix.Get(row, column);
+            }
+
+            for (std::size_t iteration = 0; iteration < maxIterations; ++iteration)
+            {
+                // The columns of the cofactor matrix are the cross products of the other two columns, and R^-T = cofactor / determinant
+                T cofactor[3][3];
+                Cross(q[1], q[2], cofactor[0]);
+                Cross(q[2], q[0], cofactor[1]);
+                Cross(q[0], q[1], cofactor[2]);
+                const T determinant = Dot(q[0], cofactor[0]);
+                if (determinant == T(0))
+                    break;
+
+                // g = sqrt(|R^-1| / |R|) in the Frobenius norm, which makes the first iterations converge much faster
+                const T norm = Dot(q[0], q[0]) + Dot(q[1], q[1]) + Dot(q[2], q[2]);
+                const T inverseNorm = (Dot(cofactor[0], cofactor[0]) + Dot(cofactor[1], cofactor[1]) + Dot(cofactor[2], cofactor[2])) / (determinant * determinant);
+                const T gamma = std::sqrt(std::sqrt(inverseNorm / norm));
+                const T left = T(0.5) * gamma;
+                const T right = T(0.5) / (gamma * determinant);
+
+                T change = T(0);
+                for (std::size_t column = 0; column < 3; ++column)
+                {
+                    for (std::size_t row = 0; row < 3; ++row)
+                    {
+                        const T next = left * q[column][row] + right * cofactor[column][row];
+                        change += (next - q[column][row]) * (next - q[column][row]);
+                        q[column][row] = next;
+                    }
+                }
+                if (change <= Tolerance)
+                    break;
+            }
+
+            PolarDecomposition<T> result;
+            for (std::size_t column = 0; column < 3; ++column)
+            {
+                for (std::size_t row = 0; row < 3; ++row)
+                    result.rotation.Get(row, column) = q[column][row];
+            }
+            // S = R^T * M, averaged with its transpose to remove the rounding errors
+            for (std::size_t row = 0; row < 3; ++row)
+            {
+                for (std::size_t column = row; column < 3; ++column)
+                {
+                    const T value = T(0.5) * (Dot(q[row], columns[column]) + Dot(q[column], columns[row]));
+                    result.stretch.Get(row, column) = value;
+                    result.stretch.Get(column, row) = value;
+                }
+            }
+            return result;
+        }
+
+    private:
+        // The squared Frobenius norm of the last change of the rotation, a few ULP of a unit matrix
+        static constexpr T Tolerance = T(3) * (T(16) * std::numeric_limits<T>::epsilon()) * (T(16) * std::numeric_limits<T>::epsilon());
+
+        static inline T Dot(const T (&left)[3], const T (&right)[3]) noexcept
+        {
+            return left[0] * right[0] + left[1] * right[1] + left[2] * right[2];
+        }
+
+        static inline void Cross(const T (&left)[3], const T (&right)[3], T (&result)[3]) noexcept
+        {
+            result[0] = left[1] * right[2] - left[2] * right[1];
+            result[1] = left[2] * right[0] - left[0] * right[2];
+            result[2] = left[0] * right[1] - left[1] * right[0];
+        }
+    };
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#ifndef PULSARION_MATH_DECOMPOSE_HPP
+#include "Decompose.hpp"
+#endif
+
+#include <immintrin.h>
+#include <limits>
+
+namespace Pulsarion::Math
+{
+    // Every column of the 3x3 part is a register (with a zero w), so the norms are dpps, the cofactors are cross products,
+    // and a Newton step of the polar decomposition is 3 cross products and 6 multiply adds.
+    template<>
+    struct DecomposeFunctions<float>
+    {
+        static inline TRS<float> Decompose(const Matrix<4, 4, float>& matrix) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Decompose::Decompose");
+            const __m128 c0 = LoadColumn(&matrix[0].x());
+            const __m128 c1 = LoadColumn(&matrix[1].x());
+            const __m128 c2 = LoadColumn(&matrix[2].x());
+
+            TRS<float> result;
+            _mm_store_ps(&result.translation.x(), LoadColumn(&matrix[3].x()));
+
+            __m128 scale = _mm_sqrt_ps(_mm_or_ps(_mm_or_ps(_mm_dp_ps(c0, c0, 0x71), _mm_dp_ps(c1, c1, 0x72)), _mm_dp_ps(c2, c2, 0x74)));
+            // A mirroring matrix gets a negative x scale
+            const __m128 determinant = _mm_dp_ps(c0, Cross(c1, c2), 0x7F);
+            scale = _mm_xor_ps(scale, _mm_and_ps(_mm_cmplt_ps(determinant, _mm_setzero_ps()), _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f)));
+            _mm_store_ps(&result.scale.x(), scale);
+
+            // A zero scale leaves a zero column instead of NaN
+            const __m128 inverse = _mm_andnot_ps(_mm_cmpeq_ps(scale, _mm_setzero_ps()), _mm_div_ps(_mm_set1_ps(1.0f), scale));
+            PULSARION_MATH_ALIGN float columns[3][4];
+            _mm_store_ps(columns[0], _mm_mul_ps(c0, _mm_shuffle_ps(inverse, inverse, _MM_SHUFFLE(0, 0, 0, 0))));
+            _mm_store_ps(columns[1], _mm_mul_ps(c1, _mm_shuffle_ps(inverse, inverse, _MM_SHUFFLE(1, 1, 1, 1))));
+            _mm_store_ps(columns[2], _mm_mul_ps(c2, _mm_shuffle_ps(inverse, inverse, _MM_SHUFFLE(2, 2, 2, 2))));
+            const float rotation[3][3] = {
+                { columns[0][0], columns[1][0], columns[2][0] },
+                { columns[0][1], columns[1][1], columns[2][1] },
+                { columns[0][2], columns[1][2], columns[2][2] },
+            };
+            result.rotation = Detail::QuaternionFromRotation<float>(rotation);
+            return result;
+        }
+
+        static inline PolarDecomposition<float> PolarDecompose(const Matrix<3, 3, float>& matrix, std::size_t maxIterations) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Decompose::PolarDecompose");
+            const __m128 m0 = LoadColumn(&matrix[0].x());
+            const __m128 m1 = LoadColumn(&matrix[1].x());
+            const __m128 m2 = LoadColumn(&matrix[2].x());
+            const __m128 ones = _mm_set1_ps(1.0f);
+            const __m128 half = _mm_set1_ps(0.5f);
+
+            __m128 q0 = m0, q1 = m1, q2 = m2;
+            for (std::size_t iteration = 0; iteration < maxIterations; ++iteration)
+            {
+                // R^-T = cofactor / determinant
+                const __m128 cofactor0 = Cross(q1, q2);
+                const __m128 cofactor1 = Cross(q2, q0);
+                const __m128 cofactor2 = Cross(q0, q1);
+                const __m128 determinant = _mm_dp_ps(q0, cofactor0, 0x7F);
+                if (_mm_cvtss_f32(determinant) == 0.0f)
+                    break;
+
+                // g = sqrt(|R^-1| / |R|) in the Frobenius norm
+                const __m128 norm = _mm_dp_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(q0, q0), _mm_mul_ps(q1, q1)), _mm_mul_ps(q2, q2)), ones, 0x7F);
+                const __m128 cofactorNorm = _mm_dp_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(cofactor0, cofactor0), _mm_mul_ps(cofactor1, cofactor1)), _mm_mul_ps(cofactor2, cofactor2)), ones, 0x7F);
+                const __m128 gamma = _mm_sqrt_ps(_mm_sqrt_ps(_mm_div_ps(cofactorNorm, _mm_mul_ps(norm, _mm_mul_ps(determinant, determinant)))));
+                const __m128 left = _mm_mul_ps(half, gamma);
+                const __m128 right = _mm_div_ps(half, _mm_mul_ps(gamma, determinant));
+
+                const __m128 next0 = _mm_add_ps(_mm_mul_ps(left, q0), _mm_mul_ps(right, cofactor0));
+                const __m128 next1 = _mm_add_ps(_mm_mul_ps(left, q1), _mm_mul_ps(right, cofactor1));
+                const __m128 next2 = _mm_add_ps(_mm_mul_ps(left, q2), _mm_mul_ps(right, cofactor2));
+                const __m128 d0 = _mm_sub_ps(next0, q0), d1 = _mm_sub_ps(next1, q1), d2 = _mm_sub_ps(next2, q2);
+                const __m128 change = _mm_dp_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(d0, d0), _mm_mul_ps(d1, d1)), _mm_mul_ps(d2, d2)), ones, 0x7F);
+                q0 = next0;
+                q1 = next1;
+                q2 = next2;
+                if (_mm_cvtss_f32(change) <= Tolerance)
+                    break;
+            }
+
+            PolarDecomposition<float> result;
+            _mm_store_ps(&result.rotation[0].x(), q0);
+            _mm_store_ps(&result.rotation[1].x(), q1);
+            _mm_store_ps(&result.rotation[2].x(), q2);
+
+            // S = R^T * M, column j is (q0 . mj, q1 . mj, q2 . mj), averaged with its transpose
+            __m128 s0 = StretchColumn(q0, q1, q2, m0);
+            __m128 s1 = StretchColumn(q0, q1, q2, m1);
+            __m128 s2 = StretchColumn(q0, q1, q2, m2);
+            __m128 s3 = _mm_setzero_ps();
+            const __m128 t0 = s0, t1 = s1, t2 = s2;
+            _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+            _mm_store_ps(&result.stretch[0].x(), _mm_mul_ps(half, _mm_add_ps(t0, s0)));
+            _mm_store_ps(&result.stretch[1].x(), _mm_mul_ps(half, _mm_add_ps(t1, s1)));
+            _mm_store_ps(&result.stretch[2].x(), _mm_mul_ps(half, _mm_add_ps(t2, s2)));
+            return result;
+        }
+
+    private:
+        static constexpr float Tolerance = 3.0f * (16.0f * std::numeric_limits<float>::epsilon()) * (16.0f * std::numeric_limits<float>::epsilon());
+
+        // x y z 0, the fourth lane of a column is either padding or the last row, neither of which is part of the 3x3 part
+        static inline __m128 LoadColumn(const float* column) noexcept
+        {
+            return _mm_blend_ps(_mm_load_ps(column), _mm_setzero_ps(), 0x8);
+        }
+
+        static inline __m128 Cross(__m128 left, __m128 right) noexcept
+        {
+            const __m128 leftYZX = _mm_shuffle_ps(left, left, _MM_SHUFFLE(3, 0, 2, 1));
+            const __m128 rightYZX = _mm_shuffle_ps(right, right, _MM_SHUFFLE(3, 0, 2, 1));
+            const __m128 result = _mm_sub_ps(_mm_mul_ps(left, rightYZX), _mm_mul_ps(leftYZX, right));
+            return _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 0, 2, 1));
+        }
+
+        static inline __m128 StretchColumn(__m128 q0, __m128 q1, __m128 q2, __m128 column) noexcept
+        {
+            return _mm_or_ps(_mm_or_ps(_mm_dp_ps(q0, column, 0x71), _mm_dp_ps(q1, column, 0x72)), _mm_dp_ps(q2, column, 0x74));
+        }
+    };
+}
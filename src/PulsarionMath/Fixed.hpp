@@ -0,0 +1,308 @@
+#pragma once
+#define PULSARION_MATH_FIXED_HPP
+
+#include "Core.hpp"
+#include "Vector.hpp"
+#include "Matrix.hpp"
+
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// Fixed point scalars, Q16.16 (Fixed16_16) and Q32.32 (Fixed32_32), usable as the T of Vector and Matrix.
+// Every operation is defined on the integers, so the results are bit identical on every compiler, machine and SIMD backend,
+// which is what a lockstep simulation needs to only exchange inputs:
+//  - addition, subtraction and negation wrap around (two's complement)
+//  - multiplication rounds toward negative infinity, the full product is shifted right by the fraction bits
+//  - division rounds toward zero, a division by zero saturates to the largest value of the sign of the numerator (0 / 0 is 0)
+//  - integers convert exactly (and wrap if they don't fit), floating point values are rounded to the nearest, ties away from zero
+namespace Pulsarion::Math
+{
+    namespace Detail
+    {
+        // (a * b) >> F with the full 128 bit product, truncated to 64 bits, from 32 bit halves
+        template<std::size_t F>
+        inline constexpr std::int64_t MultiplyShiftPortable(std::int64_t a, std::int64_t b) noexcept
+        {
+            const auto ua = static_cast<std::uint64_t>(a), ub = static_cast<std::uint64_t>(b);
+            const std::uint64_t a0 = ua & 0xFFFFFFFFu, a1 = ua >> 32, b0 = ub & 0xFFFFFFFFu, b1 = ub >> 32;
+            const std::uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+            const std::uint64_t middle = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+            const std::uint64_t low = (middle << 32) | (p00 & 0xFFFFFFFFu);
+            std::uint64_t high = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+            // The unsigned product to the signed one
+            if (a < 0)
+                high -= ub;
+            if (b < 0)
+                high -= ua;
+            return static_cast<std::int64_t>((low >> F) | (high << (64 - F)));
+        }
+
+        // (a << F) / b with a 128 bit numerator, rounded toward zero and truncated to 64 bits, b isn't 0. Long division of the magnitudes, a bit at a time
+        template<std::size_t F>
+        inline constexpr std::int64_t ShiftDividePortable(std::int64_t a, std::int64_t b) noexcept
+        {
+            const std::uint64_t numerator = a < 0 ? 0 - static_cast<std::uint64_t>(a) : static_cast<std::uint64_t>(a);
+            const std::uint64_t denominator = b < 0 ? 0 - static_cast<std::uint64_t>(b) : static_cast<std::uint64_t>(b);
+            const std::uint64_t high = numerator >> (64 - F), low = numerator << F;
+            std::uint64_t quotient = 0, remainder = 0;
+            for (std::size_t bit = 128; bit-- > 0;)
+            {
+                remainder = (remainder << 1) | ((bit >= 64 ? high >> (bit - 64) : low >> bit) & 1);
+                quotient <<= 1;
+                if (remainder >= denominator)
+                {
+                    remainder -= denominator;
+                    quotient |= 1;
+                }
+            }
+            return static_cast<std::int64_t>((a < 0) != (b < 0) ? 0 - quotient : quotient);
+        }
+
+#ifdef __SIZEOF_INT128__
+        // A GCC / Clang extension, __extension__ keeps -Wpedantic quiet about it
+        __extension__ typedef __int128 Int128;
+#endif
+
+        // The same results with the compiler's 128 bit integers, where there are any
+        template<std::size_t F>
+        inline constexpr std::int64_t MultiplyShift(std::int64_t a, std::int64_t b) noexcept
+        {
+#ifdef __SIZEOF_INT128__
+            return static_cast<std::int64_t>((static_cast<Int128>(a) * b) >> F);
+#else
+            return MultiplyShiftPortable<F>(a, b);
+#endif
+        }
+
+        template<std::size_t F>
+        inline constexpr std::int64_t ShiftDivide(std::int64_t a, std::int64_t b) noexcept
+        {
+#ifdef __SIZEOF_INT128__
+            return static_cast<std::int64_t>((static_cast<Int128>(a) << F) / b);
+#else
+            return ShiftDividePortable<F>(a, b);
+#endif
+        }
+    }
+
+    template<std::size_t F, std::signed_integral S>
+    requires ((std::same_as<S, std::int32_t> || std::same_as<S, std::int64_t>) && F > 0 && F < sizeof(S) * 8 - 1)
+    class Fixed
+    {
+        using Unsigned = std::make_unsigned_t<S>;
+
+    public:
+        using Storage = S;
+        static constexpr std::size_t FractionBits = F;
+        static constexpr S One = S(1) << F;
+
+        inline constexpr Fixed() noexcept = default;
+
+        // Implicit, so literals like 0 and 1 work where a T is expected (e.g. the identity matrix)
+        template<std::integral I>
+        inline constexpr Fixed(I value) noexcept : m_Raw(static_cast<S>(static_cast<Unsigned>(value) << F)) {}
+
+        // The value has to fit in the integer part
+        template<FloatingPoint_t T>
+        explicit inline constexpr Fixed(T value) noexcept
+        {
+            const T scaled = value * static_cast<T>(One);
+            auto raw = static_cast<S>(scaled);
+            const T fraction = scaled - static_cast<T>(raw); // Exact
+            if (fraction >= T(0.5))
+                ++raw;
+            else if (fraction <= T(-0.5))
+                --raw;
+            m_Raw = raw;
+        }
+
+        [[nodiscard]] static inline constexpr Fixed FromRaw(S raw) noexcept
+        {
+            Fixed result;
+            result.m_Raw = raw;
+            return result;
+        }
+
+        [[nodiscard]] static inline constexpr Fixed Max() noexcept { return FromRaw(std::numeric_limits<S>::max()); }
+        [[nodiscard]] static inline constexpr Fixed Lowest() noexcept { return FromRaw(std::numeric_limits<S>::min()); }
+        [[nodiscard]] static inline constexpr Fixed Epsilon() noexcept { return FromRaw(1); }
+
+        [[nodiscard]] inline constexpr S Raw() const noexcept { return m_Raw; }
+
+        template<FloatingPoint_t T>
+        explicit inline constexpr operator T() const noexcept { return static_cast<T>(m_Raw) / static_cast<T>(One); }
+
+        // Rounds toward negative infinity
+        template<std::integral I>
+        requires (!std::same_as<I, bool>)
+        explicit inline constexpr operator I() const noexcept { return static_cast<I>(m_Raw >> F); }
+
+        // ---- Arithmetic operators ----
+        inline constexpr Fixed operator+() const noexcept { return *this; }
+        inline constexpr Fixed operator-() const noexcept { return FromRaw(static_cast<S>(Unsigned(0) - static_cast<Unsigned>(m_Raw))); }
+
+        friend inline constexpr Fixed operator+(Fixed left, Fixed right) noexcept
+        {
+            return FromRaw(static_cast<S>(static_cast<Unsigned>(left.m_Raw) + static_cast<Unsigned>(right.m_Raw)));
+        }
+
+        friend inline constexpr Fixed operator-(Fixed left, Fixed right) noexcept
+        {
+            return FromRaw(static_cast<S>(static_cast<Unsigned>(left.m_Raw) - static_cast<Unsigned>(right.m_Raw)));
+        }
+
+        friend inline constexpr Fixed operator*(Fixed left, Fixed right) noexcept
+        {
+            if constexpr (sizeof(S) == 4)
+                return FromRaw(static_cast<S>((static_cast<std::int64_t>(left.m_Raw) * right.m_Raw) >> F));
+            else
+                return FromRaw(Detail::MultiplyShift<F>(left.m_Raw, right.m_Raw));
+        }
+
+        friend inline constexpr Fixed operator/(Fixed left, Fixed right) noexcept
+        {
+            if (right.m_Raw == 0)
+                return left.m_Raw > 0 ? Max() : left.m_Raw < 0 ? Lowest() : Fixed();
+            if constexpr (sizeof(S) == 4)
+                return FromRaw(static_cast<S>((static_cast<std::int64_t>(left.m_Raw) * One) / right.m_Raw));
+            else
+                return FromRaw(Detail::ShiftDivide<F>(left.m_Raw, right.m_Raw));
+        }
+
+        inline constexpr Fixed& operator+=(Fixed other) noexcept { return *this = *this + other; }
+        inline constexpr Fixed& operator-=(Fixed other) noexcept { return *this = *this - other; }
+        inline constexpr Fixed& operator*=(Fixed other) noexcept { return *this = *this * other; }
+        inline constexpr Fixed& operator/=(Fixed other) noexcept { return *this = *this / other; }
+
+        // ---- Comparison operators ----
+        friend inline constexpr bool operator==(Fixed left, Fixed right) noexcept { return left.m_Raw == right.m_Raw; }
+        friend inline constexpr std::strong_ordering operator<=>(Fixed left, Fixed right) noexcept { return left.m_Raw <=> right.m_Raw; }
+
+    private:
+        S m_Raw = 0;
+    };
+
+    using Fixed16_16 = Fixed<16, std::int32_t>;
+    using Fixed32_32 = Fixed<32, std::int64_t>;
+
+    template<std::size_t F, std::signed_integral S>
+    struct IsArithmetic<Fixed<F, S>> : std::true_type {};
+
+    template<std::size_t F, std::signed_integral S>
+    [[nodiscard]] inline constexpr Fixed<F, S> Abs(Fixed<F, S> value) noexcept
+    {
+        return value < Fixed<F, S>() ? -value : value;
+    }
+
+    // Rounded toward zero, the square root of a negative value is 0. Digit by digit, two bits of the radicand raw << F at a time,
+    // so the radicand is never formed (it doesn't fit in S) and the remainder stays below twice the root.
+    template<std::size_t F, std::signed_integral S>
+    requires (F % 2 == 0)
+    [[nodiscard]] inline constexpr Fixed<F, S> Sqrt(Fixed<F, S> value) noexcept
+    {
+        if (value.Raw() <= 0)
+            return Fixed<F, S>();
+        const auto raw = static_cast<std::uint64_t>(value.Raw());
+        std::uint64_t root = 0, remainder = 0;
+        for (std::size_t pair = (sizeof(S) * 8 + F) / 2; pair-- > 0;)
+        {
+            const std::size_t bit = 2 * pair;
+            remainder = (remainder << 2) | (bit >= F ? (raw >> (bit - F)) & 3 : 0);
+            const std::uint64_t trial = (root << 2) | 1;
+            root <<= 1;
+            if (remainder >= trial)
+            {
+                remainder -= trial;
+                root |= 1;
+            }
+        }
+        return Fixed<F, S>::FromRaw(static_cast<S>(root));
+    }
+
+    // The scalar kernels, with the same rounding as the SIMD ones
+    template<std::size_t F, std::signed_integral S, Qualifier Q>
+    struct FixedVectorFunctions
+    {
+        using V = Vector<4, Fixed<F, S>, Q>;
+
+        static inline constexpr V negate(const V& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::negate");
+            return V{ -vector.x(), -vector.y(), -vector.z(), -vector.w() };
+        }
+
+        static inline constexpr V add(const V& left, const V& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::add");
+            return V{ left.x() + right.x(), left.y() + right.y(), left.z() + right.z(), left.w() + right.w() };
+        }
+
+        static inline constexpr V subtract(const V& left, const V& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::subtract");
+            return V{ left.x() - right.x(), left.y() - right.y(), left.z() - right.z(), left.w() - right.w() };
+        }
+
+        static inline constexpr V multiply(const V& left, const V& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::multiply");
+            return V{ left.x() * right.x(), left.y() * right.y(), left.z() * right.z(), left.w() * right.w() };
+        }
+
+        static inline constexpr V divide(const V& left, const V& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::divide");
+            return V{ left.x() / right.x(), left.y() / right.y(), left.z() / right.z(), left.w() / right.w() };
+        }
+
+        static inline constexpr V multiplyScale(const V& vector, Fixed<F, S> scalar) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::multiplyScale");
+            return V{ vector.x() * scalar, vector.y() * scalar, vector.z() * scalar, vector.w() * scalar };
+        }
+
+        static inline constexpr V divideScale(const V& vector, Fixed<F, S> scalar) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::divideScale");
+            return V{ vector.x() / scalar, vector.y() / scalar, vector.z() / scalar, vector.w() / scalar };
+        }
+
+        static inline constexpr bool equal(const V& left, const V& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::equal");
+            return left.x() == right.x() && left.y() == right.y() && left.z() == right.z() && left.w() == right.w();
+        }
+
+        static inline constexpr bool notEqual(const V& left, const V& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::notEqual");
+            return !equal(left, right);
+        }
+
+        // Every product is rounded on its own, the sum is exact (or wraps), so the order doesn't matter
+        static inline constexpr Fixed<F, S> dot(const V& left, const V& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::dot");
+            return left.x() * right.x() + left.y() * right.y() + left.z() * right.z() + left.w() * right.w();
+        }
+
+        static inline constexpr Fixed<F, S> lengthSquared(const V& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::lengthSquared");
+            return dot(vector, vector);
+        }
+    };
+
+    template<std::size_t F, std::signed_integral S>
+    struct VectorFunctions<4, Fixed<F, S>, Qualifier::Aligned> : FixedVectorFunctions<F, S, Qualifier::Aligned> {};
+
+    template<std::size_t F, std::signed_integral S>
+    struct VectorFunctions<4, Fixed<F, S>, Qualifier::Packed> : FixedVectorFunctions<F, S, Qualifier::Packed> {};
+}
+
+#if defined(PULSARION_MATH_SIMD_SSE4_1) && defined(PULSARION_MATH_MATRIX_COLUMN_MAJOR)
+#include "FixedSSE.hpp"
+#endif
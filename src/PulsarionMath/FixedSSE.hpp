@@ -0,0 +1,155 @@
+#pragma once
+
+#ifndef PULSARION_MATH_FIXED_HPP
+#include "Fixed.hpp"
+#endif
+
+#include <cstdint>
+#include <immintrin.h>
+
+namespace Pulsarion::Math
+{
+    namespace Detail
+    {
+        // The Q16.16 products of the 4 lanes: pmuldq multiplies lanes 0 and 2 (and, shifted down, 1 and 3) into 64 bit products,
+        // bits 16 to 47 of which are the results, exactly what the scalar multiplication keeps
+        inline __m128i MultiplyFixed16_16(__m128i left, __m128i right) noexcept
+        {
+            const __m128i even = _mm_srli_epi64(_mm_mul_epi32(left, right), 16);
+            const __m128i odd = _mm_slli_epi64(_mm_mul_epi32(_mm_srli_epi64(left, 32), _mm_srli_epi64(right, 32)), 16);
+            return _mm_blend_epi16(even, odd, 0xCC);
+        }
+
+        inline std::int32_t HorizontalSumFixed16_16(__m128i value) noexcept
+        {
+            value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2)));
+            value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(2, 3, 0, 1)));
+            return _mm_cvtsi128_si32(value);
+        }
+    }
+
+    // Wrapping integer additions and the multiplication above, there is no SIMD integer division, so divisions stay scalar
+    template<Qualifier Q>
+    struct FixedVectorFunctionsSSE : FixedVectorFunctions<16, std::int32_t, Q>
+    {
+        using V = Vector<4, Fixed16_16, Q>;
+
+        static inline V negate(const V& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::negate");
+            return Store(_mm_sub_epi32(_mm_setzero_si128(), Load(vector)));
+        }
+
+        static inline V add(const V& left, const V& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::add");
+            return Store(_mm_add_epi32(Load(left), Load(right)));
+        }
+
+        static inline V subtract(const V& left, const V& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::subtract");
+            return Store(_mm_sub_epi32(Load(left), Load(right)));
+        }
+
+        static inline V multiply(const V& left, const V& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::multiply");
+            return Store(Detail::MultiplyFixed16_16(Load(left), Load(right)));
+        }
+
+        static inline V multiplyScale(const V& vector, Fixed16_16 scalar) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::multiplyScale");
+            return Store(Detail::MultiplyFixed16_16(Load(vector), _mm_set1_epi32(scalar.Raw())));
+        }
+
+        static inline bool equal(const V& left, const V& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::equal");
+            return _mm_movemask_epi8(_mm_cmpeq_epi32(Load(left), Load(right))) == 0xFFFF;
+        }
+
+        static inline bool notEqual(const V& left, const V& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::notEqual");
+            return _mm_movemask_epi8(_mm_cmpeq_epi32(Load(left), Load(right))) != 0xFFFF;
+        }
+
+        static inline Fixed16_16 dot(const V& left, const V& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::dot");
+            return Fixed16_16::FromRaw(Detail::HorizontalSumFixed16_16(Detail::MultiplyFixed16_16(Load(left), Load(right))));
+        }
+
+        static inline Fixed16_16 lengthSquared(const V& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Fixed::lengthSquared");
+            const __m128i value = Load(vector);
+            return Fixed16_16::FromRaw(Detail::HorizontalSumFixed16_16(Detail::MultiplyFixed16_16(value, value)));
+        }
+
+    private:
+        static inline __m128i Load(const V& vector) noexcept
+        {
+            if constexpr (Q == Qualifier::Aligned)
+                return _mm_load_si128(reinterpret_cast<const __m128i*>(&vector.x()));
+            else
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(&vector.x()));
+        }
+
+        static inline V Store(__m128i value) noexcept
+        {
+            V result;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&result.x()), value);
+            return result;
+        }
+    };
+
+    template<>
+    struct VectorFunctions<4, Fixed16_16, Qualifier::Aligned> : FixedVectorFunctionsSSE<Qualifier::Aligned> {};
+
+    template<>
+    struct VectorFunctions<4, Fixed16_16, Qualifier::Packed> : FixedVectorFunctionsSSE<Qualifier::Packed> {};
+
+    // Column j of the product is the sum of the columns of left times the elements of column j of right, broadcast with pshufd
+    template<>
+    struct MatrixFunctions<4, 4, Fixed16_16> : GenericMatrixFunctions<4, 4, Fixed16_16>
+    {
+        using GenericMatrixFunctions<4, 4, Fixed16_16>::Multiply; // Rectangular multiplication
+
+        static inline Matrix<4, 4, Fixed16_16> Multiply(const Matrix<4, 4, Fixed16_16>& left, const Matrix<4, 4, Fixed16_16>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix4x4Fixed::Multiply");
+            const __m128i l0 = LoadColumn(left, 0), l1 = LoadColumn(left, 1), l2 = LoadColumn(left, 2), l3 = LoadColumn(left, 3);
+            Matrix<4, 4, Fixed16_16> result;
+            for (std::size_t column = 0; column < 4; ++column)
+                _mm_store_si128(reinterpret_cast<__m128i*>(&result[column].x()), Column(l0, l1, l2, l3, LoadColumn(right, column)));
+            return result;
+        }
+
+        static inline Vector<4, Fixed16_16, Qualifier::Aligned> VecMultiply(const Matrix<4, 4, Fixed16_16>& left, const Vector<4, Fixed16_16, Qualifier::Aligned>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix4x4Fixed::VecMultiply");
+            Vector<4, Fixed16_16, Qualifier::Aligned> result;
+            const __m128i vector = _mm_load_si128(reinterpret_cast<const __m128i*>(&right.x()));
+            _mm_store_si128(reinterpret_cast<__m128i*>(&result.x()), Column(LoadColumn(left, 0), LoadColumn(left, 1), LoadColumn(left, 2), LoadColumn(left, 3), vector));
+            return result;
+        }
+
+    private:
+        static inline __m128i LoadColumn(const Matrix<4, 4, Fixed16_16>& matrix, std::size_t column) noexcept
+        {
+            return _mm_load_si128(reinterpret_cast<const __m128i*>(&matrix[column].x()));
+        }
+
+        static inline __m128i Column(__m128i l0, __m128i l1, __m128i l2, __m128i l3, __m128i column) noexcept
+        {
+            const __m128i p0 = Detail::MultiplyFixed16_16(l0, _mm_shuffle_epi32(column, _MM_SHUFFLE(0, 0, 0, 0)));
+            const __m128i p1 = Detail::MultiplyFixed16_16(l1, _mm_shuffle_epi32(column, _MM_SHUFFLE(1, 1, 1, 1)));
+            const __m128i p2 = Detail::MultiplyFixed16_16(l2, _mm_shuffle_epi32(column, _MM_SHUFFLE(2, 2, 2, 2)));
+            const __m128i p3 = Detail::MultiplyFixed16_16(l3, _mm_shuffle_epi32(column, _MM_SHUFFLE(3, 3, 3, 3)));
+            return _mm_add_epi32(_mm_add_epi32(p0, p1), _mm_add_epi32(p2, p3));
+        }
+    };
+}
@@ -0,0 +1,398 @@
+#pragma once
+
+#include "Vector.hpp"
+#include "Swizzle.hpp"
+#include "Collision.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+// GJK intersection tests and EPA penetration depth for convex shapes given by a support function, the point of the shape farthest along a direction.
+// Both work on the Minkowski difference A - B, whose support is A.Support(d) - B.Support(-d): the shapes intersect when it contains the origin,
+// and the penetration is the distance from the origin to its boundary. Moving B by normal * depth separates the shapes (the normal points from A to B).
+// Points are 4 component vectors with a w of 1, so the w of the differences (and of every direction) is 0, and the SIMD dot products and swizzle based
+// cross products of the Vector class work on the xyz. Touching shapes intersect, with a depth of 0.
+namespace Pulsarion::Math
+{
+    template<typename S>
+    concept SupportShape = requires(const S& shape, const Vector<4, float, Qualifier::Aligned>& direction) {
+        { shape.Support(direction) } -> std::convertible_to<Vector<4, float, Qualifier::Aligned>>;
+    };
+
+    struct SphereShape
+    {
+        Vector<4, float, Qualifier::Aligned> center;
+        float radius;
+
+        [[nodiscard]] inline Vector<4, float, Qualifier::Aligned> Support(const Vector<4, float, Qualifier::Aligned>& direction) const noexcept
+        {
+            const float lengthSquared = direction.LengthSquared();
+            return lengthSquared > 0.0f ? center + direction * (radius / std::sqrt(lengthSquared)) : center;
+        }
+    };
+
+    struct OBBShape
+    {
+        OBB<float> box;
+
+        [[nodiscard]] inline Vector<4, float, Qualifier::Aligned> Support(const Vector<4, float, Qualifier::Aligned>& direction) const noexcept
+        {
+            Vector<4, float, Qualifier::Aligned> result(box.center[0], box.center[1], box.center[2], 1.0f);
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                const auto& u = box.axes[axis];
+                const float extent = u[0] * direction[0] + u[1] * direction[1] + u[2] * direction[2] >= 0.0f ? box.halfExtents[axis] : -box.halfExtents[axis];
+                result += Vector<4, float, Qualifier::Aligned>(u[0], u[1], u[2], 0.0f) * extent;
+            }
+            return result;
+        }
+    };
+
+    // The convex hull of the points, the support is a linear search, fine for hulls of a few dozen points
+    struct PointCloudShape
+    {
+        std::span<const Vector<4, float, Qualifier::Aligned>> points;
+
+        [[nodiscard]] inline Vector<4, float, Qualifier::Aligned> Support(const Vector<4, float, Qualifier::Aligned>& direction) const noexcept
+        {
+            std::size_t best = 0;
+            float bestDistance = points[0].Dot(direction);
+            for (std::size_t i = 1; i < points.size(); ++i)
+            {
+                const float distance = points[i].Dot(direction);
+                if (distance > bestDistance)
+                {
+                    best = i;
+                    bestDistance = distance;
+                }
+            }
+            return points[best];
+        }
+    };
+
+    struct Penetration
+    {
+        bool intersecting = false;
+        float depth = 0.0f;
+        Vector<4, float, Qualifier::Aligned> normal; // Unit length, from A to B, zero when not intersecting
+    };
+
+    namespace Detail
+    {
+        using GjkVector = Vector<4, float, Qualifier::Aligned>;
+
+        inline GjkVector Cross(const GjkVector& left, const GjkVector& right) noexcept
+        {
+            return YZXW(left) * ZXYW(right) - ZXYW(left) * YZXW(right);
+        }
+
+        template<SupportShape A, SupportShape B>
+        inline GjkVector MinkowskiSupport(const A& a, const B& b, const GjkVector& direction) noexcept
+        {
+            return a.Support(direction) - b.Support(-direction);
+        }
+
+        // The newest point first
+        struct GjkSimplex
+        {
+            GjkVector points[4];
+            std::size_t size = 0;
+
+            inline void PushFront(const GjkVector& point) noexcept
+            {
+                for (std::size_t i = size; i > 0; --i)
+                    points[i] = points[i - 1];
+                points[0] = point;
+                ++size;
+            }
+
+            inline void Assign(const GjkVector& a) noexcept { points[0] = a; size = 1; }
+            inline void Assign(const GjkVector& a, const GjkVector& b) noexcept { points[0] = a; points[1] = b; size = 2; }
+            inline void Assign(const GjkVector& a, const GjkVector& b, const GjkVector& c) noexcept { points[0] = a; points[1] = b; points[2] = c; size = 3; }
+        };
+
+        // Each case keeps the feature of the simplex closest to the origin and points the direction from it to the origin.
+        // Only the regions the newest point a can be closest in are checked, the others were ruled out by the previous iterations.
+        inline bool GjkLine(GjkSimplex& simplex, GjkVector& direction) noexcept
+        {
+            const GjkVector a = simplex.points[0], b = simplex.points[1];
+            const GjkVector ab = b - a, ao = -a;
+            if (ab.Dot(ao) > 0.0f)
+                direction = Cross(Cross(ab, ao), ab);
+            else
+            {
+                simplex.Assign(a);
+                direction = ao;
+            }
+            return false;
+        }
+
+        inline bool GjkTriangle(GjkSimplex& simplex, GjkVector& direction) noexcept
+        {
+            const GjkVector a = simplex.points[0], b = simplex.points[1], c = simplex.points[2];
+            const GjkVector ab = b - a, ac = c - a, ao = -a;
+            const GjkVector abc = Cross(ab, ac);
+            if (Cross(abc, ac).Dot(ao) > 0.0f)
+            {
+                if (ac.Dot(ao) > 0.0f)
+                {
+                    simplex.Assign(a, c);
+                    direction = Cross(Cross(ac, ao), ac);
+                    return false;
+                }
+                simplex.Assign(a, b);
+                return GjkLine(simplex, direction);
+            }
+            if (Cross(ab, abc).Dot(ao) > 0.0f)
+            {
+                simplex.Assign(a, b);
+                return GjkLine(simplex, direction);
+            }
+            // Above or below the triangle, wound so that the origin is on the side of its normal
+            if (abc.Dot(ao) > 0.0f)
+                direction = abc;
+            else
+            {
+                simplex.Assign(a, c, b);
+                direction = -abc;
+            }
+            return false;
+        }
+
+        inline bool GjkTetrahedron(GjkSimplex& simplex, GjkVector& direction) noexcept
+        {
+            const GjkVector a = simplex.points[0], b = simplex.points[1], c = simplex.points[2], d = simplex.points[3];
+            const GjkVector ab = b - a, ac = c - a, ad = d - a, ao = -a;
+            if (Cross(ab, ac).Dot(ao) > 0.0f)
+            {
+                simplex.Assign(a, b, c);
+                return GjkTriangle(simplex, direction);
+            }
+            if (Cross(ac, ad).Dot(ao) > 0.0f)
+            {
+                simplex.Assign(a, c, d);
+                return GjkTriangle(simplex, direction);
+            }
+            if (Cross(ad, ab).Dot(ao) > 0.0f)
+            {
+                simplex.Assign(a, d, b);
+                return GjkTriangle(simplex, direction);
+            }
+            return true;
+        }
+
+        // True when the shapes intersect, the simplex then contains the origin (or touches it, with fewer than 4 points)
+        template<SupportShape A, SupportShape B>
+        inline bool Gjk(const A& a, const B& b, GjkSimplex& simplex) noexcept
+        {
+            GjkVector direction(1.0f, 0.0f, 0.0f, 0.0f);
+            simplex.Assign(MinkowskiSupport(a, b, direction));
+            direction = -simplex.points[0];
+            for (std::size_t iteration = 0; iteration < CollisionConstants::GjkMaxIterations; ++iteration)
+            {
+                // The origin is on the simplex
+                if (direction.LengthSquared() == 0.0f)
+                    return true;
+                const GjkVector support = MinkowskiSupport(a, b, direction);
+                if (support.Dot(direction) < 0.0f)
+                    return false;
+                simplex.PushFront(support);
+                const bool contained = simplex.size == 2 ? GjkLine(simplex, direction) : simplex.size == 3 ? GjkTriangle(simplex, direction) : GjkTetrahedron(simplex, direction);
+                if (contained)
+                    return true;
+            }
+            return false;
+        }
+
+        // Adds points to a simplex of touching shapes until it is a tetrahedron, false if the difference is flat in some direction
+        template<SupportShape A, SupportShape B>
+        inline bool CompleteSimplex(const A& a, const B& b, GjkSimplex& simplex) noexcept
+        {
+            constexpr float epsilon = 1e-6f;
+            const GjkVector axes[3] = { GjkVector(1.0f, 0.0f, 0.0f, 0.0f), GjkVector(0.0f, 1.0f, 0.0f, 0.0f), GjkVector(0.0f, 0.0f, 1.0f, 0.0f) };
+            const auto tryDirection = [&](const GjkVector& direction, auto&& accept) {
+                for (const GjkVector& candidate : { direction, -direction })
+                {
+                    const GjkVector support = MinkowskiSupport(a, b, candidate);
+                    if (accept(support))
+                    {
+                        simplex.points[simplex.size++] = support;
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            if (simplex.size == 1)
+            {
+                const auto apart = [&](const GjkVector& point) { return (point - simplex.points[0]).LengthSquared() > epsilon; };
+                if (!tryDirection(axes[0], apart) && !tryDirection(axes[1], apart) && !tryDirection(axes[2], apart))
+                    return false;
+            }
+            if (simplex.size == 2)
+            {
+                const GjkVector line = simplex.points[1] - simplex.points[0];
+                std::size_t smallest = 0;
+                for (std::size_t axis = 1; axis < 3; ++axis)
+                    if (std::abs(line[axis]) < std::abs(line[smallest]))
+                        smallest = axis;
+                const GjkVector first = Cross(line, axes[smallest]);
+                const GjkVector second = Cross(line, first);
+                const auto offLine = [&](const GjkVector& point) { return Cross(point - simplex.points[0], line).LengthSquared() > epsilon * line.LengthSquared(); };
+                if (!tryDirection(first, offLine) && !tryDirection(second, offLine))
+                    return false;
+            }
+            if (simplex.size == 3)
+            {
+                const GjkVector normal = Cross(simplex.points[1] - simplex.points[0], simplex.points[2] - simplex.points[0]);
+                const auto offPlane = [&](const GjkVector& point) {
+                    const float distance = (point - simplex.points[0]).Dot(normal);
+                    return distance * distance > epsilon * normal.LengthSquared();
+                };
+                if (!tryDirection(normal, offPlane))
+                    return false;
+            }
+            return true;
+        }
+
+        struct EpaFace
+        {
+            std::size_t indices[3];
+            GjkVector normal;
+            float distance;
+        };
+
+        // The unit normal of the winding, false for a degenerate face
+        inline bool MakeEpaFace(const GjkVector* vertices, std::size_t i0, std::size_t i1, std::size_t i2, EpaFace& face) noexcept
+        {
+            const GjkVector normal = Cross(vertices[i1] - vertices[i0], vertices[i2] - vertices[i0]);
+            const float lengthSquared = normal.LengthSquared();
+            if (!(lengthSquared > 0.0f))
+                return false;
+            face = { { i0, i1, i2 }, normal * (1.0f / std::sqrt(lengthSquared)), 0.0f };
+            face.distance = face.normal.Dot(vertices[i0]);
+            return true;
+        }
+
+        // Grows the polytope towards the closest face until the support along its normal adds nothing.
+        // The faces that see a new point are removed, and the edges of the hole (the ones of a single removed face) are joined to the point.
+        template<SupportShape A, SupportShape B>
+        inline Penetration Epa(const A& a, const B& b, const GjkSimplex& simplex) noexcept
+        {
+            GjkVector vertices[CollisionConstants::EpaMaxVertices];
+            EpaFace faces[CollisionConstants::EpaMaxFaces];
+            std::size_t vertexCount = 4, faceCount = 0;
+            for (std::size_t i = 0; i < 4; ++i)
+                vertices[i] = simplex.points[i];
+            // Wound to face away from the opposite vertex. Not from the origin, which can be on the tetrahedron for touching shapes.
+            // The faces added later keep the winding of the horizon edges
+            constexpr std::size_t tetrahedron[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+            for (const auto& face : tetrahedron)
+            {
+                if (!MakeEpaFace(vertices, face[0], face[1], face[2], faces[faceCount]))
+                    return { true, 0.0f, GjkVector(0.0f) };
+                if (faces[faceCount].normal.Dot(vertices[face[3]] - vertices[face[0]]) > 0.0f)
+                {
+                    std::swap(faces[faceCount].indices[1], faces[faceCount].indices[2]);
+                    faces[faceCount].normal = -faces[faceCount].normal;
+                    faces[faceCount].distance = -faces[faceCount].distance;
+                }
+                ++faceCount;
+            }
+
+            std::size_t closest = 0;
+            for (std::size_t iteration = 0; iteration < CollisionConstants::EpaMaxIterations; ++iteration)
+            {
+                closest = 0;
+                for (std::size_t f = 1; f < faceCount; ++f)
+                    if (faces[f].distance < faces[closest].distance)
+                        closest = f;
+
+                const GjkVector support = MinkowskiSupport(a, b, faces[closest].normal);
+                if (support.Dot(faces[closest].normal) - faces[closest].distance < CollisionConstants::EpaTolerance || vertexCount == CollisionConstants::EpaMaxVertices)
+                    break;
+                // The faces that see the point, and the horizon, their edges that aren't shared with another one of them
+                bool visible[CollisionConstants::EpaMaxFaces] = {};
+                std::size_t edges[CollisionConstants::EpaMaxFaces][2];
+                std::size_t edgeCount = 0, visibleCount = 0;
+                bool overflow = false;
+                for (std::size_t f = 0; f < faceCount; ++f)
+                {
+                    if (faces[f].normal.Dot(support - vertices[faces[f].indices[0]]) <= 0.0f)
+                        continue;
+                    visible[f] = true;
+                    ++visibleCount;
+                    for (std::size_t e = 0; e < 3; ++e)
+                    {
+                        const std::size_t from = faces[f].indices[e], to = faces[f].indices[(e + 1) % 3];
+                        std::size_t shared = 0;
+                        while (shared < edgeCount && !(edges[shared][0] == to && edges[shared][1] == from))
+                            ++shared;
+                        if (shared < edgeCount)
+                        {
+                            edges[shared][0] = edges[edgeCount - 1][0];
+                            edges[shared][1] = edges[edgeCount - 1][1];
+                            --edgeCount;
+                        }
+                        else if (edgeCount < CollisionConstants::EpaMaxFaces)
+                        {
+                            edges[edgeCount][0] = from;
+                            edges[edgeCount][1] = to;
+                            ++edgeCount;
+                        }
+                        else
+                            overflow = true;
+                    }
+                }
+                // Dropping a horizon edge or a new face would leave a hole, the polytope is kept as it is and its closest face is the result
+                if (overflow || faceCount - visibleCount + edgeCount > CollisionConstants::EpaMaxFaces)
+                    break;
+
+                const std::size_t added = vertexCount;
+                vertices[vertexCount++] = support;
+                std::size_t kept = 0;
+                for (std::size_t f = 0; f < faceCount; ++f)
+                    if (!visible[f])
+                        faces[kept++] = faces[f];
+                faceCount = kept;
+                for (std::size_t e = 0; e < edgeCount; ++e)
+                    if (MakeEpaFace(vertices, edges[e][0], edges[e][1], added, faces[faceCount]))
+                        ++faceCount;
+                if (faceCount == 0)
+                    return { true, 0.0f, GjkVector(0.0f) };
+            }
+
+            closest = 0;
+            for (std::size_t f = 1; f < faceCount; ++f)
+                if (faces[f].distance < faces[closest].distance)
+                    closest = f;
+            return { true, std::max(faces[closest].distance, 0.0f), faces[closest].normal };
+        }
+    }
+
+    template<SupportShape A, SupportShape B>
+    [[nodiscard]] inline bool GjkIntersects(const A& a, const B& b) noexcept
+    {
+        PULSARION_MATH_INSTRUMENT_KERNEL("Gjk::Intersects");
+        Detail::GjkSimplex simplex;
+        return Detail::Gjk(a, b, simplex);
+    }
+
+    // The depth is within CollisionConstants::EpaTolerance of the true one for polytopes. Curved shapes are approximated by the polytope built
+    // in CollisionConstants::EpaMaxIterations steps, the depth is then a few percent short for deep overlaps of spheres
+    template<SupportShape A, SupportShape B>
+    [[nodiscard]] inline Penetration GjkPenetration(const A& a, const B& b) noexcept
+    {
+        PULSARION_MATH_INSTRUMENT_KERNEL("Gjk::Penetration");
+        Detail::GjkSimplex simplex;
+        if (!Detail::Gjk(a, b, simplex))
+            return {};
+        if (simplex.size < 4 && !Detail::CompleteSimplex(a, b, simplex))
+            return { true, 0.0f, Detail::GjkVector(0.0f) };
+        return Detail::Epa(a, b, simplex);
+    }
+}
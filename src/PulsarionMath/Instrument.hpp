@@ -0,0 +1,260 @@
+#pragma once
+
+#include "Core.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#ifdef PULSARION_MATH_INSTRUMENT
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#endif
+
+// Opt-in counters for the kernels (VectorFunctions, MatrixFunctions, ...), enabled by defining PULSARION_MATH_INSTRUMENT.
+// Every kernel counts its calls and, while timing is enabled, the cycles spent in it (inclusive of the kernels it calls),
+// in counters owned by the calling thread. Snapshot() adds up the counters of every thread, including finished ones.
+// Without PULSARION_MATH_INSTRUMENT the kernels compile exactly as before and Snapshot() is empty.
+namespace Pulsarion::Math::Instrument
+{
+    struct KernelStats
+    {
+        std::string name;
+        std::uint64_t calls = 0;
+        std::uint64_t cycles = 0;
+    };
+
+#ifdef PULSARION_MATH_INSTRUMENT
+    // Kernels past this share the last counter
+    inline constexpr std::size_t MaxKernels = 512;
+
+    // Time stamp counter, or nanoseconds where there isn't one
+    inline std::uint64_t ReadCycles() noexcept
+    {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    // Only the owning thread writes, with a relaxed load and store instead of a locked add, other threads only read.
+    // So Reset can't zero it (the owner would store its old value over the zero), it records a baseline instead
+    struct Counter
+    {
+        std::atomic<std::uint64_t> calls{ 0 };
+        std::atomic<std::uint64_t> cycles{ 0 };
+
+        inline void Add(std::uint64_t elapsed) noexcept
+        {
+            calls.store(calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            cycles.store(cycles.load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+        }
+    };
+
+    class ThreadCounters;
+
+    class Registry
+    {
+    public:
+        static inline Registry& Get() noexcept
+        {
+            static Registry registry;
+            return registry;
+        }
+
+        // The same name always gets the same index, so every instantiation of a kernel template adds to one counter
+        inline std::size_t Register(const std::string& name)
+        {
+            std::lock_guard lock(m_Mutex);
+            auto it = std::find(m_Names.begin(), m_Names.end(), name);
+            if (it != m_Names.end())
+                return static_cast<std::size_t>(it - m_Names.begin());
+            if (m_Names.size() == MaxKernels - 1)
+                m_Names.emplace_back("(other kernels)");
+            if (m_Names.size() == MaxKernels)
+                return MaxKernels - 1;
+            m_Names.push_back(name);
+            return m_Names.size() - 1;
+        }
+
+        inline void Attach(ThreadCounters* counters)
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Threads.push_back(counters);
+        }
+
+        inline void Detach(ThreadCounters* counters);
+        inline std::vector<KernelStats> Snapshot();
+        inline void Reset();
+
+        std::atomic<bool> timing{ true };
+
+    private:
+        std::mutex m_Mutex;
+        std::vector<std::string> m_Names;
+        std::vector<ThreadCounters*> m_Threads;
+        // Counts of the threads that already exited
+        std::uint64_t m_RetiredCalls[MaxKernels] = {};
+        std::uint64_t m_RetiredCycles[MaxKernels] = {};
+    };
+
+    class ThreadCounters
+    {
+    public:
+        static inline ThreadCounters& Get() noexcept
+        {
+            thread_local ThreadCounters counters;
+            return counters;
+        }
+
+        inline ThreadCounters() { Registry::Get().Attach(this); }
+        inline ~ThreadCounters() { Registry::Get().Detach(this); }
+        ThreadCounters(const ThreadCounters&) = delete;
+        ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+        Counter counters[MaxKernels];
+
+    private:
+        friend class Registry;
+
+        // The counts at the last Reset, only used under the registry mutex
+        std::uint64_t m_BaseCalls[MaxKernels] = {};
+        std::uint64_t m_BaseCycles[MaxKernels] = {};
+    };
+
+    inline void Registry::Detach(ThreadCounters* counters)
+    {
+        std::lock_guard lock(m_Mutex);
+        for (std::size_t i = 0; i < MaxKernels; ++i)
+        {
+            m_RetiredCalls[i] += counters->counters[i].calls.load(std::memory_order_relaxed) - counters->m_BaseCalls[i];
+            m_RetiredCycles[i] += counters->counters[i].cycles.load(std::memory_order_relaxed) - counters->m_BaseCycles[i];
+        }
+        std::erase(m_Threads, counters);
+    }
+
+    inline std::vector<KernelStats> Registry::Snapshot()
+    {
+        std::lock_guard lock(m_Mutex);
+        std::vector<KernelStats> result(m_Names.size());
+        for (std::size_t i = 0; i < m_Names.size(); ++i)
+        {
+            result[i].name = m_Names[i];
+            result[i].calls = m_RetiredCalls[i];
+            result[i].cycles = m_RetiredCycles[i];
+            for (const ThreadCounters* counters : m_Threads)
+            {
+                result[i].calls += counters->counters[i].calls.load(std::memory_order_relaxed) - counters->m_BaseCalls[i];
+                result[i].cycles += counters->counters[i].cycles.load(std::memory_order_relaxed) - counters->m_BaseCycles[i];
+            }
+        }
+        return result;
+    }
+
+    // Counts from here on: the counters of running threads are kept and their current values become the baselines
+    // Snapshot subtracts. A kernel running on another thread at the same time counts its call after the reset
+    inline void Registry::Reset()
+    {
+        std::lock_guard lock(m_Mutex);
+        std::fill(std::begin(m_RetiredCalls), std::end(m_RetiredCalls), 0);
+        std::fill(std::begin(m_RetiredCycles), std::end(m_RetiredCycles), 0);
+        for (ThreadCounters* counters : m_Threads)
+        {
+            for (std::size_t i = 0; i < MaxKernels; ++i)
+            {
+                counters->m_BaseCalls[i] = counters->counters[i].calls.load(std::memory_order_relaxed);
+                counters->m_BaseCycles[i] = counters->counters[i].cycles.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template<typename... Parts>
+    inline std::string KernelName(const Parts&... parts)
+    {
+        std::ostringstream stream;
+        (stream << ... << parts);
+        return stream.str();
+    }
+
+    // Constant evaluation (the constexpr kernels) isn't counted
+    class KernelScope
+    {
+    public:
+        inline constexpr explicit KernelScope(std::size_t (*id)() noexcept) noexcept
+        {
+            if (!std::is_constant_evaluated())
+            {
+                m_Counter = &ThreadCounters::Get().counters[id()];
+                if (Registry::Get().timing.load(std::memory_order_relaxed))
+                    m_Start = ReadCycles();
+            }
+        }
+
+        inline constexpr ~KernelScope()
+        {
+            if (!std::is_constant_evaluated())
+                m_Counter->Add(m_Start == 0 ? 0 : ReadCycles() - m_Start);
+        }
+
+        KernelScope(const KernelScope&) = delete;
+        KernelScope& operator=(const KernelScope&) = delete;
+
+    private:
+        Counter* m_Counter = nullptr;
+        std::uint64_t m_Start = 0;
+    };
+
+#define PULSARION_MATH_INSTRUMENT_KERNEL(...)                                                                            \
+    ::Pulsarion::Math::Instrument::KernelScope pulsarionMathKernelScope([]() noexcept -> std::size_t {                \
+        static const std::size_t id = ::Pulsarion::Math::Instrument::Registry::Get().Register(                          \
+            ::Pulsarion::Math::Instrument::KernelName(__VA_ARGS__));                                                       \
+        return id;                                                                                                         \
+    })
+
+    inline std::vector<KernelStats> Snapshot() { return Registry::Get().Snapshot(); }
+    inline void Reset() { Registry::Get().Reset(); }
+    inline void SetTimingEnabled(bool enabled) noexcept { Registry::Get().timing.store(enabled, std::memory_order_relaxed); }
+#else
+#define PULSARION_MATH_INSTRUMENT_KERNEL(...)
+
+    inline std::vector<KernelStats> Snapshot() { return {}; }
+    inline void Reset() {}
+    inline void SetTimingEnabled(bool) noexcept {}
+#endif
+
+    // The count hottest kernels by total cycles (by calls when timing was off)
+    inline void Dump(std::ostream& stream, std::size_t count = 20)
+    {
+#ifdef PULSARION_MATH_INSTRUMENT
+        std::vector<KernelStats> stats = Snapshot();
+        std::erase_if(stats, [](const KernelStats& kernel) { return kernel.calls == 0; });
+        std::sort(stats.begin(), stats.end(), [](const KernelStats& left, const KernelStats& right) {
+            return left.cycles != right.cycles ? left.cycles > right.cycles : left.calls > right.calls;
+        });
+        stats.resize(std::min(count, stats.size()));
+
+        stream << std::left << std::setw(48) << "Kernel" << std::right << std::setw(16) << "Calls" << std::setw(20) << "Cycles" << std::setw(14) << "Cycles/call" << '\n';
+        for (const KernelStats& kernel : stats)
+        {
+            stream << std::left << std::setw(48) << kernel.name << std::right << std::setw(16) << kernel.calls << std::setw(20) << kernel.cycles
+                   << std::setw(14) << kernel.cycles / kernel.calls << '\n';
+        }
+#else
+        (void)count;
+        stream << "PulsarionMath instrumentation is disabled, define PULSARION_MATH_INSTRUMENT to enable it\n";
+#endif
+    }
+}
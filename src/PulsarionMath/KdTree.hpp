@@ -0,0 +1,308 @@
+#pragma once
+#define PULSARION_MATH_KD_TREE_HPP
+
+#include "Vector.hpp"
+#include "AlignedAllocator.hpp"
+#include "Parallel.hpp"
+#include "SpatialHashGrid.hpp"
+#include "KdTreeCommon.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+// A k-d tree over a static set of points, for nearest, k nearest and radius queries (point cloud registration, snapping, ...).
+// The layout is implicit: the tree is complete and every node splits its points at their middle index, so the range of points
+// of a node follows from its depth and position, and the nodes are an array in breadth first order (the children of i are
+// 2i + 1 and 2i + 2) holding only the split value and axis. The axis is the one the points of the node spread most along.
+// The leaves hold at most KdTreeConstants::LeafSize points, stored in tree order as separate x, y and z arrays,
+// so a leaf is one contiguous run checked with SIMD distance tests (the radius tests are the ones of SpatialHashGrid).
+// Only the xyz of the points are used. The build is deterministic, the tree doesn't depend on the thread count.
+namespace Pulsarion::Math
+{
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    requires (N == 3 || N == 4)
+    class KdTree
+    {
+    public:
+        static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+        struct Neighbor
+        {
+            std::uint32_t index = InvalidIndex; // In the built points, InvalidIndex if the tree is empty
+            T distanceSquared = std::numeric_limits<T>::infinity();
+        };
+
+        KdTree() noexcept = default;
+
+        // Rebuilds the tree for the points. The top levels are split on the calling thread, then a subtree per thread
+        inline void Build(std::span<const Vector<N, T, Q>> points, std::size_t threadCount = DefaultThreadCount())
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("KdTree::Build");
+            const std::size_t count = points.size();
+            m_Count = count;
+            m_Depth = 0;
+            // The leaves of a level hold the floor or the ceiling of count / 2^depth points
+            while (((count + (std::size_t(1) << m_Depth) - 1) >> m_Depth) > KdTreeConstants::LeafSize)
+                ++m_Depth;
+            const std::size_t nodes = (std::size_t(1) << m_Depth) - 1;
+            m_Split.resize(nodes);
+            m_Axis.resize(nodes);
+
+            std::vector<BuildPoint> work(count);
+            for (std::size_t i = 0; i < count; ++i)
+                work[i] = { { points[i][0], points[i][1], points[i][2] }, static_cast<std::uint32_t>(i) };
+
+            threadCount = std::clamp<std::size_t>(threadCount, 1, std::max<std::size_t>(1, count / KdTreeConstants::ParallelGranularity));
+            std::size_t top = 0;
+            while (top < m_Depth && (std::size_t(1) << top) < threadCount)
+                ++top;
+            for (std::size_t depth = 0; depth < top; ++depth)
+                for (std::size_t position = 0; position < (std::size_t(1) << depth); ++position)
+                    Split(work, depth, position);
+            ParallelFor(std::size_t(1) << top, 1, threadCount, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (std::size_t position = begin; position < end; ++position)
+                    BuildSubtree(work, top, position);
+            });
+
+            m_Indices.resize(count);
+            m_X.resize(count);
+            m_Y.resize(count);
+            m_Z.resize(count);
+            for (std::size_t slot = 0; slot < count; ++slot)
+            {
+                m_Indices[slot] = work[slot].index;
+                m_X[slot] = work[slot].position[0];
+                m_Y[slot] = work[slot].position[1];
+                m_Z[slot] = work[slot].position[2];
+            }
+        }
+
+        // The nearest point, any of equally near ones
+        [[nodiscard]] inline Neighbor Nearest(const Vector<N, T, Q>& point) const noexcept
+        {
+            const T query[3] = { point[0], point[1], point[2] };
+            return ToNeighbor(NearestSlot(query, NoSlot));
+        }
+
+        // The nearest point of each query. A query starts with the distance to the nearest point of the previous one as its bound,
+        // so with coherent queries (consecutive points of a scan, or sorted ones) most far sides are never pushed
+        inline void NearestBatch(std::span<const Vector<N, T, Q>> queries, std::span<Neighbor> result, std::size_t threadCount = DefaultThreadCount()) const
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("KdTree::NearestBatch");
+            ParallelFor(queries.size(), KdTreeConstants::QueryGranularity, threadCount, [&](std::size_t begin, std::size_t end, std::size_t) {
+                std::size_t previous = NoSlot;
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const T query[3] = { queries[i][0], queries[i][1], queries[i][2] };
+                    const SlotNeighbor nearest = NearestSlot(query, previous);
+                    result[i] = ToNeighbor(nearest);
+                    previous = nearest.slot;
+                }
+            });
+        }
+
+        // The min(k, Size()) nearest points, nearest first, in the first elements of result, with k = result.size(). Returns how many
+        inline std::size_t KNearest(const Vector<N, T, Q>& point, std::span<Neighbor> result) const
+        {
+            const std::size_t k = std::min(result.size(), m_Indices.size());
+            if (k == 0)
+                return 0;
+
+            // A max heap of the nearest points found so far, its first element is the farthest of them
+            const T query[3] = { point[0], point[1], point[2] };
+            const auto nearer = [](const Neighbor& left, const Neighbor& right) { return left.distanceSquared < right.distanceSquared; };
+            std::size_t found = 0;
+            const auto bound = [&]() { return found < k ? std::numeric_limits<T>::infinity() : result[0].distanceSquared; };
+            Traverse(query, bound, [&](std::size_t begin, std::size_t end) {
+                SpatialHashGridFunctions<T>::Within(m_X.data() + begin, m_Y.data() + begin, m_Z.data() + begin, end - begin, query, bound(),
+                                                    [&](std::size_t i, T distanceSquared) {
+                                                        if (found < k)
+                                                        {
+                                                            result[found++] = { m_Indices[begin + i], distanceSquared };
+                                                            std::push_heap(result.begin(), result.begin() + static_cast<std::ptrdiff_t>(found), nearer);
+                                                        }
+                                                        else if (distanceSquared < result[0].distanceSquared)
+                                                        {
+                                                            std::pop_heap(result.begin(), result.begin() + static_cast<std::ptrdiff_t>(k), nearer);
+                                                            result[k - 1] = { m_Indices[begin + i], distanceSquared };
+                                                            std::push_heap(result.begin(), result.begin() + static_cast<std::ptrdiff_t>(k), nearer);
+                                                        }
+                                                    });
+            });
+            std::sort_heap(result.begin(), result.begin() + static_cast<std::ptrdiff_t>(found), nearer);
+            return found;
+        }
+
+        // Calls callback(index, distanceSquared) for every point within radius of center (inclusive), in no particular order
+        template<typename F>
+        inline void QueryRadius(const Vector<N, T, Q>& center, T radius, F&& callback) const
+        {
+            if (m_Indices.empty())
+                return;
+
+            const T query[3] = { center[0], center[1], center[2] };
+            const T radiusSquared = radius * radius;
+            Traverse(query, [radiusSquared]() { return radiusSquared; }, [&](std::size_t begin, std::size_t end) {
+                SpatialHashGridFunctions<T>::Within(m_X.data() + begin, m_Y.data() + begin, m_Z.data() + begin, end - begin, query, radiusSquared,
+                                                    [&](std::size_t i, T distanceSquared) { callback(m_Indices[begin + i], distanceSquared); });
+            });
+        }
+
+        // Appends the indices of the points within radius of center to result, and returns how many there were
+        inline std::size_t QueryRadius(const Vector<N, T, Q>& center, T radius, std::vector<std::uint32_t>& result) const
+        {
+            const std::size_t before = result.size();
+            QueryRadius(center, radius, [&result](std::uint32_t index, T) { result.push_back(index); });
+            return result.size() - before;
+        }
+
+        [[nodiscard]] inline std::size_t Size() const noexcept { return m_Indices.size(); }
+        [[nodiscard]] inline std::size_t Depth() const noexcept { return m_Depth; }
+        [[nodiscard]] inline std::size_t LeafCount() const noexcept { return m_Indices.empty() ? 0 : std::size_t(1) << m_Depth; }
+        // The point indices in tree order, points of a leaf are contiguous, iterating in this order keeps neighbors close in memory
+        [[nodiscard]] inline std::span<const std::uint32_t> SortedIndices() const noexcept { return m_Indices; }
+
+    private:
+        static constexpr std::size_t NoSlot = std::numeric_limits<std::size_t>::max();
+
+        struct BuildPoint
+        {
+            T position[3];
+            std::uint32_t index;
+        };
+
+        struct SlotNeighbor
+        {
+            std::size_t slot = NoSlot;
+            T distanceSquared = std::numeric_limits<T>::infinity();
+        };
+
+        std::size_t m_Count = 0;
+        std::size_t m_Depth = 0;
+        std::vector<T> m_Split;                    // Per node, in breadth first order
+        std::vector<std::uint8_t> m_Axis;
+        std::vector<std::uint32_t> m_Indices;      // Original index of each slot, in tree order
+        std::vector<T, AlignedAllocator<T>> m_X;   // Positions in tree order
+        std::vector<T, AlignedAllocator<T>> m_Y;
+        std::vector<T, AlignedAllocator<T>> m_Z;
+
+        // The first slot of the node at the position in its depth, the last one is before the first of the next position
+        inline std::size_t Begin(std::size_t depth, std::size_t position) const noexcept
+        {
+            return (position * m_Count) >> depth;
+        }
+
+        // Splits the points of the node along the axis of their largest extent, the lower half ends up left of the middle slot
+        inline void Split(std::vector<BuildPoint>& work, std::size_t depth, std::size_t position)
+        {
+            const std::size_t begin = Begin(depth, position), end = Begin(depth, position + 1);
+            const std::size_t middle = Begin(depth + 1, 2 * position + 1);
+            T low[3], high[3];
+            for (std::size_t d = 0; d < 3; ++d)
+            {
+                low[d] = std::numeric_limits<T>::infinity();
+                high[d] = -std::numeric_limits<T>::infinity();
+            }
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                for (std::size_t d = 0; d < 3; ++d)
+                {
+                    low[d] = std::min(low[d], work[i].position[d]);
+                    high[d] = std::max(high[d], work[i].position[d]);
+                }
+            }
+            std::size_t axis = 0;
+            for (std::size_t d = 1; d < 3; ++d)
+                if (high[d] - low[d] > high[axis] - low[axis])
+                    axis = d;
+
+            const auto first = work.begin();
+            std::nth_element(first + static_cast<std::ptrdiff_t>(begin), first + static_cast<std::ptrdiff_t>(middle), first + static_cast<std::ptrdiff_t>(end),
+                             [axis](const BuildPoint& left, const BuildPoint& right) { return left.position[axis] < right.position[axis]; });
+            const std::size_t node = (std::size_t(1) << depth) - 1 + position;
+            m_Split[node] = work[middle].position[axis];
+            m_Axis[node] = static_cast<std::uint8_t>(axis);
+        }
+
+        inline void BuildSubtree(std::vector<BuildPoint>& work, std::size_t depth, std::size_t position)
+        {
+            if (depth == m_Depth)
+                return;
+            Split(work, depth, position);
+            BuildSubtree(work, depth + 1, 2 * position);
+            BuildSubtree(work, depth + 1, 2 * position + 1);
+        }
+
+        // Calls leaf(begin, end) with the slots of every leaf that can hold points within bound() (squared) of the point,
+        // the leaf on the side of the point first at every node. A side is skipped if the distance to its splitting plane is over the bound
+        template<typename B, typename L>
+        inline void Traverse(const T (&point)[3], B&& bound, L&& leaf) const
+        {
+            struct Entry
+            {
+                std::size_t node;
+                T distanceSquared;
+            };
+            // The depths on the stack increase from the bottom, so it never holds more than a node per level
+            Entry stack[64];
+            std::size_t size = 0;
+            stack[size++] = { 0, T(0) };
+            const std::size_t nodes = m_Split.size();
+            while (size > 0)
+            {
+                const Entry entry = stack[--size];
+                if (entry.distanceSquared > bound())
+                    continue;
+                std::size_t node = entry.node;
+                while (node < nodes)
+                {
+                    const T difference = point[m_Axis[node]] - m_Split[node];
+                    const std::size_t left = 2 * node + 1;
+                    const bool below = difference < T(0);
+                    if (difference * difference <= bound())
+                        stack[size++] = { below ? left + 1 : left, difference * difference };
+                    node = below ? left : left + 1;
+                }
+                const std::size_t position = node - nodes;
+                leaf(Begin(m_Depth, position), Begin(m_Depth, position + 1));
+            }
+        }
+
+        // Seeded with a slot, the search only looks for points nearer than it
+        inline SlotNeighbor NearestSlot(const T (&point)[3], std::size_t seed) const noexcept
+        {
+            SlotNeighbor nearest;
+            if (m_Indices.empty())
+                return nearest;
+            if (seed != NoSlot)
+            {
+                const T dx = m_X[seed] - point[0], dy = m_Y[seed] - point[1], dz = m_Z[seed] - point[2];
+                nearest = { seed, dx * dx + dy * dy + dz * dz };
+            }
+
+            Traverse(point, [&nearest]() { return nearest.distanceSquared; }, [&](std::size_t begin, std::size_t end) {
+                std::size_t index = end - begin;
+                KdTreeFunctions<T>::Nearest(m_X.data() + begin, m_Y.data() + begin, m_Z.data() + begin, end - begin, point, nearest.distanceSquared, index);
+                if (index < end - begin)
+                    nearest.slot = begin + index;
+            });
+            return nearest;
+        }
+
+        inline Neighbor ToNeighbor(const SlotNeighbor& nearest) const noexcept
+        {
+            if (nearest.slot == NoSlot)
+                return {};
+            return { m_Indices[nearest.slot], nearest.distanceSquared };
+        }
+    };
+}
+
+#include "KdTreeGeneric.hpp"
+
+#ifdef PULSARION_MATH_SIMD_SSE4_1
+#include "KdTreeSSE.hpp"
+#endif
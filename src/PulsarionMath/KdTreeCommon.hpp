@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct KdTreeFunctions; // Nearest point of a run of SoA positions.
+
+    struct KdTreeConstants
+    {
+        // Most points in a leaf, the leaves are checked with SIMD distance tests, the tree stops splitting at this size
+        static constexpr std::size_t LeafSize = 16;
+        // Points per thread below which the build doesn't start threads
+        static constexpr std::size_t ParallelGranularity = 16 * 1024;
+        // Queries per range of a batch, consecutive queries of a range share the bound of the previous one
+        static constexpr std::size_t QueryGranularity = 1024;
+    };
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#ifndef PULSARION_MATH_KD_TREE_HPP
+#include "KdTree.hpp"
+#endif
+
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct KdTreeFunctions
+    {
+        // The first i in [0, count) with (x[i], y[i], z[i]) strictly closer to center than best (squared), for which best and bestIndex
+        // are set to its distance and i. Both are left as they are if there is none
+        static inline void Nearest(const T* x, const T* y, const T* z, std::size_t count, const T (&center)[3], T& best, std::size_t& bestIndex) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("KdTree::Nearest");
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const T dx = x[i] - center[0], dy = y[i] - center[1], dz = z[i] - center[2];
+                const T distanceSquared = dx * dx + dy * dy + dz * dz;
+                if (distanceSquared < best)
+                {
+                    best = distanceSquared;
+                    bestIndex = i;
+                }
+            }
+        }
+    };
+}
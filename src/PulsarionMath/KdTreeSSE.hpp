@@ -0,0 +1,60 @@
+#pragma once
+
+#ifndef PULSARION_MATH_KD_TREE_HPP
+#include "KdTree.hpp"
+#endif
+
+#include <bit>
+#include <immintrin.h>
+
+namespace Pulsarion::Math
+{
+    // 4 candidates per iteration compared with the broadcast best, a leaf that can't improve it costs no branch per point
+    template<>
+    struct KdTreeFunctions<float>
+    {
+        static inline void Nearest(const float* x, const float* y, const float* z, std::size_t count, const float (&center)[3], float& best, std::size_t& bestIndex) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("KdTree::Nearest");
+            const __m128 cx = _mm_set1_ps(center[0]);
+            const __m128 cy = _mm_set1_ps(center[1]);
+            const __m128 cz = _mm_set1_ps(center[2]);
+            __m128 bound = _mm_set1_ps(best);
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128 dx = _mm_sub_ps(_mm_loadu_ps(x + i), cx);
+                const __m128 dy = _mm_sub_ps(_mm_loadu_ps(y + i), cy);
+                const __m128 dz = _mm_sub_ps(_mm_loadu_ps(z + i), cz);
+                const __m128 distanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+                unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_cmplt_ps(distanceSquared, bound)));
+                if (mask == 0)
+                    continue;
+
+                // In lane order, so the first of equally close points wins, as in the scalar loop
+                PULSARION_MATH_ALIGN float distances[4];
+                _mm_store_ps(distances, distanceSquared);
+                for (; mask != 0; mask &= mask - 1)
+                {
+                    const auto lane = static_cast<std::size_t>(std::countr_zero(mask));
+                    if (distances[lane] < best)
+                    {
+                        best = distances[lane];
+                        bestIndex = i + lane;
+                    }
+                }
+                bound = _mm_set1_ps(best);
+            }
+            for (; i < count; ++i)
+            {
+                const float dx = x[i] - center[0], dy = y[i] - center[1], dz = z[i] - center[2];
+                const float distanceSquared = dx * dx + dy * dy + dz * dz;
+                if (distanceSquared < best)
+                {
+                    best = distanceSquared;
+                    bestIndex = i;
+                }
+            }
+        }
+    };
+}
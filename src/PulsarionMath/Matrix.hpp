@@ -6,43 +6,38 @@
 #include "Simd.hpp"
 #include "MatrixCommon.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace Pulsarion::Math
 {
     template<std::size_t R, std::size_t C, Arithmetic_t T>
+    requires (R >= 2 && R <= 4 && C >= 2 && C <= 4)
     class Matrix
     {
     public:
 #ifdef PULSARION_MATH_MATRIX_COLUMN_MAJOR
-        PULSARION_MATH_ALIGN Vector<C, T, Qualifier::Aligned> data[R];
+        using StorageVector = Vector<R, T, Qualifier::Aligned>; // A single column
+        static constexpr std::size_t StorageCount = C;
 #else
-        Vector<R, T, Qualifier::Aligned> data[C];
+        using StorageVector = Vector<C, T, Qualifier::Aligned>; // A single row
+        static constexpr std::size_t StorageCount = R;
 #endif
+        PULSARION_MATH_ALIGN StorageVector data[StorageCount];
 
         // ---- Constructors ----
-#ifdef PULSARION_MATH_MATRIX_COLUMN_MAJOR
-        inline constexpr Matrix(const T& m00, const T& m01, const T& m02, const T& m03,
-                                const T& m10, const T& m11, const T& m12, const T& m13,
-                                const T& m20, const T& m21, const T& m22, const T& m23,
-                                const T& m30, const T& m31, const T& m32, const T& m33) noexcept
-            : data{ Vector<C, T, Qualifier::Aligned>(m00, m10, m20, m30),
-                    Vector<C, T, Qualifier::Aligned>(m01, m11, m21, m31),
-                    Vector<C, T, Qualifier::Aligned>(m02, m12, m22, m32),
-                    Vector<C, T, Qualifier::Aligned>(m03, m13, m23, m33) } {}
-#else
-        inline constexpr Matrix(const T& m00, const T& m01, const T& m02, const T& m03,
-                                const T& m10, const T& m11, const T& m12, const T& m13,
-                                const T& m20, const T& m21, const T& m22, const T& m23,
-                                const T& m30, const T& m31, const T& m32, const T& m33) noexcept
-            : data{ Vector<R, T, Qualifier::Aligned>(m00, m01, m02, m03),
-                    Vector<R, T, Qualifier::Aligned>(m10, m11, m12, m13),
-                    Vector<R, T, Qualifier::Aligned>(m20, m21, m22, m23),
-                    Vector<R, T, Qualifier::Aligned>(m30, m31, m32, m33) } {}
+        // The values are given row by row (m00, m01, ..., m10, m11, ...), regardless of the major order
+        template<typename... Args>
+        requires (sizeof...(Args) == R * C && (std::convertible_to<Args, T> && ...))
+        inline constexpr Matrix(const Args&... values) noexcept
+            : Matrix(std::array<T, R * C>{ static_cast<T>(values)... }, std::make_index_sequence<StorageCount>{}) {}
 
-#endif
-        explicit inline constexpr Matrix(const T& value) noexcept : Matrix(value, 0, 0, 0,
-                                                                        0, value, 0, 0,
-                                                                        0, 0, value, 0,
-                                                                        0, 0, 0, value) {}
+        // Diagonal matrix
+        explicit inline constexpr Matrix(const T& value) noexcept : data{}
+        {
+            for (std::size_t i = 0; i < std::min(R, C); ++i)
+                Get(i, i) = value;
+        }
 
         // Identity matrix by default
         inline constexpr Matrix() noexcept : Matrix(1) {}
@@ -66,60 +61,83 @@ namespace Pulsarion::Math
 #endif
 
         // This shouldn't be used for anything, but it is used for transposing
-        inline constexpr Vector<C, T, Qualifier::Aligned>& operator[](std::size_t index) noexcept { return data[index]; }
-        inline constexpr const Vector<C, T, Qualifier::Aligned>& operator[](std::size_t index) const noexcept { return data[index]; }
+        inline constexpr StorageVector& operator[](std::size_t index) noexcept { return data[index]; }
+        inline constexpr const StorageVector& operator[](std::size_t index) const noexcept { return data[index]; }
 
 #ifdef PULSARION_MATH_MATRIX_COLUMN_MAJOR
         // Returning const references is fine, since they are used the same way as a copy
-        [[nodiscard]] inline constexpr const Vector<C, T, Qualifier::Aligned>& Row(std::size_t index) const noexcept { return data[index]; }
-        [[nodiscard]] inline constexpr Vector<R, T, Qualifier::Aligned> Column(std::size_t index) const noexcept
+        [[nodiscard]] inline constexpr const Vector<R, T, Qualifier::Aligned>& Column(std::size_t index) const noexcept { return data[index]; }
+        [[nodiscard]] inline constexpr Vector<C, T, Qualifier::Aligned> Row(std::size_t index) const noexcept
         {
-            Vector<R, T, Qualifier::Aligned> result;
-            for (std::size_t i = 0; i < R; ++i)
+            Vector<C, T, Qualifier::Aligned> result;
+            for (std::size_t i = 0; i < C; ++i)
                 result[i] = data[i][index];
             return result;
         }
 #else
-        [[nodiscard]] inline constexpr const Vector<R, T, Qualifier::Aligned>& Row(std::size_t index) const noexcept { return data[index]; }
-        [[nodiscard]] inline constexpr Vector<C, T, Qualifier::Aligned> Column(std::size_t index) const noexcept
+        [[nodiscard]] inline constexpr const Vector<C, T, Qualifier::Aligned>& Row(std::size_t index) const noexcept { return data[index]; }
+        [[nodiscard]] inline constexpr Vector<R, T, Qualifier::Aligned> Column(std::size_t index) const noexcept
         {
-            Vector<C, T, Qualifier::Aligned> result;
-            for (std::size_t i = 0; i < C; ++i)
+            Vector<R, T, Qualifier::Aligned> result;
+            for (std::size_t i = 0; i < R; ++i)
                 result[i] = data[i][index];
             return result;
         }
 #endif
         inline void TransposeInPlace() noexcept
+        requires (R == C)
         {
             MatrixFunctions<R, C, T>::TransposeInPlace(*this);
         }
 
         Matrix<C, R, T> Transpose() const noexcept
         {
-            Matrix<C, R, T> result;
-            result.TransposeInPlace();
-            return result;
+            return MatrixFunctions<R, C, T>::Transpose(*this);
         }
 
-        inline Matrix<R, C, T> operator*(const Matrix<R, C, T>& other) const noexcept
+        // (R x C) * (C x K) = (R x K)
+        template<std::size_t K>
+        inline Matrix<R, K, T> operator*(const Matrix<C, K, T>& other) const noexcept
         {
             return MatrixFunctions<R, C, T>::Multiply(*this, other);
         }
 
-        inline Vector<R, T, Qualifier::Aligned> operator*(const Vector<R, T, Qualifier::Aligned>& other) const noexcept
+        inline Vector<R, T, Qualifier::Aligned> operator*(const Vector<C, T, Qualifier::Aligned>& other) const noexcept
         {
             return MatrixFunctions<R, C, T>::VecMultiply(*this, other);
         }
+
+    private:
+        template<std::size_t... I>
+        inline constexpr Matrix(const std::array<T, R * C>& values, std::index_sequence<I...>) noexcept
+            : data{ MakeStorageVector(values, I)... } {}
+
+        static inline constexpr StorageVector MakeStorageVector(const std::array<T, R * C>& values, std::size_t index) noexcept
+        {
+            StorageVector result;
+#ifdef PULSARION_MATH_MATRIX_COLUMN_MAJOR
+            for (std::size_t i = 0; i < R; ++i)
+                result[i] = values[i * C + index];
+#else
+            for (std::size_t i = 0; i < C; ++i)
+                result[i] = values[index * C + i];
+#endif
+            return result;
+        }
     };
 }
 
+#include "Affine3x4.hpp"
+#include "MatrixGeneric.hpp"
+#include "Affine3x4M.hpp"
+
 #ifdef PULSARION_MATH_MATRIX_COLUMN_MAJOR
-#ifdef PULSARION_MATH_SIMD_SSE4_1
+#if defined(PULSARION_MATH_SIMD_SSE4_1) && !defined(PULSARION_MATH_DETERMINISTIC)
 #include "Matrix4x4MSSE.hpp"
-#else
-#include "Matrix4x4M.hpp"
+#include "Matrix3x3MSSE.hpp"
+#include "Matrix2x2MSSE.hpp"
+#include "Affine3x4MSSE.hpp"
 #endif
 #else
 #error Not implemented
 #endif
-
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "PulsarionMath/Qualifier.hpp"
+#ifndef PULSARION_MATH_MATRIX_HPP
+#include "Matrix.hpp"
+#endif
+#include <immintrin.h>
+
+namespace Pulsarion::Math
+{
+    // The whole matrix (m00, m10, m01, m11) fits in a single register
+    template<>
+    struct MatrixFunctions<2, 2, float> : GenericMatrixFunctions<2, 2, float>
+    {
+        using GenericMatrixFunctions<2, 2, float>::Multiply; // Rectangular multiplication
+
+        inline static void TransposeInPlace(Matrix<2, 2, float>& matrix) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix2x2::TransposeInPlace");
+            __m128 m = _mm_load_ps(&matrix[0].x());
+            _mm_store_ps(&matrix[0].x(), _mm_shuffle_ps(m, m, _MM_SHUFFLE(3, 1, 2, 0)));
+        }
+
+        inline static Matrix<2, 2, float> Multiply(const Matrix<2, 2, float>& left, const Matrix<2, 2, float>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix2x2::Multiply");
+            __m128 in1 = _mm_load_ps(&left[0].x());
+            __m128 in2 = _mm_load_ps(&right[0].x());
+
+            // (m00, m10, m00, m10) and (m01, m11, m01, m11)
+            __m128 c0 = _mm_shuffle_ps(in1, in1, _MM_SHUFFLE(1, 0, 1, 0));
+            __m128 c1 = _mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 3, 2));
+            // (m00, m00, m01, m01) and (m10, m10, m11, m11)
+            __m128 e0 = _mm_shuffle_ps(in2, in2, _MM_SHUFFLE(2, 2, 0, 0));
+            __m128 e1 = _mm_shuffle_ps(in2, in2, _MM_SHUFFLE(3, 3, 1, 1));
+
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 a0 = _mm_add_ps(_mm_mul_ps(c0, e0), _mm_mul_ps(c1, e1));
+
+            Matrix<2, 2, float> result;
+            _mm_store_ps(&result[0].x(), a0);
+            return result;
+        }
+
+        inline static Vector<2, float, Qualifier::Aligned> VecMultiply(const Matrix<2, 2, float>& matrix, const Vector<2, float, Qualifier::Aligned>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix2x2::VecMultiply");
+            __m128 m = _mm_load_ps(&matrix[0].x());
+            __m128 v = _mm_setr_ps(vector.x(), vector.x(), vector.y(), vector.y());
+
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 m0 = _mm_mul_ps(m, v);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 a0 = _mm_add_ps(m0, _mm_movehl_ps(m0, m0));
+
+            Vector<2, float, Qualifier::Aligned> result;
+            _mm_storel_pi(reinterpret_cast<__m64*>(&result.x()), a0);
+            return result;
+        }
+    };
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "PulsarionMath/Qualifier.hpp"
+#ifndef PULSARION_MATH_MATRIX_HPP
+#include "Matrix.hpp"
+#endif
+#include <immintrin.h>
+
+namespace Pulsarion::Math
+{
+    // Every column is a padded Vector<3, float, Qualifier::Aligned>, so it is loaded as a whole register.
+    // The padding lane stays zero, as long as the inputs have zero padding.
+    template<>
+    struct MatrixFunctions<3, 3, float> : GenericMatrixFunctions<3, 3, float>
+    {
+        using GenericMatrixFunctions<3, 3, float>::Multiply; // Rectangular multiplication
+
+        inline static void TransposeInPlace(Matrix<3, 3, float>& matrix) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix3x3::TransposeInPlace");
+            __m128 row0 = _mm_load_ps(&matrix[0].x());
+            __m128 row1 = _mm_load_ps(&matrix[1].x());
+            __m128 row2 = _mm_load_ps(&matrix[2].x());
+            __m128 row3 = _mm_setzero_ps();
+
+            _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+            _mm_store_ps(&matrix[0].x(), row0);
+            _mm_store_ps(&matrix[1].x(), row1);
+            _mm_store_ps(&matrix[2].x(), row2);
+        }
+
+        inline static Matrix<3, 3, float> Multiply(const Matrix<3, 3, float>& left, const Matrix<3, 3, float>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix3x3::Multiply");
+            __m128 in1[] = {
+                _mm_load_ps(&left[0].x()),
+                _mm_load_ps(&left[1].x()),
+                _mm_load_ps(&left[2].x()),
+            };
+
+            Matrix<3, 3, float> result;
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                __m128 column = _mm_load_ps(&right[i].x());
+                __m128 e0 = _mm_shuffle_ps(column, column, _MM_SHUFFLE(0, 0, 0, 0));
+                __m128 e1 = _mm_shuffle_ps(column, column, _MM_SHUFFLE(1, 1, 1, 1));
+                __m128 e2 = _mm_shuffle_ps(column, column, _MM_SHUFFLE(2, 2, 2, 2));
+
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 m0 = _mm_mul_ps(in1[0], e0);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 m1 = _mm_mul_ps(in1[1], e1);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 m2 = _mm_mul_ps(in1[2], e2);
+
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 a0 = _mm_add_ps(m0, m1);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 a1 = _mm_add_ps(a0, m2);
+
+                _mm_store_ps(&result[i].x(), a1);
+            }
+            return result;
+        }
+
+        inline static Vector<3, float, Qualifier::Aligned> VecMultiply(const Matrix<3, 3, float>& matrix, const Vector<3, float, Qualifier::Aligned>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix3x3::VecMultiply");
+            __m128 v = _mm_load_ps(&vector.x());
+            __m128 m[] = {
+                _mm_load_ps(&matrix[0].x()),
+                _mm_load_ps(&matrix[1].x()),
+                _mm_load_ps(&matrix[2].x())
+            };
+
+            __m128 v0 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 v1 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+            __m128 v2 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 m0 = _mm_mul_ps(m[0], v0);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 m1 = _mm_mul_ps(m[1], v1);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 m2 = _mm_mul_ps(m[2], v2);
+
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 a0 = _mm_add_ps(m0, m1);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 a1 = _mm_add_ps(a0, m2);
+
+            Vector<3, float, Qualifier::Aligned> result;
+            _mm_store_ps(&result.x(), a1);
+            return result;
+        }
+    };
+}
@@ -9,10 +9,13 @@
 namespace Pulsarion::Math
 {
     template<>
-    struct MatrixFunctions<4, 4, float>
+    struct MatrixFunctions<4, 4, float> : GenericMatrixFunctions<4, 4, float>
     {
+        using GenericMatrixFunctions<4, 4, float>::Multiply; // Rectangular multiplication
+
        inline static void TransposeInPlace(Matrix<4, 4, float>& matrix) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix4x4::TransposeInPlace");
             __m128 row0 = _mm_load_ps(&matrix[0].x());
             __m128 row1 = _mm_load_ps(&matrix[1].x());
             __m128 row2 = _mm_load_ps(&matrix[2].x());
@@ -28,6 +31,7 @@ namespace Pulsarion::Math
 
         inline static Matrix<4, 4, float> Multiply(const Matrix<4, 4, float>& left, const Matrix<4, 4, float>& right) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix4x4::Multiply");
             __m128 in1[] = {
                 _mm_load_ps(&left[0].x()),
                 _mm_load_ps(&left[1].x()),
@@ -154,6 +158,7 @@ namespace Pulsarion::Math
 
         inline static Vector<4, float, Qualifier::Aligned> VecMultiply(const Matrix<4, 4, float>& matrix, const Vector<4, float, Qualifier::Aligned>& vector) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix4x4::VecMultiply");
             __m128 v = _mm_load_ps(&vector.x());
             __m128 m[] = {
                 _mm_load_ps(&matrix[0].x()),
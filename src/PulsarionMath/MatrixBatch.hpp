@@ -0,0 +1,45 @@
+#pragma once
+#define PULSARION_MATH_MATRIX_BATCH_HPP
+
+#include "Matrix.hpp"
+#include "MatrixBatchCommon.hpp"
+
+#include <cassert>
+#include <span>
+#include <type_traits>
+
+// Many independent products of square matrices in one call, e.g. viewProjection * model[i] for every instance.
+// The matrix shared by every product is loaded (and for the right one, broadcast) once for the whole span.
+// The results can be one of the inputs itself, but no other overlap is allowed.
+namespace Pulsarion::Math
+{
+    // results[i] = left * rights[i]
+    template<std::size_t N, Arithmetic_t T>
+    inline void MultiplyBatch(const Matrix<N, N, T>& left, std::type_identity_t<std::span<const Matrix<N, N, T>>> rights, std::type_identity_t<std::span<Matrix<N, N, T>>> results) noexcept
+    {
+        assert(rights.size() == results.size());
+        MatrixBatchFunctions<N, T>::MultiplyLeft(left, rights, results);
+    }
+
+    // results[i] = lefts[i] * right
+    template<std::size_t N, Arithmetic_t T>
+    inline void MultiplyBatch(std::type_identity_t<std::span<const Matrix<N, N, T>>> lefts, const Matrix<N, N, T>& right, std::type_identity_t<std::span<Matrix<N, N, T>>> results) noexcept
+    {
+        assert(lefts.size() == results.size());
+        MatrixBatchFunctions<N, T>::MultiplyRight(lefts, right, results);
+    }
+
+    // results[i] = lefts[i] * rights[i]
+    template<std::size_t N, Arithmetic_t T>
+    inline void MultiplyBatch(std::type_identity_t<std::span<const Matrix<N, N, T>>> lefts, std::type_identity_t<std::span<const Matrix<N, N, T>>> rights, std::type_identity_t<std::span<Matrix<N, N, T>>> results) noexcept
+    {
+        assert(lefts.size() == results.size() && rights.size() == results.size());
+        MatrixBatchFunctions<N, T>::MultiplyEach(lefts, rights, results);
+    }
+}
+
+#include "MatrixBatchGeneric.hpp"
+
+#if defined(PULSARION_MATH_SIMD_SSE4_1) && defined(PULSARION_MATH_MATRIX_COLUMN_MAJOR) && !defined(PULSARION_MATH_DETERMINISTIC)
+#include "MatrixBatchSSE.hpp"
+#endif
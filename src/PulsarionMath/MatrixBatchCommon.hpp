@@ -0,0 +1,10 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+
+namespace Pulsarion::Math
+{
+    template<std::size_t N, Arithmetic_t T>
+    struct MatrixBatchFunctions; // Products of spans of square matrices, a call per span instead of per matrix.
+}
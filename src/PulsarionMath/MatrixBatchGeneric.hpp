@@ -0,0 +1,36 @@
+#pragma once
+
+#ifndef PULSARION_MATH_MATRIX_BATCH_HPP
+#include "MatrixBatch.hpp"
+#endif
+
+#include <span>
+
+namespace Pulsarion::Math
+{
+    // The products of the single matrix kernels, which are already SIMD where they can be
+    template<std::size_t N, Arithmetic_t T>
+    struct MatrixBatchFunctions
+    {
+        static inline void MultiplyLeft(const Matrix<N, N, T>& left, std::span<const Matrix<N, N, T>> rights, std::span<Matrix<N, N, T>> results) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("MatrixBatch", N, "x", N, "::MultiplyLeft");
+            for (std::size_t i = 0; i < rights.size(); ++i)
+                results[i] = MatrixFunctions<N, N, T>::Multiply(left, rights[i]);
+        }
+
+        static inline void MultiplyRight(std::span<const Matrix<N, N, T>> lefts, const Matrix<N, N, T>& right, std::span<Matrix<N, N, T>> results) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("MatrixBatch", N, "x", N, "::MultiplyRight");
+            for (std::size_t i = 0; i < lefts.size(); ++i)
+                results[i] = MatrixFunctions<N, N, T>::Multiply(lefts[i], right);
+        }
+
+        static inline void MultiplyEach(std::span<const Matrix<N, N, T>> lefts, std::span<const Matrix<N, N, T>> rights, std::span<Matrix<N, N, T>> results) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("MatrixBatch", N, "x", N, "::MultiplyEach");
+            for (std::size_t i = 0; i < lefts.size(); ++i)
+                results[i] = MatrixFunctions<N, N, T>::Multiply(lefts[i], rights[i]);
+        }
+    };
+}
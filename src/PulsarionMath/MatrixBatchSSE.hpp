@@ -0,0 +1,106 @@
+#pragma once
+
+#ifndef PULSARION_MATH_MATRIX_BATCH_HPP
+#include "MatrixBatch.hpp"
+#endif
+
+#include <immintrin.h>
+#include <span>
+
+namespace Pulsarion::Math
+{
+    // Column j of left * right is left * (column j of right), the sum of the columns of left scaled by the elements of that column.
+    // The elements of the right matrix have to be broadcast to whole registers, unless it is the shared one,
+    // then its 16 broadcasts are made once and every product is only loads, multiplications and additions.
+    template<>
+    struct MatrixBatchFunctions<4, float>
+    {
+        static inline void MultiplyLeft(const Matrix<4, 4, float>& left, std::span<const Matrix<4, 4, float>> rights, std::span<Matrix<4, 4, float>> results) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("MatrixBatch4x4::MultiplyLeft");
+            const __m128 l0 = _mm_load_ps(&left[0].x());
+            const __m128 l1 = _mm_load_ps(&left[1].x());
+            const __m128 l2 = _mm_load_ps(&left[2].x());
+            const __m128 l3 = _mm_load_ps(&left[3].x());
+            for (std::size_t i = 0; i < rights.size(); ++i)
+            {
+                const __m128 r0 = _mm_load_ps(&rights[i][0].x());
+                const __m128 r1 = _mm_load_ps(&rights[i][1].x());
+                const __m128 r2 = _mm_load_ps(&rights[i][2].x());
+                const __m128 r3 = _mm_load_ps(&rights[i][3].x());
+                _mm_store_ps(&results[i][0].x(), Column(l0, l1, l2, l3, r0));
+                _mm_store_ps(&results[i][1].x(), Column(l0, l1, l2, l3, r1));
+                _mm_store_ps(&results[i][2].x(), Column(l0, l1, l2, l3, r2));
+                _mm_store_ps(&results[i][3].x(), Column(l0, l1, l2, l3, r3));
+            }
+        }
+
+        static inline void MultiplyRight(std::span<const Matrix<4, 4, float>> lefts, const Matrix<4, 4, float>& right, std::span<Matrix<4, 4, float>> results) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("MatrixBatch4x4::MultiplyRight");
+            const __m128 r0 = _mm_load_ps(&right[0].x());
+            const __m128 r1 = _mm_load_ps(&right[1].x());
+            const __m128 r2 = _mm_load_ps(&right[2].x());
+            const __m128 r3 = _mm_load_ps(&right[3].x());
+            const Broadcast b0(r0), b1(r1), b2(r2), b3(r3);
+            for (std::size_t i = 0; i < lefts.size(); ++i)
+            {
+                const __m128 l0 = _mm_load_ps(&lefts[i][0].x());
+                const __m128 l1 = _mm_load_ps(&lefts[i][1].x());
+                const __m128 l2 = _mm_load_ps(&lefts[i][2].x());
+                const __m128 l3 = _mm_load_ps(&lefts[i][3].x());
+                _mm_store_ps(&results[i][0].x(), b0.Column(l0, l1, l2, l3));
+                _mm_store_ps(&results[i][1].x(), b1.Column(l0, l1, l2, l3));
+                _mm_store_ps(&results[i][2].x(), b2.Column(l0, l1, l2, l3));
+                _mm_store_ps(&results[i][3].x(), b3.Column(l0, l1, l2, l3));
+            }
+        }
+
+        static inline void MultiplyEach(std::span<const Matrix<4, 4, float>> lefts, std::span<const Matrix<4, 4, float>> rights, std::span<Matrix<4, 4, float>> results) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("MatrixBatch4x4::MultiplyEach");
+            for (std::size_t i = 0; i < lefts.size(); ++i)
+            {
+                const __m128 l0 = _mm_load_ps(&lefts[i][0].x());
+                const __m128 l1 = _mm_load_ps(&lefts[i][1].x());
+                const __m128 l2 = _mm_load_ps(&lefts[i][2].x());
+                const __m128 l3 = _mm_load_ps(&lefts[i][3].x());
+                const __m128 r0 = _mm_load_ps(&rights[i][0].x());
+                const __m128 r1 = _mm_load_ps(&rights[i][1].x());
+                const __m128 r2 = _mm_load_ps(&rights[i][2].x());
+                const __m128 r3 = _mm_load_ps(&rights[i][3].x());
+                _mm_store_ps(&results[i][0].x(), Column(l0, l1, l2, l3, r0));
+                _mm_store_ps(&results[i][1].x(), Column(l0, l1, l2, l3, r1));
+                _mm_store_ps(&results[i][2].x(), Column(l0, l1, l2, l3, r2));
+                _mm_store_ps(&results[i][3].x(), Column(l0, l1, l2, l3, r3));
+            }
+        }
+
+    private:
+        // The elements of a column in every lane
+        struct Broadcast
+        {
+            __m128 x, y, z, w;
+
+            explicit inline Broadcast(__m128 column) noexcept
+            {
+                const __m128i bits = _mm_castps_si128(column);
+                x = _mm_castsi128_ps(_mm_shuffle_epi32(bits, _MM_SHUFFLE(0, 0, 0, 0)));
+                y = _mm_castsi128_ps(_mm_shuffle_epi32(bits, _MM_SHUFFLE(1, 1, 1, 1)));
+                z = _mm_castsi128_ps(_mm_shuffle_epi32(bits, _MM_SHUFFLE(2, 2, 2, 2)));
+                w = _mm_castsi128_ps(_mm_shuffle_epi32(bits, _MM_SHUFFLE(3, 3, 3, 3)));
+            }
+
+            inline __m128 Column(__m128 l0, __m128 l1, __m128 l2, __m128 l3) const noexcept
+            {
+                return _mm_add_ps(_mm_add_ps(_mm_mul_ps(l0, x), _mm_mul_ps(l1, y)), _mm_add_ps(_mm_mul_ps(l2, z), _mm_mul_ps(l3, w)));
+            }
+        };
+
+        // left * column, pshufd broadcasts from a single source, so it doesn't need the copy that shufps does without AVX
+        static inline __m128 Column(__m128 l0, __m128 l1, __m128 l2, __m128 l3, __m128 column) noexcept
+        {
+            return Broadcast(column).Column(l0, l1, l2, l3);
+        }
+    };
+}
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "Core.hpp"
+#include "Instrument.hpp"
 
 namespace Pulsarion::Math
 {
     template<std::size_t R, std::size_t C, Arithmetic_t T>
     struct MatrixFunctions; // Only aligned matrices, since unaligned have terrible performance
+
+    template<Arithmetic_t T>
+    struct Affine3x4Functions;
 }
@@ -0,0 +1,68 @@
+#pragma once
+
+#ifndef PULSARION_MATH_MATRIX_HPP
+#include "Matrix.hpp"
+#endif
+
+namespace Pulsarion::Math
+{
+    // Scalar implementation for every size, fully unrolled at compile time.
+    // SIMD specializations of MatrixFunctions inherit from this, so they only have to provide the kernels they speed up.
+    template<std::size_t R, std::size_t C, Arithmetic_t T>
+    struct GenericMatrixFunctions
+    {
+        inline static constexpr void TransposeInPlace(Matrix<R, C, T>& matrix) noexcept
+        requires (R == C)
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix", R, "x", C, "::TransposeInPlace");
+            StaticFor<R>([&](auto i) {
+                StaticFor<C>([&](auto j) {
+                    if constexpr (j > i)
+                        std::swap(matrix.Get(i, j), matrix.Get(j, i));
+                });
+            });
+        }
+
+        inline static constexpr Matrix<C, R, T> Transpose(const Matrix<R, C, T>& matrix) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix", R, "x", C, "::Transpose");
+            Matrix<C, R, T> result;
+            StaticFor<R>([&](auto i) {
+                StaticFor<C>([&](auto j) {
+                    result.Get(j, i) = matrix.Get(i, j);
+                });
+            });
+            return result;
+        }
+
+        template<std::size_t K>
+        inline static constexpr Matrix<R, K, T> Multiply(const Matrix<R, C, T>& left, const Matrix<C, K, T>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix", R, "x", C, "::Multiply");
+            Matrix<R, K, T> result;
+            StaticFor<R>([&](auto i) {
+                StaticFor<K>([&](auto j) {
+                    result.Get(i, j) = [&]<std::size_t... N>(std::index_sequence<N...>) {
+                        return ((left.Get(i, N) * right.Get(N, j)) + ...);
+                    }(std::make_index_sequence<C>{});
+                });
+            });
+            return result;
+        }
+
+        inline static constexpr Vector<R, T, Qualifier::Aligned> VecMultiply(const Matrix<R, C, T>& left, const Vector<C, T, Qualifier::Aligned>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Matrix", R, "x", C, "::VecMultiply");
+            Vector<R, T, Qualifier::Aligned> result;
+            StaticFor<R>([&](auto i) {
+                result[i] = [&]<std::size_t... N>(std::index_sequence<N...>) {
+                    return ((left.Get(i, N) * right[N]) + ...);
+                }(std::make_index_sequence<C>{});
+            });
+            return result;
+        }
+    };
+
+    template<std::size_t R, std::size_t C, Arithmetic_t T>
+    struct MatrixFunctions : GenericMatrixFunctions<R, C, T> {};
+}
@@ -0,0 +1,74 @@
+#pragma once
+#define PULSARION_MATH_MATRIXX_HPP
+
+#include "Core.hpp"
+#include "AlignedAllocator.hpp"
+#include "MatrixXCommon.hpp"
+#include "Parallel.hpp"
+
+#include <cassert>
+
+namespace Pulsarion::Math
+{
+    // Dense matrix with a size chosen at runtime, for problems too big for Matrix<R, C, T>.
+    // It is always column major, and every column starts on a cache line (the stride is padded).
+    template<Arithmetic_t T>
+    class MatrixX
+    {
+    public:
+        static constexpr std::size_t Alignment = 64;
+
+        AlignedVector<T, Alignment> data;
+
+        // ---- Constructors ----
+        inline MatrixX() noexcept = default;
+        inline MatrixX(std::size_t rows, std::size_t columns, const T& value = 0)
+            : data(PaddedStride(rows) * columns, value), m_Rows(rows), m_Columns(columns), m_Stride(PaddedStride(rows)) {}
+
+        inline MatrixX(const MatrixX&) = default;
+        inline MatrixX(MatrixX&&) noexcept = default;
+        inline MatrixX& operator=(const MatrixX&) = default;
+        inline MatrixX& operator=(MatrixX&&) noexcept = default;
+
+        // ---- Accessors ----
+        inline T& Get(std::size_t row, std::size_t column) noexcept { return data[column * m_Stride + row]; }
+        [[nodiscard]] inline const T& Get(std::size_t row, std::size_t column) const noexcept { return data[column * m_Stride + row]; }
+
+        [[nodiscard]] inline std::size_t Rows() const noexcept { return m_Rows; }
+        [[nodiscard]] inline std::size_t Columns() const noexcept { return m_Columns; }
+        // Distance between two columns in elements
+        [[nodiscard]] inline std::size_t Stride() const noexcept { return m_Stride; }
+        [[nodiscard]] inline bool IsSquare() const noexcept { return m_Rows == m_Columns; }
+
+        inline T* Column(std::size_t index) noexcept { return data.data() + index * m_Stride; }
+        [[nodiscard]] inline const T* Column(std::size_t index) const noexcept { return data.data() + index * m_Stride; }
+
+        [[nodiscard]] inline MatrixX Transpose() const
+        {
+            return MatrixXFunctions<T>::Transpose(*this);
+        }
+
+        // Runs on DefaultThreadCount() threads, use MatrixXFunctions<T>::Multiply to choose the thread count
+        inline MatrixX operator*(const MatrixX& other) const
+        {
+            return MatrixXFunctions<T>::Multiply(*this, other, DefaultThreadCount());
+        }
+
+    private:
+        static inline std::size_t PaddedStride(std::size_t rows) noexcept
+        {
+            constexpr std::size_t elements = Alignment / sizeof(T);
+            return (rows + elements - 1) / elements * elements;
+        }
+
+        std::size_t m_Rows = 0;
+        std::size_t m_Columns = 0;
+        std::size_t m_Stride = 0;
+    };
+}
+
+#include "MatrixXGeneric.hpp"
+
+#if defined(PULSARION_MATH_SIMD_SSE4_1) && !defined(PULSARION_MATH_DETERMINISTIC)
+#include "MatrixXSSE.hpp"
+#endif
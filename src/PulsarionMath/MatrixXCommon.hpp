@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+
+namespace Pulsarion::Math
+{
+    template<Arithmetic_t T>
+    struct MatrixXFunctions; // Blocked algorithms for dynamically sized matrices
+
+    template<Arithmetic_t T>
+    struct GemmKernel; // Register blocked micro-kernel and block sizes, specialized per instruction set
+}
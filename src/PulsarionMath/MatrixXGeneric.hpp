@@ -0,0 +1,206 @@
+#pragma once
+
+#ifndef PULSARION_MATH_MATRIXX_HPP
+#include "MatrixX.hpp"
+#endif
+
+#include <algorithm>
+
+namespace Pulsarion::Math
+{
+    // Scalar micro-kernel, the compiler is free to vectorize the fixed size loops
+    template<Arithmetic_t T>
+    struct GemmKernel
+    {
+        // Size of the block of the result kept in registers
+        static constexpr std::size_t MR = 4;
+        static constexpr std::size_t NR = 4;
+        // Cache blocks: a KC x NR panel of the right matrix stays in L1, MC x KC of the left in L2, KC x NC of the right in L3
+        static constexpr std::size_t KC = 256;
+        static constexpr std::size_t MC = 128;
+        static constexpr std::size_t NC = 4096;
+
+        // c[MR x NR] (column major, with a stride of ldc) += a * b, where a is packed as kc columns of MR and b as kc rows of NR
+        inline static void Compute(std::size_t kc, const T* a, const T* b, T* c, std::size_t ldc) noexcept
+        {
+            T ab[MR * NR] = {};
+            for (std::size_t k = 0; k < kc; ++k)
+            {
+                for (std::size_t j = 0; j < NR; ++j)
+                {
+                    for (std::size_t i = 0; i < MR; ++i)
+                        ab[j * MR + i] += a[i] * b[j];
+                }
+                a += MR;
+                b += NR;
+            }
+
+            for (std::size_t j = 0; j < NR; ++j)
+            {
+                for (std::size_t i = 0; i < MR; ++i)
+                    c[j * ldc + i] += ab[j * MR + i];
+            }
+        }
+    };
+
+    template<Arithmetic_t T>
+    struct MatrixXFunctions
+    {
+        // Below this many multiply-adds, starting threads costs more than it saves
+        static constexpr std::size_t ParallelThreshold = 64 * 64 * 64;
+        // Blocks smaller than this (in both dimensions) are transposed directly
+        static constexpr std::size_t TransposeBlock = 32;
+
+        inline static MatrixX<T> Multiply(const MatrixX<T>& left, const MatrixX<T>& right, std::size_t threadCount)
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("MatrixX::Multiply");
+            MatrixX<T> result(left.Rows(), right.Columns());
+            MultiplyAdd(left, right, result, threadCount);
+            return result;
+        }
+
+        // result += left * right
+        inline static void MultiplyAdd(const MatrixX<T>& left, const MatrixX<T>& right, MatrixX<T>& result, std::size_t threadCount)
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("MatrixX::MultiplyAdd");
+            using Kernel = GemmKernel<T>;
+            assert(left.Columns() == right.Rows());
+            assert(result.Rows() == left.Rows() && result.Columns() == right.Columns());
+
+            const std::size_t m = left.Rows();
+            const std::size_t n = right.Columns();
+            const std::size_t k = left.Columns();
+            if (m == 0 || n == 0 || k == 0)
+                return;
+            if (m * n * k < ParallelThreshold)
+                threadCount = 1;
+
+            // Every thread owns a range of columns of the result, so they never write to the same memory
+            ParallelFor(n, Kernel::NR, threadCount, [&](std::size_t begin, std::size_t end, std::size_t) {
+                AlignedVector<T> packedLeft(Kernel::MC * Kernel::KC);
+                AlignedVector<T> packedRight(Kernel::KC * std::min(Kernel::NC, (end - begin + Kernel::NR - 1) / Kernel::NR * Kernel::NR));
+
+                for (std::size_t jc = begin; jc < end; jc += Kernel::NC)
+                {
+                    const std::size_t nc = std::min(Kernel::NC, end - jc);
+                    for (std::size_t pc = 0; pc < k; pc += Kernel::KC)
+                    {
+                        const std::size_t kc = std::min(Kernel::KC, k - pc);
+                        PackRight(right, pc, jc, kc, nc, packedRight.data());
+                        for (std::size_t ic = 0; ic < m; ic += Kernel::MC)
+                        {
+                            const std::size_t mc = std::min(Kernel::MC, m - ic);
+                            PackLeft(left, ic, pc, mc, kc, packedLeft.data());
+                            MacroKernel(mc, nc, kc, packedLeft.data(), packedRight.data(), &result.Get(ic, jc), result.Stride());
+                        }
+                    }
+                }
+            });
+        }
+
+        // Cache oblivious, the matrix is split recursively until the blocks fit in the cache whatever its size
+        inline static MatrixX<T> Transpose(const MatrixX<T>& matrix)
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("MatrixX::Transpose");
+            MatrixX<T> result(matrix.Columns(), matrix.Rows());
+            TransposeRecursive(matrix, result, 0, matrix.Rows(), 0, matrix.Columns());
+            return result;
+        }
+
+    private:
+        // Rows [ic, ic + mc) and columns [pc, pc + kc) of left, as panels of MR rows (zero padded), each stored k by k
+        inline static void PackLeft(const MatrixX<T>& left, std::size_t ic, std::size_t pc, std::size_t mc, std::size_t kc, T* packed) noexcept
+        {
+            using Kernel = GemmKernel<T>;
+            for (std::size_t ir = 0; ir < mc; ir += Kernel::MR)
+            {
+                const std::size_t mr = std::min(Kernel::MR, mc - ir);
+                for (std::size_t p = 0; p < kc; ++p)
+                {
+                    const T* column = &left.Get(ic + ir, pc + p);
+                    for (std::size_t i = 0; i < mr; ++i)
+                        packed[i] = column[i];
+                    for (std::size_t i = mr; i < Kernel::MR; ++i)
+                        packed[i] = 0;
+                    packed += Kernel::MR;
+                }
+            }
+        }
+
+        // Rows [pc, pc + kc) and columns [jc, jc + nc) of right, as panels of NR columns (zero padded), each stored k by k
+        inline static void PackRight(const MatrixX<T>& right, std::size_t pc, std::size_t jc, std::size_t kc, std::size_t nc, T* packed) noexcept
+        {
+            using Kernel = GemmKernel<T>;
+            for (std::size_t jr = 0; jr < nc; jr += Kernel::NR)
+            {
+                const std::size_t nr = std::min(Kernel::NR, nc - jr);
+                for (std::size_t p = 0; p < kc; ++p)
+                {
+                    for (std::size_t j = 0; j < nr; ++j)
+                        packed[j] = right.Get(pc + p, jc + jr + j);
+                    for (std::size_t j = nr; j < Kernel::NR; ++j)
+                        packed[j] = 0;
+                    packed += Kernel::NR;
+                }
+            }
+        }
+
+        inline static void MacroKernel(std::size_t mc, std::size_t nc, std::size_t kc, const T* packedLeft, const T* packedRight, T* c, std::size_t ldc) noexcept
+        {
+            using Kernel = GemmKernel<T>;
+            for (std::size_t jr = 0; jr < nc; jr += Kernel::NR)
+            {
+                const std::size_t nr = std::min(Kernel::NR, nc - jr);
+                for (std::size_t ir = 0; ir < mc; ir += Kernel::MR)
+                {
+                    const std::size_t mr = std::min(Kernel::MR, mc - ir);
+                    const T* a = packedLeft + ir * kc;
+                    const T* b = packedRight + jr * kc;
+                    T* tile = c + jr * ldc + ir;
+                    if (mr == Kernel::MR && nr == Kernel::NR)
+                    {
+                        Kernel::Compute(kc, a, b, tile, ldc);
+                        continue;
+                    }
+
+                    // Edge of the matrix, compute a full block and only keep the valid part
+                    alignas(64) T partial[Kernel::MR * Kernel::NR] = {};
+                    Kernel::Compute(kc, a, b, partial, Kernel::MR);
+                    for (std::size_t j = 0; j < nr; ++j)
+                    {
+                        for (std::size_t i = 0; i < mr; ++i)
+                            tile[j * ldc + i] += partial[j * Kernel::MR + i];
+                    }
+                }
+            }
+        }
+
+        inline static void TransposeRecursive(const MatrixX<T>& matrix, MatrixX<T>& result, std::size_t rowBegin, std::size_t rowEnd, std::size_t columnBegin, std::size_t columnEnd) noexcept
+        {
+            const std::size_t rows = rowEnd - rowBegin;
+            const std::size_t columns = columnEnd - columnBegin;
+            if (rows <= TransposeBlock && columns <= TransposeBlock)
+            {
+                for (std::size_t j = columnBegin; j < columnEnd; ++j)
+                {
+                    for (std::size_t i = rowBegin; i < rowEnd; ++i)
+                        result.Get(j, i) = matrix.Get(i, j);
+                }
+                return;
+            }
+
+            if (rows >= columns)
+            {
+                const std::size_t middle = rowBegin + rows / 2;
+                TransposeRecursive(matrix, result, rowBegin, middle, columnBegin, columnEnd);
+                TransposeRecursive(matrix, result, middle, rowEnd, columnBegin, columnEnd);
+            }
+            else
+            {
+                const std::size_t middle = columnBegin + columns / 2;
+                TransposeRecursive(matrix, result, rowBegin, rowEnd, columnBegin, middle);
+                TransposeRecursive(matrix, result, rowBegin, rowEnd, middle, columnEnd);
+            }
+        }
+    };
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#ifndef PULSARION_MATH_MATRIXX_HPP
+#include "MatrixX.hpp"
+#endif
+#include <immintrin.h>
+
+namespace Pulsarion::Math
+{
+    template<>
+    struct GemmKernel<float>
+    {
+        // 8 x 4 block of the result in 8 registers, plus 2 for the left panel and 1 for the broadcast
+        static constexpr std::size_t MR = 8;
+        static constexpr std::size_t NR = 4;
+        static constexpr std::size_t KC = 256;
+        static constexpr std::size_t MC = 128;
+        static constexpr std::size_t NC = 4096;
+
+        // c has to be 16 byte aligned, which the column stride of MatrixX and the block sizes guarantee
+        inline static void Compute(std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc) noexcept
+        {
+            __m128 c00 = _mm_setzero_ps(), c01 = _mm_setzero_ps();
+            __m128 c10 = _mm_setzero_ps(), c11 = _mm_setzero_ps();
+            __m128 c20 = _mm_setzero_ps(), c21 = _mm_setzero_ps();
+            __m128 c30 = _mm_setzero_ps(), c31 = _mm_setzero_ps();
+
+            for (std::size_t k = 0; k < kc; ++k)
+            {
+                __m128 a0 = _mm_load_ps(a);
+                __m128 a1 = _mm_load_ps(a + 4);
+
+                __m128 b0 = _mm_set1_ps(b[0]);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                c00 = _mm_add_ps(c00, _mm_mul_ps(a0, b0));
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                c01 = _mm_add_ps(c01, _mm_mul_ps(a1, b0));
+
+                __m128 b1 = _mm_set1_ps(b[1]);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                c10 = _mm_add_ps(c10, _mm_mul_ps(a0, b1));
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                c11 = _mm_add_ps(c11, _mm_mul_ps(a1, b1));
+
+                __m128 b2 = _mm_set1_ps(b[2]);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                c20 = _mm_add_ps(c20, _mm_mul_ps(a0, b2));
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                c21 = _mm_add_ps(c21, _mm_mul_ps(a1, b2));
+
+                __m128 b3 = _mm_set1_ps(b[3]);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                c30 = _mm_add_ps(c30, _mm_mul_ps(a0, b3));
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                c31 = _mm_add_ps(c31, _mm_mul_ps(a1, b3));
+
+                a += MR;
+                b += NR;
+            }
+
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            _mm_store_ps(c, _mm_add_ps(_mm_load_ps(c), c00));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            _mm_store_ps(c + 4, _mm_add_ps(_mm_load_ps(c + 4), c01));
+            c += ldc;
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            _mm_store_ps(c, _mm_add_ps(_mm_load_ps(c), c10));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            _mm_store_ps(c + 4, _mm_add_ps(_mm_load_ps(c + 4), c11));
+            c += ldc;
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            _mm_store_ps(c, _mm_add_ps(_mm_load_ps(c), c20));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            _mm_store_ps(c + 4, _mm_add_ps(_mm_load_ps(c + 4), c21));
+            c += ldc;
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            _mm_store_ps(c, _mm_add_ps(_mm_load_ps(c), c30));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            _mm_store_ps(c + 4, _mm_add_ps(_mm_load_ps(c + 4), c31));
+        }
+    };
+}
@@ -0,0 +1,121 @@
+#pragma once
+#define PULSARION_MATH_NOISE_HPP
+
+#include "Vector.hpp"
+#include "NoiseCommon.hpp"
+
+#include <algorithm>
+#include <span>
+#include <type_traits>
+
+// Gradient noise over batches of points, 4 points per kernel call.
+// The lattice is hashed with integer multiplies instead of a permutation table, so the SIMD backends don't need gathers,
+// and the seed selects an unrelated noise field. Results are in [-1, 1] (Perlin) or close to it (Simplex).
+namespace Pulsarion::Math
+{
+    template<std::size_t N, Qualifier Q>
+    inline float Perlin(const Vector<N, float, Q>& point, std::uint32_t seed = 0) noexcept
+    {
+        float coordinates[N];
+        for (std::size_t d = 0; d < N; ++d)
+            coordinates[d] = point[d];
+        return ScalarNoise<N>::Perlin(coordinates, seed);
+    }
+
+    template<std::size_t N, Qualifier Q>
+    inline float Simplex(const Vector<N, float, Q>& point, std::uint32_t seed = 0) noexcept
+    {
+        float coordinates[N];
+        for (std::size_t d = 0; d < N; ++d)
+            coordinates[d] = point[d];
+        return ScalarNoise<N>::Simplex(coordinates, seed);
+    }
+
+    namespace Detail
+    {
+        // Calls function(points, out) with the points transposed to [dimension][lane] 4 at a time, the last group is padded
+        template<std::size_t N, Qualifier Q, typename Function>
+        inline void ForEachNoiseGroup(std::span<const Vector<N, float, Q>> points, std::span<float> output, Function&& function) noexcept
+        {
+            for (std::size_t i = 0; i < points.size(); i += 4)
+            {
+                const std::size_t count = std::min<std::size_t>(4, points.size() - i);
+                PULSARION_MATH_ALIGN float group[N][4];
+                PULSARION_MATH_ALIGN float out[4];
+                for (std::size_t j = 0; j < 4; ++j)
+                {
+                    const Vector<N, float, Q>& point = points[i + std::min(j, count - 1)];
+                    for (std::size_t d = 0; d < N; ++d)
+                        group[d][j] = point[d];
+                }
+                function(group, out);
+                std::copy_n(out, count, output.data() + i);
+            }
+        }
+    }
+
+    // ---- Batches ----
+    // The output span has to be at least as big as the input
+    template<std::size_t N, Qualifier Q>
+    inline void Perlin(std::type_identity_t<std::span<const Vector<N, float, Q>>> points, std::span<float> output, std::uint32_t seed = 0) noexcept
+    {
+        Detail::ForEachNoiseGroup<N, Q>(points, output, [&](const float (&group)[N][4], float (&out)[4]) {
+            NoiseFunctions<N>::Perlin(group, seed, out);
+        });
+    }
+
+    template<std::size_t N, Qualifier Q>
+    inline void Simplex(std::type_identity_t<std::span<const Vector<N, float, Q>>> points, std::span<float> output, std::uint32_t seed = 0) noexcept
+    {
+        Detail::ForEachNoiseGroup<N, Q>(points, output, [&](const float (&group)[N][4], float (&out)[4]) {
+            NoiseFunctions<N>::Simplex(group, seed, out);
+        });
+    }
+
+    // Fractal Brownian motion, octaves of noise at increasing frequency (times lacunarity) and decreasing amplitude (times gain),
+    // normalized by the total amplitude so it stays in the range of the noise. Every octave uses its own seed.
+    template<std::size_t N, Qualifier Q>
+    inline void Fbm(NoiseType type, std::type_identity_t<std::span<const Vector<N, float, Q>>> points, std::span<float> output, std::uint32_t octaves = 5,
+                    float lacunarity = 2.0f, float gain = 0.5f, std::uint32_t seed = 0) noexcept
+    {
+        float totalAmplitude = 0.0f;
+        float amplitude = 1.0f;
+        for (std::uint32_t octave = 0; octave < octaves; ++octave, amplitude *= gain)
+            totalAmplitude += amplitude;
+        const float normalization = totalAmplitude > 0.0f ? 1.0f / totalAmplitude : 0.0f;
+
+        Detail::ForEachNoiseGroup<N, Q>(points, output, [&](const float (&group)[N][4], float (&out)[4]) {
+            PULSARION_MATH_ALIGN float scaled[N][4];
+            PULSARION_MATH_ALIGN float octaveValues[4];
+            float frequency = 1.0f;
+            float octaveAmplitude = normalization;
+            for (std::size_t j = 0; j < 4; ++j)
+                out[j] = 0.0f;
+
+            for (std::uint32_t octave = 0; octave < octaves; ++octave)
+            {
+                for (std::size_t d = 0; d < N; ++d)
+                {
+                    for (std::size_t j = 0; j < 4; ++j)
+                        scaled[d][j] = group[d][j] * frequency;
+                }
+
+                if (type == NoiseType::Perlin)
+                    NoiseFunctions<N>::Perlin(scaled, seed + octave, octaveValues);
+                else
+                    NoiseFunctions<N>::Simplex(scaled, seed + octave, octaveValues);
+
+                for (std::size_t j = 0; j < 4; ++j)
+                    out[j] += octaveValues[j] * octaveAmplitude;
+                frequency *= lacunarity;
+                octaveAmplitude *= gain;
+            }
+        });
+    }
+}
+
+#include "NoiseGeneric.hpp"
+
+#ifdef PULSARION_MATH_SIMD_SSE4_1
+#include "NoiseSSE.hpp"
+#endif
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+namespace Pulsarion::Math
+{
+    template<std::size_t D>
+    struct NoiseFunctions; // Noise at 4 points of dimension D at once, stored as points[dimension][lane].
+
+    template<std::size_t D>
+    struct ScalarNoise; // Noise at a single point, the reference for every backend.
+
+    enum class NoiseType
+    {
+        Perlin,
+        Simplex,
+    };
+
+    template<std::size_t D>
+    struct NoiseConstants
+    {
+        static constexpr std::size_t Lanes = 4;
+
+        // Large primes to hash the lattice coordinates with, one per dimension
+        static constexpr std::uint32_t Primes[4] = { 501125321u, 1136930381u, 1720413743u, 1066037191u };
+        static constexpr std::uint32_t HashMultiplier = 0x27D4EB2Du;
+
+        // Skew from the simplex grid to the cubic grid and back, (sqrt(D + 1) - 1) / D and (1 - 1 / sqrt(D + 1)) / D
+        static constexpr float Skew = D == 2 ? 0.366025403784438647f : (D == 3 ? 1.0f / 3.0f : 0.309016994374947424f);
+        static constexpr float Unskew = D == 2 ? 0.211324865405187118f : (D == 3 ? 1.0f / 6.0f : 0.138196601125010515f);
+        // Squared radius of the kernel around every simplex corner
+        static constexpr float SimplexRadius = D == 2 ? 0.5f : 0.6f;
+
+        // Perlin noise is bounded by |gradient| * sqrt(D) / 2, scaled to [-1, 1]
+        static constexpr float PerlinScale = D == 2 ? 0.632455532f : (D == 3 ? 0.816496581f : 0.577350269f);
+        // Measured, the extremes of simplex noise are just under 1 with these
+        static constexpr float SimplexScale = D == 2 ? 40.0f : (D == 3 ? 32.0f : 27.0f);
+    };
+}
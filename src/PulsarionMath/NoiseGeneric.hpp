@@ -0,0 +1,170 @@
+#pragma once
+
+#ifndef PULSARION_MATH_NOISE_HPP
+#include "Noise.hpp"
+#endif
+
+#include <algorithm>
+
+namespace Pulsarion::Math
+{
+    // One point at a time, the SIMD backends compute exactly the same operations lane-wise
+    template<std::size_t D>
+    struct ScalarNoise
+    {
+        using Constants = NoiseConstants<D>;
+
+        static inline float Perlin(const float (&point)[D], std::uint32_t seed) noexcept
+        {
+            std::uint32_t primed[D];
+            float offset[D];
+            float fade[D];
+            for (std::size_t d = 0; d < D; ++d)
+            {
+                const float cell = std::floor(point[d]);
+                primed[d] = static_cast<std::uint32_t>(static_cast<std::int32_t>(cell)) * Constants::Primes[d];
+                offset[d] = point[d] - cell;
+                fade[d] = offset[d] * offset[d] * offset[d] * (offset[d] * (offset[d] * 6.0f - 15.0f) + 10.0f);
+            }
+
+            // Corner c has bit d set when it is on the far side of dimension d
+            float values[1 << D];
+            for (std::size_t c = 0; c < (1u << D); ++c)
+            {
+                std::uint32_t hash = seed;
+                float delta[D];
+                for (std::size_t d = 0; d < D; ++d)
+                {
+                    const bool far = (c >> d) & 1;
+                    hash ^= far ? primed[d] + Constants::Primes[d] : primed[d];
+                    delta[d] = far ? offset[d] - 1.0f : offset[d];
+                }
+                values[c] = Gradient(Hash(hash), delta);
+            }
+
+            // Interpolate along the first dimension, then the next, halving the corners every time
+            for (std::size_t d = 0; d < D; ++d)
+            {
+                const std::size_t count = (1u << D) >> (d + 1);
+                for (std::size_t c = 0; c < count; ++c)
+                    values[c] = values[2 * c] + fade[d] * (values[2 * c + 1] - values[2 * c]);
+            }
+            return values[0] * Constants::PerlinScale;
+        }
+
+        static inline float Simplex(const float (&point)[D], std::uint32_t seed) noexcept
+        {
+            float sum = 0.0f;
+            for (std::size_t d = 0; d < D; ++d)
+                sum += point[d];
+            const float skew = sum * Constants::Skew;
+
+            std::uint32_t primed[D];
+            float cell[D];
+            float cellSum = 0.0f;
+            for (std::size_t d = 0; d < D; ++d)
+            {
+                cell[d] = std::floor(point[d] + skew);
+                primed[d] = static_cast<std::uint32_t>(static_cast<std::int32_t>(cell[d])) * Constants::Primes[d];
+                cellSum += cell[d];
+            }
+            const float unskew = cellSum * Constants::Unskew;
+            float offset[D];
+            for (std::size_t d = 0; d < D; ++d)
+                offset[d] = point[d] - (cell[d] - unskew);
+
+            // The simplex containing the point is walked by stepping along the dimensions from the largest offset down
+            std::uint32_t rank[D] = {};
+            for (std::size_t d = 0; d < D; ++d)
+            {
+                for (std::size_t e = d + 1; e < D; ++e)
+                {
+                    if (offset[d] > offset[e])
+                        ++rank[d];
+                    else
+                        ++rank[e];
+                }
+            }
+
+            float result = 0.0f;
+            for (std::size_t k = 0; k <= D; ++k)
+            {
+                std::uint32_t hash = seed;
+                float delta[D];
+                float t = Constants::SimplexRadius;
+                for (std::size_t d = 0; d < D; ++d)
+                {
+                    const bool step = rank[d] >= D - k;
+                    hash ^= step ? primed[d] + Constants::Primes[d] : primed[d];
+                    delta[d] = offset[d] - (step ? 1.0f : 0.0f) + static_cast<float>(k) * Constants::Unskew;
+                    t -= delta[d] * delta[d];
+                }
+                t = std::max(t, 0.0f);
+                t *= t;
+                result += t * t * Gradient(Hash(hash), delta);
+            }
+            return result * Constants::SimplexScale;
+        }
+
+    private:
+        static inline std::uint32_t Hash(std::uint32_t hash) noexcept
+        {
+            hash *= Constants::HashMultiplier;
+            return hash ^ (hash >> 15);
+        }
+
+        // Dot product with one of a small set of gradients picked by the hash (Perlin's improved noise and Gustavson's 2D/4D sets)
+        static inline float Gradient(std::uint32_t hash, const float (&delta)[D]) noexcept
+        {
+            if constexpr (D == 2)
+            {
+                const float u = (hash & 4) ? delta[1] : delta[0];
+                const float v = (hash & 4) ? delta[0] : delta[1];
+                return ((hash & 1) ? -u : u) + ((hash & 2) ? -2.0f * v : 2.0f * v);
+            }
+            else if constexpr (D == 3)
+            {
+                const std::uint32_t h = hash & 15;
+                const float u = h < 8 ? delta[0] : delta[1];
+                const float v = h < 4 ? delta[1] : ((h & 13) == 12 ? delta[0] : delta[2]);
+                return ((h & 1) ? -u : u) + ((h & 2) ? -v : v);
+            }
+            else
+            {
+                const std::uint32_t h = hash & 31;
+                const float u = h < 24 ? delta[0] : delta[1];
+                const float v = h < 16 ? delta[1] : delta[2];
+                const float w = h < 8 ? delta[2] : delta[3];
+                return ((h & 1) ? -u : u) + ((h & 2) ? -v : v) + ((h & 4) ? -w : w);
+            }
+        }
+    };
+
+    template<std::size_t D>
+    struct NoiseFunctions
+    {
+        static inline void Perlin(const float (&points)[D][4], std::uint32_t seed, float (&out)[4]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Noise", D, "D::Perlin");
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                float point[D];
+                for (std::size_t d = 0; d < D; ++d)
+                    point[d] = points[d][j];
+                out[j] = ScalarNoise<D>::Perlin(point, seed);
+            }
+        }
+
+        static inline void Simplex(const float (&points)[D][4], std::uint32_t seed, float (&out)[4]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Noise", D, "D::Simplex");
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                float point[D];
+                for (std::size_t d = 0; d < D; ++d)
+                    point[d] = points[d][j];
+                out[j] = ScalarNoise<D>::Simplex(point, seed);
+            }
+        }
+    };
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#ifndef PULSARION_MATH_NOISE_HPP
+#include "Noise.hpp"
+#endif
+
+#include <immintrin.h>
+
+namespace Pulsarion::Math
+{
+    // ScalarNoise on 4 points at once, with the same order of operations so the results match it exactly
+    template<std::size_t D>
+    struct NoiseFunctionsSSE
+    {
+        using Constants = NoiseConstants<D>;
+
+        static inline void Perlin(const float (&points)[D][4], std::uint32_t seed, float (&out)[4]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Noise", D, "D::Perlin");
+            __m128i primed[D];
+            __m128 offset[D];
+            __m128 fade[D];
+            for (std::size_t d = 0; d < D; ++d)
+            {
+                __m128 point = _mm_load_ps(points[d]);
+                __m128 cell = _mm_floor_ps(point);
+                primed[d] = _mm_mullo_epi32(_mm_cvtps_epi32(cell), _mm_set1_epi32(static_cast<int>(Constants::Primes[d])));
+                offset[d] = _mm_sub_ps(point, cell);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 cube = _mm_mul_ps(_mm_mul_ps(offset[d], offset[d]), offset[d]);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 polynomial = _mm_add_ps(_mm_mul_ps(offset[d], _mm_sub_ps(_mm_mul_ps(offset[d], _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))), _mm_set1_ps(10.0f));
+                fade[d] = _mm_mul_ps(cube, polynomial);
+            }
+
+            __m128 values[1 << D];
+            for (std::size_t c = 0; c < (1u << D); ++c)
+            {
+                __m128i hash = _mm_set1_epi32(static_cast<int>(seed));
+                __m128 delta[D];
+                for (std::size_t d = 0; d < D; ++d)
+                {
+                    const bool far = (c >> d) & 1;
+                    hash = _mm_xor_si128(hash, far ? _mm_add_epi32(primed[d], _mm_set1_epi32(static_cast<int>(Constants::Primes[d]))) : primed[d]);
+                    delta[d] = far ? _mm_sub_ps(offset[d], _mm_set1_ps(1.0f)) : offset[d];
+                }
+                values[c] = Gradient(Hash(hash), delta);
+            }
+
+            for (std::size_t d = 0; d < D; ++d)
+            {
+                const std::size_t count = (1u << D) >> (d + 1);
+                for (std::size_t c = 0; c < count; ++c)
+                    //NOLINTNEXTLINE(portability-simd-intrinsics)
+                    values[c] = _mm_add_ps(values[2 * c], _mm_mul_ps(fade[d], _mm_sub_ps(values[2 * c + 1], values[2 * c])));
+            }
+            _mm_store_ps(out, _mm_mul_ps(values[0], _mm_set1_ps(Constants::PerlinScale)));
+        }
+
+        static inline void Simplex(const float (&points)[D][4], std::uint32_t seed, float (&out)[4]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Noise", D, "D::Simplex");
+            __m128 point[D];
+            __m128 sum = _mm_setzero_ps();
+            for (std::size_t d = 0; d < D; ++d)
+            {
+                point[d] = _mm_load_ps(points[d]);
+                sum = _mm_add_ps(sum, point[d]);
+            }
+            __m128 skew = _mm_mul_ps(sum, _mm_set1_ps(Constants::Skew));
+
+            __m128i primed[D];
+            __m128 cell[D];
+            __m128 cellSum = _mm_setzero_ps();
+            for (std::size_t d = 0; d < D; ++d)
+            {
+                cell[d] = _mm_floor_ps(_mm_add_ps(point[d], skew));
+                primed[d] = _mm_mullo_epi32(_mm_cvtps_epi32(cell[d]), _mm_set1_epi32(static_cast<int>(Constants::Primes[d])));
+                cellSum = _mm_add_ps(cellSum, cell[d]);
+            }
+            __m128 unskew = _mm_mul_ps(cellSum, _mm_set1_ps(Constants::Unskew));
+            __m128 offset[D];
+            for (std::size_t d = 0; d < D; ++d)
+                offset[d] = _mm_sub_ps(point[d], _mm_sub_ps(cell[d], unskew));
+
+            // Comparison masks are -1, so subtracting one counts it
+            __m128i rank[D];
+            for (std::size_t d = 0; d < D; ++d)
+                rank[d] = _mm_setzero_si128();
+            for (std::size_t d = 0; d < D; ++d)
+            {
+                for (std::size_t e = d + 1; e < D; ++e)
+                {
+                    __m128i greater = _mm_castps_si128(_mm_cmpgt_ps(offset[d], offset[e]));
+                    rank[d] = _mm_sub_epi32(rank[d], greater);
+                    rank[e] = _mm_add_epi32(rank[e], _mm_add_epi32(greater, _mm_set1_epi32(1)));
+                }
+            }
+
+            __m128 result = _mm_setzero_ps();
+            for (std::size_t k = 0; k <= D; ++k)
+            {
+                __m128i hash = _mm_set1_epi32(static_cast<int>(seed));
+                __m128 delta[D];
+                __m128 t = _mm_set1_ps(Constants::SimplexRadius);
+                for (std::size_t d = 0; d < D; ++d)
+                {
+                    __m128i step = _mm_cmpgt_epi32(rank[d], _mm_set1_epi32(static_cast<int>(D - k) - 1));
+                    hash = _mm_xor_si128(hash, _mm_add_epi32(primed[d], _mm_and_si128(step, _mm_set1_epi32(static_cast<int>(Constants::Primes[d])))));
+                    //NOLINTNEXTLINE(portability-simd-intrinsics)
+                    delta[d] = _mm_add_ps(_mm_sub_ps(offset[d], _mm_and_ps(_mm_castsi128_ps(step), _mm_set1_ps(1.0f))), _mm_set1_ps(static_cast<float>(k) * Constants::Unskew));
+                    t = _mm_sub_ps(t, _mm_mul_ps(delta[d], delta[d]));
+                }
+                t = _mm_max_ps(t, _mm_setzero_ps());
+                t = _mm_mul_ps(t, t);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_mul_ps(t, t), Gradient(Hash(hash), delta)));
+            }
+            _mm_store_ps(out, _mm_mul_ps(result, _mm_set1_ps(Constants::SimplexScale)));
+        }
+
+    private:
+        static inline __m128i Hash(__m128i hash) noexcept
+        {
+            hash = _mm_mullo_epi32(hash, _mm_set1_epi32(static_cast<int>(Constants::HashMultiplier)));
+            return _mm_xor_si128(hash, _mm_srli_epi32(hash, 15));
+        }
+
+        // All ones where the bit is set in the hash
+        static inline __m128 BitMask(__m128i hash, int bit) noexcept
+        {
+            return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(hash, _mm_set1_epi32(bit)), _mm_set1_epi32(bit)));
+        }
+
+        // Moves the bit to the sign bit, to negate with an xor
+        static inline __m128 SignBit(__m128i hash, int shift) noexcept
+        {
+            return _mm_castsi128_ps(_mm_and_si128(_mm_slli_epi32(hash, shift), _mm_set1_epi32(static_cast<int>(0x80000000u))));
+        }
+
+        static inline __m128 Gradient(__m128i hash, const __m128 (&delta)[D]) noexcept
+        {
+            if constexpr (D == 2)
+            {
+                __m128 swap = BitMask(hash, 4);
+                __m128 u = _mm_blendv_ps(delta[0], delta[1], swap);
+                __m128 v = _mm_blendv_ps(delta[1], delta[0], swap);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                return _mm_add_ps(_mm_xor_ps(u, SignBit(hash, 31)), _mm_xor_ps(_mm_mul_ps(_mm_set1_ps(2.0f), v), SignBit(hash, 30)));
+            }
+            else if constexpr (D == 3)
+            {
+                __m128 u = _mm_blendv_ps(delta[0], delta[1], BitMask(hash, 8));
+                __m128 twelve = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(hash, _mm_set1_epi32(13)), _mm_set1_epi32(12)));
+                __m128 belowFour = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(hash, _mm_set1_epi32(12)), _mm_setzero_si128()));
+                __m128 v = _mm_blendv_ps(_mm_blendv_ps(delta[2], delta[0], twelve), delta[1], belowFour);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                return _mm_add_ps(_mm_xor_ps(u, SignBit(hash, 31)), _mm_xor_ps(v, SignBit(hash, 30)));
+            }
+            else
+            {
+                __m128i h = _mm_and_si128(hash, _mm_set1_epi32(31));
+                __m128 u = _mm_blendv_ps(delta[0], delta[1], _mm_castsi128_ps(_mm_cmpgt_epi32(h, _mm_set1_epi32(23))));
+                __m128 v = _mm_blendv_ps(delta[1], delta[2], BitMask(h, 16));
+                __m128 w = _mm_blendv_ps(delta[2], delta[3], _mm_castsi128_ps(_mm_cmpgt_epi32(h, _mm_set1_epi32(7))));
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 sum = _mm_add_ps(_mm_xor_ps(u, SignBit(h, 31)), _mm_xor_ps(v, SignBit(h, 30)));
+                return _mm_add_ps(sum, _mm_xor_ps(w, SignBit(h, 29)));
+            }
+        }
+    };
+
+    template<>
+    struct NoiseFunctions<2> : NoiseFunctionsSSE<2> {};
+
+    template<>
+    struct NoiseFunctions<3> : NoiseFunctionsSSE<3> {};
+
+    template<>
+    struct NoiseFunctions<4> : NoiseFunctionsSSE<4> {};
+}
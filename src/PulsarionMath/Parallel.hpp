@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Core.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace Pulsarion::Math
+{
+    // The number of threads used by the parallel kernels when none is given
+    inline std::size_t DefaultThreadCount() noexcept
+    {
+        return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    // Splits [0, count) into at most threadCount contiguous ranges, with every boundary a multiple of granularity,
+    // and calls func(begin, end, threadIndex) for each of them. The first range runs on the calling thread.
+    template<typename Func>
+    inline void ParallelFor(std::size_t count, std::size_t granularity, std::size_t threadCount, Func&& func)
+    {
+        if (count == 0)
+            return;
+
+        const std::size_t chunks = (count + granularity - 1) / granularity;
+        threadCount = std::clamp<std::size_t>(threadCount, 1, chunks);
+        if (threadCount == 1)
+        {
+            func(std::size_t(0), count, std::size_t(0));
+            return;
+        }
+
+        const std::size_t chunksPerThread = chunks / threadCount;
+        const std::size_t remainder = chunks % threadCount;
+        auto rangeBegin = [&](std::size_t thread) {
+            return std::min(count, (thread * chunksPerThread + std::min(thread, remainder)) * granularity);
+        };
+
+        std::vector<std::jthread> threads;
+        threads.reserve(threadCount - 1);
+        for (std::size_t thread = 1; thread < threadCount; ++thread)
+            threads.emplace_back([&func, begin = rangeBegin(thread), end = rangeBegin(thread + 1), thread]() { func(begin, end, thread); });
+        func(std::size_t(0), rangeBegin(1), std::size_t(0));
+    }
+}
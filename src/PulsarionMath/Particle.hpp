@@ -0,0 +1,235 @@
+#pragma once
+#define PULSARION_MATH_PARTICLE_HPP
+
+#include "Vector.hpp"
+#include "Parallel.hpp"
+#include "ParticleCommon.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// Particle integration and position based distance constraints (cloth, ropes, soft bodies) over SoA streams: every quantity
+// (positions, velocities, forces) is three separate x, y and z arrays, so the kernels load 4 particles per register without shuffles.
+// Inverse masses are optional (empty means 1 for every particle), a particle with inverse mass 0 is pinned: forces and gravity don't move it.
+//
+// Constraints are projected in batches that touch every particle at most once (a greedy coloring of the constraint graph),
+// so the constraints of a batch are independent: the kernels project several at a time and a batch can be split across threads,
+// and the result doesn't depend on the thread count.
+namespace Pulsarion::Math
+{
+    // The x, y and z arrays of one quantity of the particles, S is T or const T. An empty stream is an absent one
+    template<typename S>
+    struct ParticleStream
+    {
+        std::span<S> x;
+        std::span<S> y;
+        std::span<S> z;
+
+        [[nodiscard]] inline std::size_t Size() const noexcept { return x.size(); }
+        [[nodiscard]] inline bool Empty() const noexcept { return x.empty(); }
+        [[nodiscard]] inline std::span<S> operator[](std::size_t axis) const noexcept { return axis == 0 ? x : (axis == 1 ? y : z); }
+
+        [[nodiscard]] inline ParticleStream Subspan(std::size_t offset, std::size_t count) const noexcept
+        {
+            return { x.subspan(offset, count), y.subspan(offset, count), z.subspan(offset, count) };
+        }
+
+        inline operator ParticleStream<const S>() const noexcept requires (!std::is_const_v<S>) { return { x, y, z }; }
+    };
+
+    template<FloatingPoint_t T>
+    struct IntegrationSettings
+    {
+        T timeStep = T(1) / T(60);
+        Vector<3, T, Qualifier::Packed> gravity = Vector<3, T, Qualifier::Packed>(T(0), T(0), T(0)); // An acceleration
+        T damping = T(0); // Velocities are scaled by max(0, 1 - damping * timeStep) every step
+        // Positions are clamped to the box, a clamped component of the velocity is zeroed (Verlet: the clamp removes it)
+        Vector<3, T, Qualifier::Packed> boundsMin = Vector<3, T, Qualifier::Packed>(-std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity());
+        Vector<3, T, Qualifier::Packed> boundsMax = Vector<3, T, Qualifier::Packed>(std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity());
+
+        [[nodiscard]] inline T DampingFactor() const noexcept { return std::max(T(0), T(1) - damping * timeStep); }
+    };
+
+    // Keeps particles a and b restLength apart
+    template<FloatingPoint_t T>
+    struct DistanceConstraint
+    {
+        std::uint32_t a;
+        std::uint32_t b;
+        T restLength;
+    };
+
+    // Constraints reordered by batch, no two constraints of a batch share a particle
+    template<FloatingPoint_t T>
+    struct ConstraintBatches
+    {
+        std::vector<DistanceConstraint<T>> constraints;
+        std::vector<std::uint32_t> starts; // Batch i is [starts[i], starts[i + 1])
+
+        [[nodiscard]] inline std::size_t BatchCount() const noexcept { return starts.empty() ? 0 : starts.size() - 1; }
+
+        [[nodiscard]] inline std::span<const DistanceConstraint<T>> Batch(std::size_t batch) const noexcept
+        {
+            return std::span<const DistanceConstraint<T>>(constraints).subspan(starts[batch], starts[batch + 1] - starts[batch]);
+        }
+    };
+
+    namespace Detail
+    {
+        // One component, every kernel steps particles with these (the SIMD ones in the same order of operations)
+        template<FloatingPoint_t T>
+        inline T ParticleAcceleration(const T* force, T inverseMass, T gravity) noexcept
+        {
+            const T acceleration = inverseMass != T(0) ? gravity : T(0);
+            return force != nullptr ? *force * inverseMass + acceleration : acceleration;
+        }
+
+        template<FloatingPoint_t T>
+        inline void SemiImplicitEulerStep(T& position, T& velocity, T acceleration, T timeStep, T damping, T low, T high) noexcept
+        {
+            velocity = (velocity + acceleration * timeStep) * damping;
+            const T moved = position + velocity * timeStep;
+            position = std::min(std::max(moved, low), high);
+            if (position != moved)
+                velocity = T(0);
+        }
+
+        template<FloatingPoint_t T>
+        inline void VerletStep(T& position, T& previous, T acceleration, T timeStepSquared, T damping, T low, T high) noexcept
+        {
+            const T moved = position + (position - previous) * damping + acceleration * timeStepSquared;
+            previous = position;
+            position = std::min(std::max(moved, low), high);
+        }
+
+        // Moves both particles along the constraint by their share of the error (their inverse mass over the sum of both).
+        // inverseMasses is null for unit masses
+        template<FloatingPoint_t T>
+        inline void ProjectDistance(T* x, T* y, T* z, const T* inverseMasses, const DistanceConstraint<T>& constraint, T stiffness) noexcept
+        {
+            const T dx = x[constraint.b] - x[constraint.a], dy = y[constraint.b] - y[constraint.a], dz = z[constraint.b] - z[constraint.a];
+            const T length = std::sqrt(dx * dx + dy * dy + dz * dz);
+            const T wa = inverseMasses != nullptr ? inverseMasses[constraint.a] : T(1);
+            const T wb = inverseMasses != nullptr ? inverseMasses[constraint.b] : T(1);
+            const T weight = wa + wb;
+            const T scale = length > T(0) && weight > T(0) ? stiffness * (length - constraint.restLength) / (weight * length) : T(0);
+            x[constraint.a] += wa * scale * dx;
+            y[constraint.a] += wa * scale * dy;
+            z[constraint.a] += wa * scale * dz;
+            x[constraint.b] -= wb * scale * dx;
+            y[constraint.b] -= wb * scale * dy;
+            z[constraint.b] -= wb * scale * dz;
+        }
+    }
+
+    // v += (force * inverseMass + gravity) * timeStep, damped, then p += v * timeStep, clamped to the bounds.
+    // forces and inverseMasses can be empty (no forces, unit masses)
+    template<FloatingPoint_t T>
+    inline void IntegrateSemiImplicitEuler(ParticleStream<T> positions, ParticleStream<T> velocities, std::type_identity_t<ParticleStream<const T>> forces,
+                                           std::type_identity_t<std::span<const T>> inverseMasses, const IntegrationSettings<T>& settings, std::size_t threadCount = 1)
+    {
+        assert(velocities.Size() == positions.Size());
+        assert(forces.Empty() || forces.Size() == positions.Size());
+        assert(inverseMasses.empty() || inverseMasses.size() == positions.Size());
+        ParallelFor(positions.Size(), ParticleConstants::ParallelGranularity, threadCount, [&](std::size_t begin, std::size_t end, std::size_t) {
+            const std::size_t count = end - begin;
+            ParticleFunctions<T>::SemiImplicitEuler(positions.Subspan(begin, count), velocities.Subspan(begin, count), forces.Empty() ? forces : forces.Subspan(begin, count),
+                                                    inverseMasses.empty() ? inverseMasses : inverseMasses.subspan(begin, count), settings);
+        });
+    }
+
+    // Position Verlet: p' = p + (p - previous) * damping + (force * inverseMass + gravity) * timeStep^2, clamped to the bounds,
+    // previous = p, p = p'. The timeStep has to stay the same between steps. forces and inverseMasses can be empty
+    template<FloatingPoint_t T>
+    inline void IntegrateVerlet(ParticleStream<T> positions, ParticleStream<T> previousPositions, std::type_identity_t<ParticleStream<const T>> forces,
+                                std::type_identity_t<std::span<const T>> inverseMasses, const IntegrationSettings<T>& settings, std::size_t threadCount = 1)
+    {
+        assert(previousPositions.Size() == positions.Size());
+        assert(forces.Empty() || forces.Size() == positions.Size());
+        assert(inverseMasses.empty() || inverseMasses.size() == positions.Size());
+        ParallelFor(positions.Size(), ParticleConstants::ParallelGranularity, threadCount, [&](std::size_t begin, std::size_t end, std::size_t) {
+            const std::size_t count = end - begin;
+            ParticleFunctions<T>::Verlet(positions.Subspan(begin, count), previousPositions.Subspan(begin, count), forces.Empty() ? forces : forces.Subspan(begin, count),
+                                         inverseMasses.empty() ? inverseMasses : inverseMasses.subspan(begin, count), settings);
+        });
+    }
+
+    // Greedy coloring: each constraint, in order, takes the first batch neither of its particles is in yet. Batches are tried 64 at a time
+    // with a bit mask per particle, the constraints that find none go on to the next 64. The order within a batch is the original order
+    template<FloatingPoint_t T>
+    inline ConstraintBatches<T> BatchConstraints(std::type_identity_t<std::span<const DistanceConstraint<T>>> constraints, std::size_t particleCount)
+    {
+        PULSARION_MATH_INSTRUMENT_KERNEL("Particle::BatchConstraints");
+        std::vector<std::uint32_t> batchOf(constraints.size());
+        std::vector<std::uint32_t> pending(constraints.size());
+        for (std::size_t i = 0; i < constraints.size(); ++i)
+            pending[i] = static_cast<std::uint32_t>(i);
+        std::vector<std::uint32_t> next;
+        std::vector<std::uint64_t> used(particleCount);
+        std::uint32_t batchCount = 0;
+        for (std::uint32_t base = 0; !pending.empty(); base += 64)
+        {
+            std::fill(used.begin(), used.end(), 0);
+            next.clear();
+            for (const std::uint32_t i : pending)
+            {
+                const DistanceConstraint<T>& constraint = constraints[i];
+                const std::uint64_t free = ~(used[constraint.a] | used[constraint.b]);
+                if (free == 0)
+                {
+                    next.push_back(i);
+                    continue;
+                }
+                const auto bit = static_cast<std::uint32_t>(std::countr_zero(free));
+                used[constraint.a] |= std::uint64_t(1) << bit;
+                used[constraint.b] |= std::uint64_t(1) << bit;
+                batchOf[i] = base + bit;
+                batchCount = std::max(batchCount, base + bit + 1);
+            }
+            pending.swap(next);
+        }
+
+        // Counting sort by batch
+        ConstraintBatches<T> result;
+        result.starts.assign(batchCount + 1, 0);
+        for (const std::uint32_t batch : batchOf)
+            ++result.starts[batch + 1];
+        for (std::size_t batch = 0; batch < batchCount; ++batch)
+            result.starts[batch + 1] += result.starts[batch];
+        std::vector<std::uint32_t> slot(result.starts.begin(), result.starts.end() - 1);
+        result.constraints.resize(constraints.size());
+        for (std::size_t i = 0; i < constraints.size(); ++i)
+            result.constraints[slot[batchOf[i]]++] = constraints[i];
+        return result;
+    }
+
+    // Projects every constraint once, a batch after the other (Gauss-Seidel across batches, Jacobi within them, which is the same
+    // as the constraints of a batch are independent). stiffness in [0, 1] is the fraction of the error removed per projection.
+    // Call it several times per step (the solver iterations). inverseMasses can be empty (unit masses)
+    template<FloatingPoint_t T>
+    inline void ProjectDistanceConstraints(ParticleStream<T> positions, std::type_identity_t<std::span<const T>> inverseMasses, const ConstraintBatches<T>& batches,
+                                           T stiffness, std::size_t threadCount = 1)
+    {
+        assert(inverseMasses.empty() || inverseMasses.size() == positions.Size());
+        for (std::size_t batch = 0; batch < batches.BatchCount(); ++batch)
+        {
+            const auto constraints = batches.Batch(batch);
+            ParallelFor(constraints.size(), ParticleConstants::ConstraintGranularity, threadCount, [&](std::size_t begin, std::size_t end, std::size_t) {
+                ParticleFunctions<T>::ProjectDistances(positions, inverseMasses, constraints.subspan(begin, end - begin), stiffness);
+            });
+        }
+    }
+}
+
+#include "ParticleGeneric.hpp"
+
+#ifdef PULSARION_MATH_SIMD_SSE4_1
+#include "ParticleSSE.hpp"
+#endif
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct ParticleFunctions; // Integration and constraint projection over SoA particle streams.
+
+    struct ParticleConstants
+    {
+        // Particles per thread below which the integrators don't start threads
+        static constexpr std::size_t ParallelGranularity = 16 * 1024;
+        // Constraints of a batch per thread below which the projection doesn't start threads
+        static constexpr std::size_t ConstraintGranularity = 8 * 1024;
+    };
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#ifndef PULSARION_MATH_PARTICLE_HPP
+#include "Particle.hpp"
+#endif
+
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct ParticleFunctions
+    {
+        static inline void SemiImplicitEuler(ParticleStream<T> positions, ParticleStream<T> velocities, ParticleStream<const T> forces, std::span<const T> inverseMasses,
+                                             const IntegrationSettings<T>& settings) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Particle::SemiImplicitEuler");
+            const T damping = settings.DampingFactor();
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                const std::span<T> position = positions[axis], velocity = velocities[axis];
+                const std::span<const T> force = forces[axis];
+                for (std::size_t i = 0; i < position.size(); ++i)
+                {
+                    const T acceleration = Detail::ParticleAcceleration(force.empty() ? nullptr : &force[i], inverseMasses.empty() ? T(1) : inverseMasses[i], settings.gravity[axis]);
+                    Detail::SemiImplicitEulerStep(position[i], velocity[i], acceleration, settings.timeStep, damping, settings.boundsMin[axis], settings.boundsMax[axis]);
+                }
+            }
+        }
+
+        static inline void Verlet(ParticleStream<T> positions, ParticleStream<T> previousPositions, ParticleStream<const T> forces, std::span<const T> inverseMasses,
+                                  const IntegrationSettings<T>& settings) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Particle::Verlet");
+            const T damping = settings.DampingFactor();
+            const T timeStepSquared = settings.timeStep * settings.timeStep;
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                const std::span<T> position = positions[axis], previous = previousPositions[axis];
+                const std::span<const T> force = forces[axis];
+                for (std::size_t i = 0; i < position.size(); ++i)
+                {
+                    const T acceleration = Detail::ParticleAcceleration(force.empty() ? nullptr : &force[i], inverseMasses.empty() ? T(1) : inverseMasses[i], settings.gravity[axis]);
+                    Detail::VerletStep(position[i], previous[i], acceleration, timeStepSquared, damping, settings.boundsMin[axis], settings.boundsMax[axis]);
+                }
+            }
+        }
+
+        // The constraints are independent (a range of a batch)
+        static inline void ProjectDistances(ParticleStream<T> positions, std::span<const T> inverseMasses, std::span<const DistanceConstraint<T>> constraints, T stiffness) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Particle::ProjectDistances");
+            const T* w = inverseMasses.empty() ? nullptr : inverseMasses.data();
+            for (const DistanceConstraint<T>& constraint : constraints)
+                Detail::ProjectDistance(positions.x.data(), positions.y.data(), positions.z.data(), w, constraint, stiffness);
+        }
+    };
+}
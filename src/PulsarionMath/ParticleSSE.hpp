@@ -0,0 +1,192 @@
+#pragma once
+
+#ifndef PULSARION_MATH_PARTICLE_HPP
+#include "Particle.hpp"
+#endif
+
+#include <immintrin.h>
+
+namespace Pulsarion::Math
+{
+    // The steps of Detail, 4 particles per register and a component at a time, in the same order of operations, so the results
+    // are the ones of the scalar steps. The absent streams are template parameters, the loops don't test them.
+    // The projection gathers the 2 particles of 4 constraints into registers and scatters them back, a batch has no 2 constraints
+    // on the same particle, so the 4 lanes never write the same one.
+    template<>
+    struct ParticleFunctions<float>
+    {
+        static inline void SemiImplicitEuler(ParticleStream<float> positions, ParticleStream<float> velocities, ParticleStream<const float> forces,
+                                             std::span<const float> inverseMasses, const IntegrationSettings<float>& settings) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Particle::SemiImplicitEuler");
+            WithStreams(!forces.Empty(), !inverseMasses.empty(), [&]<bool Forces, bool Masses>() {
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                    EulerAxis<Forces, Masses>(positions[axis], velocities[axis], forces[axis], inverseMasses, settings, axis);
+            });
+        }
+
+        static inline void Verlet(ParticleStream<float> positions, ParticleStream<float> previousPositions, ParticleStream<const float> forces,
+                                  std::span<const float> inverseMasses, const IntegrationSettings<float>& settings) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Particle::Verlet");
+            WithStreams(!forces.Empty(), !inverseMasses.empty(), [&]<bool Forces, bool Masses>() {
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                    VerletAxis<Forces, Masses>(positions[axis], previousPositions[axis], forces[axis], inverseMasses, settings, axis);
+            });
+        }
+
+        static inline void ProjectDistances(ParticleStream<float> positions, std::span<const float> inverseMasses, std::span<const DistanceConstraint<float>> constraints, float stiffness) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Particle::ProjectDistances");
+            if (inverseMasses.empty())
+                Project<false>(positions, nullptr, constraints, stiffness);
+            else
+                Project<true>(positions, inverseMasses.data(), constraints, stiffness);
+        }
+
+    private:
+        // w is null for unit masses
+        template<bool Masses>
+        static inline void Project(ParticleStream<float> positions, const float* w, std::span<const DistanceConstraint<float>> constraints, float stiffness) noexcept
+        {
+            float* x = positions.x.data();
+            float* y = positions.y.data();
+            float* z = positions.z.data();
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 k = _mm_set1_ps(stiffness);
+            std::size_t i = 0;
+            for (; i + 4 <= constraints.size(); i += 4)
+            {
+                const DistanceConstraint<float>* c = constraints.data() + i;
+                const __m128 xa = _mm_setr_ps(x[c[0].a], x[c[1].a], x[c[2].a], x[c[3].a]);
+                const __m128 ya = _mm_setr_ps(y[c[0].a], y[c[1].a], y[c[2].a], y[c[3].a]);
+                const __m128 za = _mm_setr_ps(z[c[0].a], z[c[1].a], z[c[2].a], z[c[3].a]);
+                const __m128 xb = _mm_setr_ps(x[c[0].b], x[c[1].b], x[c[2].b], x[c[3].b]);
+                const __m128 yb = _mm_setr_ps(y[c[0].b], y[c[1].b], y[c[2].b], y[c[3].b]);
+                const __m128 zb = _mm_setr_ps(z[c[0].b], z[c[1].b], z[c[2].b], z[c[3].b]);
+                const __m128 wa = Masses ? _mm_setr_ps(w[c[0].a], w[c[1].a], w[c[2].a], w[c[3].a]) : _mm_set1_ps(1.0f);
+                const __m128 wb = Masses ? _mm_setr_ps(w[c[0].b], w[c[1].b], w[c[2].b], w[c[3].b]) : _mm_set1_ps(1.0f);
+                const __m128 rest = _mm_setr_ps(c[0].restLength, c[1].restLength, c[2].restLength, c[3].restLength);
+
+                const __m128 dx = _mm_sub_ps(xb, xa), dy = _mm_sub_ps(yb, ya), dz = _mm_sub_ps(zb, za);
+                const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)));
+                const __m128 weight = _mm_add_ps(wa, wb);
+                // Lanes with no length or weight divide by 0, the mask zeroes them
+                const __m128 valid = _mm_and_ps(_mm_cmpgt_ps(length, zero), _mm_cmpgt_ps(weight, zero));
+                const __m128 scale = _mm_and_ps(_mm_div_ps(_mm_mul_ps(k, _mm_sub_ps(length, rest)), _mm_mul_ps(weight, length)), valid);
+                const __m128 sa = _mm_mul_ps(wa, scale), sb = _mm_mul_ps(wb, scale);
+
+                PULSARION_MATH_ALIGN float result[6][4];
+                _mm_store_ps(result[0], _mm_add_ps(xa, _mm_mul_ps(sa, dx)));
+                _mm_store_ps(result[1], _mm_add_ps(ya, _mm_mul_ps(sa, dy)));
+                _mm_store_ps(result[2], _mm_add_ps(za, _mm_mul_ps(sa, dz)));
+                _mm_store_ps(result[3], _mm_sub_ps(xb, _mm_mul_ps(sb, dx)));
+                _mm_store_ps(result[4], _mm_sub_ps(yb, _mm_mul_ps(sb, dy)));
+                _mm_store_ps(result[5], _mm_sub_ps(zb, _mm_mul_ps(sb, dz)));
+                for (std::size_t lane = 0; lane < 4; ++lane)
+                {
+                    x[c[lane].a] = result[0][lane];
+                    y[c[lane].a] = result[1][lane];
+                    z[c[lane].a] = result[2][lane];
+                    x[c[lane].b] = result[3][lane];
+                    y[c[lane].b] = result[4][lane];
+                    z[c[lane].b] = result[5][lane];
+                }
+            }
+            for (; i < constraints.size(); ++i)
+                Detail::ProjectDistance(x, y, z, w, constraints[i], stiffness);
+        }
+
+        template<typename F>
+        static inline void WithStreams(bool forces, bool masses, F&& func) noexcept
+        {
+            if (forces)
+            {
+                if (masses)
+                    func.template operator()<true, true>();
+                else
+                    func.template operator()<true, false>();
+            }
+            else
+            {
+                if (masses)
+                    func.template operator()<false, true>();
+                else
+                    func.template operator()<false, false>();
+            }
+        }
+
+        // Detail::ParticleAcceleration of 4 particles
+        template<bool Forces, bool Masses>
+        static inline __m128 Acceleration(const float* force, const float* inverseMasses, std::size_t i, __m128 gravity) noexcept
+        {
+            const __m128 inverseMass = Masses ? _mm_loadu_ps(inverseMasses + i) : _mm_set1_ps(1.0f);
+            const __m128 acceleration = _mm_and_ps(gravity, _mm_cmpneq_ps(inverseMass, _mm_setzero_ps()));
+            if constexpr (Forces)
+                return _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(force + i), inverseMass), acceleration);
+            else
+                return acceleration;
+        }
+
+        // min(max(value, low), high) with the operands in the order that picks the same value as std::min and std::max
+        static inline __m128 Clamp(__m128 value, __m128 low, __m128 high) noexcept
+        {
+            return _mm_min_ps(high, _mm_max_ps(low, value));
+        }
+
+        template<bool Forces, bool Masses>
+        static inline void EulerAxis(std::span<float> position, std::span<float> velocity, std::span<const float> force, std::span<const float> inverseMasses,
+                                     const IntegrationSettings<float>& settings, std::size_t axis) noexcept
+        {
+            const float damping = settings.DampingFactor();
+            const __m128 timeStep = _mm_set1_ps(settings.timeStep);
+            const __m128 dampingFactor = _mm_set1_ps(damping);
+            const __m128 gravity = _mm_set1_ps(settings.gravity[axis]);
+            const __m128 low = _mm_set1_ps(settings.boundsMin[axis]);
+            const __m128 high = _mm_set1_ps(settings.boundsMax[axis]);
+            std::size_t i = 0;
+            for (; i + 4 <= position.size(); i += 4)
+            {
+                const __m128 acceleration = Acceleration<Forces, Masses>(force.data(), inverseMasses.data(), i, gravity);
+                __m128 v = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(velocity.data() + i), _mm_mul_ps(acceleration, timeStep)), dampingFactor);
+                const __m128 moved = _mm_add_ps(_mm_loadu_ps(position.data() + i), _mm_mul_ps(v, timeStep));
+                const __m128 p = Clamp(moved, low, high);
+                v = _mm_andnot_ps(_mm_cmpneq_ps(p, moved), v);
+                _mm_storeu_ps(position.data() + i, p);
+                _mm_storeu_ps(velocity.data() + i, v);
+            }
+            for (; i < position.size(); ++i)
+            {
+                const float acceleration = Detail::ParticleAcceleration(Forces ? &force[i] : nullptr, Masses ? inverseMasses[i] : 1.0f, settings.gravity[axis]);
+                Detail::SemiImplicitEulerStep(position[i], velocity[i], acceleration, settings.timeStep, damping, settings.boundsMin[axis], settings.boundsMax[axis]);
+            }
+        }
+
+        template<bool Forces, bool Masses>
+        static inline void VerletAxis(std::span<float> position, std::span<float> previous, std::span<const float> force, std::span<const float> inverseMasses,
+                                      const IntegrationSettings<float>& settings, std::size_t axis) noexcept
+        {
+            const float damping = settings.DampingFactor();
+            const float timeStepSquared = settings.timeStep * settings.timeStep;
+            const __m128 dampingFactor = _mm_set1_ps(damping);
+            const __m128 timeStep2 = _mm_set1_ps(timeStepSquared);
+            const __m128 gravity = _mm_set1_ps(settings.gravity[axis]);
+            const __m128 low = _mm_set1_ps(settings.boundsMin[axis]);
+            const __m128 high = _mm_set1_ps(settings.boundsMax[axis]);
+            std::size_t i = 0;
+            for (; i + 4 <= position.size(); i += 4)
+            {
+                const __m128 acceleration = Acceleration<Forces, Masses>(force.data(), inverseMasses.data(), i, gravity);
+                const __m128 p = _mm_loadu_ps(position.data() + i);
+                const __m128 moved = _mm_add_ps(_mm_add_ps(p, _mm_mul_ps(_mm_sub_ps(p, _mm_loadu_ps(previous.data() + i)), dampingFactor)), _mm_mul_ps(acceleration, timeStep2));
+                _mm_storeu_ps(previous.data() + i, p);
+                _mm_storeu_ps(position.data() + i, Clamp(moved, low, high));
+            }
+            for (; i < position.size(); ++i)
+            {
+                const float acceleration = Detail::ParticleAcceleration(Forces ? &force[i] : nullptr, Masses ? inverseMasses[i] : 1.0f, settings.gravity[axis]);
+                Detail::VerletStep(position[i], previous[i], acceleration, timeStepSquared, damping, settings.boundsMin[axis], settings.boundsMax[axis]);
+            }
+        }
+    };
+}
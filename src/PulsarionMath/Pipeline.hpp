@@ -0,0 +1,120 @@
+#pragma once
+#define PULSARION_MATH_PIPELINE_HPP
+
+#include "Vector.hpp"
+#include "Matrix.hpp"
+#include "Parallel.hpp"
+#include "PipelineCommon.hpp"
+
+#include <cassert>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+// Fused passes over spans of vectors: Pipeline(in).Transform(m).Normalize().Clamp(lo, hi).Into(out) reads every vector once,
+// runs it through all the stages in registers and writes it once, instead of a loop over memory per stage.
+// The stages are types, so the chain is built at compile time and the loop of Into is specialized for it.
+// Transform multiplies like TransformPoints (3 component vectors have an implicit w of 1), Normalize maps zero vectors to zero,
+// and Clamp maps NaN to the lower bound like the one in VectorMask.hpp. The output can be the input itself, but no other overlap is allowed.
+namespace Pulsarion::Math
+{
+    namespace PipelineStages
+    {
+        template<Arithmetic_t T>
+        struct Transform
+        {
+            Matrix<4, 4, T> matrix;
+        };
+
+        struct Normalize {};
+
+        template<std::size_t N, Arithmetic_t T, Qualifier Q>
+        struct Clamp
+        {
+            Vector<N, T, Q> min;
+            Vector<N, T, Q> max;
+        };
+
+        template<Arithmetic_t T>
+        struct Scale
+        {
+            T factor;
+        };
+
+        template<std::size_t N, Arithmetic_t T, Qualifier Q>
+        struct Add
+        {
+            Vector<N, T, Q> offset;
+        };
+    }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q, typename... Stages>
+    requires (N == 3 || N == 4)
+    class SpanPipeline
+    {
+    public:
+        using V = Vector<N, T, Q>;
+
+        explicit inline SpanPipeline(std::span<const V> input, std::tuple<Stages...> stages = {}) noexcept : m_Input(input), m_Stages(stages) {}
+
+        // ---- Stages ----
+        [[nodiscard]] inline auto Transform(const Matrix<4, 4, T>& matrix) const noexcept { return Then(PipelineStages::Transform<T>{ matrix }); }
+
+        [[nodiscard]] inline auto Normalize() const noexcept
+        requires FloatingPoint_t<T> { return Then(PipelineStages::Normalize{}); }
+
+        [[nodiscard]] inline auto Clamp(const V& min, const V& max) const noexcept { return Then(PipelineStages::Clamp<N, T, Q>{ min, max }); }
+        [[nodiscard]] inline auto Clamp(T min, T max) const noexcept { return Clamp(V(min), V(max)); }
+
+        [[nodiscard]] inline auto Scale(T factor) const noexcept { return Then(PipelineStages::Scale<T>{ factor }); }
+
+        [[nodiscard]] inline auto Add(const V& offset) const noexcept { return Then(PipelineStages::Add<N, T, Q>{ offset }); }
+
+        // ---- Execution ----
+        // Runs the stages over the input, split into contiguous ranges over up to threadCount threads
+        inline void Into(std::type_identity_t<std::span<V>> output, std::size_t threadCount = 1) const
+        {
+            assert(output.size() == m_Input.size());
+            ParallelFor(m_Input.size(), PipelineConstants::ParallelGranularity, threadCount, [&](std::size_t begin, std::size_t end, std::size_t) {
+                PipelineFunctions<N, T, Q>::Run(m_Stages, m_Input.subspan(begin, end - begin), output.subspan(begin, end - begin));
+            });
+        }
+
+    private:
+        template<typename Stage>
+        [[nodiscard]] inline SpanPipeline<N, T, Q, Stages..., Stage> Then(const Stage& stage) const noexcept
+        {
+            return SpanPipeline<N, T, Q, Stages..., Stage>(m_Input, std::tuple_cat(m_Stages, std::tuple<Stage>(stage)));
+        }
+
+        std::span<const V> m_Input;
+        std::tuple<Stages...> m_Stages;
+    };
+
+    namespace Detail
+    {
+        template<typename V>
+        struct PipelineOf;
+
+        template<std::size_t N, Arithmetic_t T, Qualifier Q>
+        struct PipelineOf<Vector<N, T, Q>>
+        {
+            using Type = SpanPipeline<N, T, Q>;
+        };
+    }
+
+    // A pipeline without stages over a contiguous range of vectors (a span, a std::vector, ...), Into then only copies
+    template<std::ranges::contiguous_range R>
+    inline auto Pipeline(const R& input) noexcept -> typename Detail::PipelineOf<std::remove_cv_t<std::ranges::range_value_t<R>>>::Type
+    {
+        using V = std::remove_cv_t<std::ranges::range_value_t<R>>;
+        return typename Detail::PipelineOf<V>::Type(std::span<const V>(std::ranges::data(input), std::ranges::size(input)));
+    }
+}
+
+#include "PipelineGeneric.hpp"
+
+#if defined(PULSARION_MATH_SIMD_SSE4_1) && !defined(PULSARION_MATH_DETERMINISTIC)
+#include "PipelineSSE.hpp"
+#endif
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+#include "Qualifier.hpp"
+
+namespace Pulsarion::Math
+{
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    struct PipelineFunctions; // Runs a chain of per-vector stages over a span in a single pass.
+
+    struct PipelineConstants
+    {
+        // Vectors per thread below which a pipeline doesn't start threads
+        static constexpr std::size_t ParallelGranularity = 16 * 1024;
+    };
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#ifndef PULSARION_MATH_PIPELINE_HPP
+#include "Pipeline.hpp"
+#endif
+
+#include <cmath>
+#include <span>
+#include <tuple>
+
+namespace Pulsarion::Math
+{
+    // A vector at a time in a local array, the stages are overloads of Apply
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    struct PipelineFunctions
+    {
+        using V = Vector<N, T, Q>;
+
+        template<typename... Stages>
+        static inline void Run(const std::tuple<Stages...>& stages, std::span<const V> input, std::span<V> output) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Pipeline", N, "::Run");
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                T value[N];
+                for (std::size_t c = 0; c < N; ++c)
+                    value[c] = input[i][c];
+                std::apply([&value](const auto&... stage) { (Apply(stage, value), ...); }, stages);
+                for (std::size_t c = 0; c < N; ++c)
+                    output[i][c] = value[c];
+            }
+        }
+
+    private:
+        static inline void Apply(const PipelineStages::Transform<T>& stage, T (&value)[N]) noexcept
+        {
+            const T w = N == 4 ? value[N - 1] : T(1);
+            T result[N];
+            for (std::size_t row = 0; row < N; ++row)
+                result[row] = stage.matrix.Get(row, 0) * value[0] + stage.matrix.Get(row, 1) * value[1] + stage.matrix.Get(row, 2) * value[2] + stage.matrix.Get(row, 3) * w;
+            for (std::size_t row = 0; row < N; ++row)
+                value[row] = result[row];
+        }
+
+        static inline void Apply(const PipelineStages::Normalize&, T (&value)[N]) noexcept
+        {
+            T lengthSquared = T(0);
+            for (std::size_t c = 0; c < N; ++c)
+                lengthSquared += value[c] * value[c];
+            const T length = std::sqrt(lengthSquared);
+            for (std::size_t c = 0; c < N; ++c)
+                value[c] = lengthSquared > T(0) ? value[c] / length : T(0);
+        }
+
+        // Written like maxps and minps, so NaN becomes the lower bound
+        static inline void Apply(const PipelineStages::Clamp<N, T, Q>& stage, T (&value)[N]) noexcept
+        {
+            for (std::size_t c = 0; c < N; ++c)
+            {
+                const T low = value[c] > stage.min[c] ? value[c] : stage.min[c];
+                value[c] = low < stage.max[c] ? low : stage.max[c];
+            }
+        }
+
+        static inline void Apply(const PipelineStages::Scale<T>& stage, T (&value)[N]) noexcept
+        {
+            for (std::size_t c = 0; c < N; ++c)
+                value[c] *= stage.factor;
+        }
+
+        static inline void Apply(const PipelineStages::Add<N, T, Q>& stage, T (&value)[N]) noexcept
+        {
+            for (std::size_t c = 0; c < N; ++c)
+                value[c] += stage.offset[c];
+        }
+    };
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#ifndef PULSARION_MATH_PIPELINE_HPP
+#include "Pipeline.hpp"
+#endif
+
+#include "VectorLayoutSSE.hpp"
+
+#include <immintrin.h>
+#include <span>
+#include <tuple>
+
+namespace Pulsarion::Math
+{
+    // A register per vector. The stages are first turned into registers (the matrix columns, the bounds, ...) once per run,
+    // so the loop only loads the vector, runs the chain of Apply and stores it.
+    // Packed 3 component vectors are loaded and stored as 8 + 4 bytes, so a vector is never read after an earlier one was written
+    // (the output can be the input), and 3 component vectors keep a zero in lane 3 (the padding of aligned ones).
+    template<std::size_t N, Qualifier Q>
+    struct PipelineFunctionsSSE
+    {
+        using V = Vector<N, float, Q>;
+
+        template<typename... Stages>
+        static inline void Run(const std::tuple<Stages...>& stages, std::span<const V> input, std::span<V> output) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Pipeline", N, "::Run");
+            const auto prepared = std::apply([](const auto&... stage) { return std::make_tuple(Prepare(stage)...); }, stages);
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                __m128 value = Detail::LoadVectorSSE(input[i]);
+                std::apply([&value](const auto&... stage) { ((value = Apply(stage, value)), ...); }, prepared);
+                Detail::StoreVectorSSE(value, output[i]);
+            }
+        }
+
+    private:
+        struct TransformRegisters
+        {
+            __m128 columns[4];
+        };
+
+        struct NormalizeRegisters {};
+
+        struct ClampRegisters
+        {
+            __m128 min, max;
+        };
+
+        struct ScaleRegisters
+        {
+            __m128 factor;
+        };
+
+        struct AddRegisters
+        {
+            __m128 offset;
+        };
+
+        static inline TransformRegisters Prepare(const PipelineStages::Transform<float>& stage) noexcept
+        {
+            return { { _mm_load_ps(&stage.matrix[0].x()), _mm_load_ps(&stage.matrix[1].x()), _mm_load_ps(&stage.matrix[2].x()), _mm_load_ps(&stage.matrix[3].x()) } };
+        }
+
+        static inline NormalizeRegisters Prepare(const PipelineStages::Normalize&) noexcept { return {}; }
+
+        static inline ClampRegisters Prepare(const PipelineStages::Clamp<N, float, Q>& stage) noexcept { return { Detail::LoadVectorSSE(stage.min), Detail::LoadVectorSSE(stage.max) }; }
+
+        static inline ScaleRegisters Prepare(const PipelineStages::Scale<float>& stage) noexcept { return { _mm_set1_ps(stage.factor) }; }
+
+        static inline AddRegisters Prepare(const PipelineStages::Add<N, float, Q>& stage) noexcept { return { Detail::LoadVectorSSE(stage.offset) }; }
+
+        static inline __m128 Apply(const TransformRegisters& stage, __m128 value) noexcept { return Detail::TransformVectorSSE<N>(stage.columns, value); }
+
+        static inline __m128 Apply(const NormalizeRegisters&, __m128 value) noexcept
+        {
+            const __m128 lengthSquared = _mm_dp_ps(value, value, N == 4 ? 0xFF : 0x7F);
+            return _mm_and_ps(_mm_div_ps(value, _mm_sqrt_ps(lengthSquared)), _mm_cmpgt_ps(lengthSquared, _mm_setzero_ps()));
+        }
+
+        static inline __m128 Apply(const ClampRegisters& stage, __m128 value) noexcept
+        {
+            return _mm_min_ps(_mm_max_ps(value, stage.min), stage.max);
+        }
+
+        static inline __m128 Apply(const ScaleRegisters& stage, __m128 value) noexcept { return _mm_mul_ps(value, stage.factor); }
+
+        static inline __m128 Apply(const AddRegisters& stage, __m128 value) noexcept { return _mm_add_ps(value, stage.offset); }
+    };
+
+    template<>
+    struct PipelineFunctions<4, float, Qualifier::Aligned> : PipelineFunctionsSSE<4, Qualifier::Aligned> {};
+
+    template<>
+    struct PipelineFunctions<4, float, Qualifier::Packed> : PipelineFunctionsSSE<4, Qualifier::Packed> {};
+
+    template<>
+    struct PipelineFunctions<3, float, Qualifier::Aligned> : PipelineFunctionsSSE<3, Qualifier::Aligned> {};
+
+    template<>
+    struct PipelineFunctions<3, float, Qualifier::Packed> : PipelineFunctionsSSE<3, Qualifier::Packed> {};
+}
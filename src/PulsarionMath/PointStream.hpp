@@ -0,0 +1,185 @@
+#pragma once
+
+#include "Transform.hpp"
+#include "AlignedAllocator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <semaphore>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Streams points from a source to a sink through the batched transform, a fixed size chunk at a time,
+// so datasets bigger than memory only ever hold two chunks. A reader thread fills the next chunk while the current one
+// is transformed, filtered and handed to the sink, so reading overlaps the compute (and the writing done by the sink).
+//
+// A source is anything with std::size_t Read(std::span<Vector<N, T, Q>> chunk), filling the front of the chunk and returning
+// how many points it read, 0 once it is exhausted. A sink is anything callable with a std::span<const Vector<N, T, Q>>.
+namespace Pulsarion::Math
+{
+    struct PointStreamConstants
+    {
+        // 64k points, 768 KiB of packed xyz floats, big enough to amortize a read and small enough to stay in L2/L3
+        static constexpr std::size_t ChunkSize = 64 * 1024;
+    };
+
+    struct PointStreamStats
+    {
+        std::uint64_t pointsRead = 0;
+        std::uint64_t pointsWritten = 0; // Without the filtered ones
+        std::uint64_t chunks = 0;
+        double seconds = 0.0;
+
+        [[nodiscard]] inline double PointsPerSecond() const noexcept { return seconds > 0.0 ? static_cast<double>(pointsRead) / seconds : 0.0; }
+    };
+
+    // Keeps every point
+    struct KeepAllPoints
+    {
+        template<typename V>
+        inline constexpr bool operator()(const V&) const noexcept { return true; }
+    };
+
+    // Reads points from memory, e.g. the span of a MappedBinaryArray, the pages are only touched as the chunks are copied
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    class SpanPointSource
+    {
+    public:
+        explicit inline SpanPointSource(std::span<const Vector<N, T, Q>> points) noexcept : m_Points(points) {}
+
+        inline std::size_t Read(std::span<Vector<N, T, Q>> chunk) noexcept
+        {
+            const std::size_t count = std::min(chunk.size(), m_Points.size());
+            std::copy_n(m_Points.begin(), count, chunk.begin());
+            m_Points = m_Points.subspan(count);
+            return count;
+        }
+
+    private:
+        std::span<const Vector<N, T, Q>> m_Points;
+    };
+
+    // Reads raw points (the elements exactly as they are in memory) from a file, starting at offset,
+    // e.g. sizeof(BinaryArrayHeader) to read the payload of a binary array file
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    class FilePointSource
+    {
+    public:
+        explicit inline FilePointSource(const std::filesystem::path& path, std::uint64_t offset = 0) : m_File(path, std::ios::binary)
+        {
+            if (m_File)
+                m_File.seekg(static_cast<std::streamoff>(offset));
+        }
+
+        [[nodiscard]] inline bool IsOpen() const noexcept { return m_File.is_open(); }
+        // The file ended in the middle of a point, or couldn't be read
+        [[nodiscard]] inline bool Failed() const noexcept { return m_Failed; }
+
+        inline std::size_t Read(std::span<Vector<N, T, Q>> chunk)
+        {
+            if (!m_File)
+                return 0;
+            m_File.read(reinterpret_cast<char*>(chunk.data()), static_cast<std::streamsize>(chunk.size_bytes()));
+            const auto bytes = static_cast<std::size_t>(m_File.gcount());
+            m_Failed = m_Failed || bytes % sizeof(Vector<N, T, Q>) != 0 || m_File.bad();
+            return bytes / sizeof(Vector<N, T, Q>);
+        }
+
+    private:
+        std::ifstream m_File;
+        bool m_Failed = false;
+    };
+
+    // Appends raw points to a file
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    class FilePointSink
+    {
+    public:
+        explicit inline FilePointSink(const std::filesystem::path& path) : m_File(path, std::ios::binary | std::ios::trunc) {}
+
+        [[nodiscard]] inline bool Failed() const noexcept { return !m_File; }
+
+        inline void operator()(std::span<const Vector<N, T, Q>> points)
+        {
+            m_File.write(reinterpret_cast<const char*>(points.data()), static_cast<std::streamsize>(points.size_bytes()));
+        }
+
+    private:
+        std::ofstream m_File;
+    };
+
+    // Transforms every point of the source by matrix (see TransformPoints), drops the ones the filter rejects (it sees the transformed point),
+    // and hands the rest to the sink in order, a chunk at a time. The spans given to the sink are only valid during the call.
+    template<std::size_t N, Arithmetic_t T, Qualifier Q, typename Source, typename Sink, typename Filter = KeepAllPoints>
+    requires (N == 3 || N == 4)
+    inline PointStreamStats StreamTransform(const Matrix<4, 4, T>& matrix, Source& source, Sink&& sink, Filter&& filter = {}, std::size_t chunkSize = PointStreamConstants::ChunkSize)
+    {
+        using V = Vector<N, T, Q>;
+        const auto start = std::chrono::steady_clock::now();
+        chunkSize = std::max<std::size_t>(chunkSize, 1);
+
+        std::vector<V, AlignedAllocator<V>> buffers[2] = { std::vector<V, AlignedAllocator<V>>(chunkSize), std::vector<V, AlignedAllocator<V>>(chunkSize) };
+        std::size_t counts[2] = {};
+        // The semaphores order the reads of a buffer before its processing, and the processing before it is refilled
+        std::counting_semaphore<2> free(2);
+        std::counting_semaphore<2> full(0);
+        std::atomic<bool> stop = false;
+
+        std::jthread reader([&]() {
+            for (std::size_t chunk = 0;; ++chunk)
+            {
+                free.acquire();
+                if (stop.load(std::memory_order_relaxed))
+                    return;
+                auto& buffer = buffers[chunk % 2];
+                counts[chunk % 2] = source.Read(std::span<V>(buffer.data(), buffer.size()));
+                full.release();
+                if (counts[chunk % 2] == 0)
+                    return;
+            }
+        });
+
+        PointStreamStats stats;
+        try
+        {
+            for (std::size_t chunk = 0;; ++chunk)
+            {
+                full.acquire();
+                const std::size_t count = counts[chunk % 2];
+                if (count == 0)
+                    break;
+
+                std::span<V> points(buffers[chunk % 2].data(), count);
+                TransformFunctions<N, T, Q>::TransformPoints(matrix, points, points);
+
+                std::size_t kept = count;
+                if constexpr (!std::is_same_v<std::remove_cvref_t<Filter>, KeepAllPoints>)
+                    kept = static_cast<std::size_t>(std::remove_if(points.begin(), points.end(), [&filter](const V& point) { return !filter(point); }) - points.begin());
+                if (kept > 0)
+                    sink(std::span<const V>(points.data(), kept));
+
+                stats.pointsRead += count;
+                stats.pointsWritten += kept;
+                ++stats.chunks;
+                free.release();
+            }
+        }
+        catch (...)
+        {
+            // Hands the reader the buffer being processed, so it wakes up and sees the stop
+            stop.store(true, std::memory_order_relaxed);
+            free.release();
+            throw;
+        }
+        reader.join();
+
+        stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return stats;
+    }
+}
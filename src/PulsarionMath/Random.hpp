@@ -0,0 +1,215 @@
+#pragma once
+#define PULSARION_MATH_RANDOM_HPP
+
+#include "Simd.hpp"
+#include "Vector.hpp"
+#include "RandomCommon.hpp"
+
+#include <algorithm>
+#include <span>
+
+namespace Pulsarion::Math
+{
+    // L independent xoshiro128+ generators, advanced together so every step produces L numbers at once.
+    // Lane i starts 2^64 steps after lane i - 1, and Jump() moves every lane 2^96 steps ahead, so streams created with
+    // ForStream(seed, index) never overlap, and the numbers a thread gets don't depend on how work is scheduled.
+    template<std::size_t L = 4>
+    requires (L == 4 || L == 8)
+    class Random
+    {
+    public:
+        static constexpr std::size_t Lanes = L;
+
+        explicit inline Random(std::uint64_t seed) noexcept
+        {
+            // SplitMix64, as recommended for seeding xoshiro, it never produces an all zero state
+            std::uint32_t lane[4];
+            for (std::size_t i = 0; i < 4; i += 2)
+            {
+                seed += 0x9E3779B97F4A7C15ull;
+                std::uint64_t z = seed;
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+                z ^= z >> 31;
+                lane[i] = static_cast<std::uint32_t>(z);
+                lane[i + 1] = static_cast<std::uint32_t>(z >> 32);
+            }
+
+            for (std::size_t j = 0; j < L; ++j)
+            {
+                for (std::size_t word = 0; word < 4; ++word)
+                    m_State[word][j] = lane[word];
+                JumpLane(lane, JumpTable);
+            }
+        }
+
+        // The index-th of the non overlapping streams of seed, e.g. one per thread
+        [[nodiscard]] static inline Random ForStream(std::uint64_t seed, std::size_t index) noexcept
+        {
+            Random random(seed);
+            for (std::size_t i = 0; i < index; ++i)
+                random.Jump();
+            return random;
+        }
+
+        // Moves every lane 2^96 steps ahead
+        inline void Jump() noexcept
+        {
+            for (std::size_t j = 0; j < L; ++j)
+            {
+                std::uint32_t lane[4] = { m_State[0][j], m_State[1][j], m_State[2][j], m_State[3][j] };
+                JumpLane(lane, LongJumpTable);
+                for (std::size_t word = 0; word < 4; ++word)
+                    m_State[word][j] = lane[word];
+            }
+        }
+
+        // ---- One step, one number per lane ----
+        inline void Next(std::uint32_t (&out)[L]) noexcept { RandomFunctions<L>::NextUInt(m_State, out); }
+        // Uniform in [0, 1), with 24 bits of randomness
+        inline void NextFloat(float (&out)[L]) noexcept { RandomFunctions<L>::NextFloat(m_State, out); }
+
+        // ---- Batches ----
+        inline void Fill(std::span<std::uint32_t> output) noexcept
+        {
+            PULSARION_MATH_ALIGN std::uint32_t values[L];
+            for (std::size_t i = 0; i < output.size(); i += L)
+            {
+                RandomFunctions<L>::NextUInt(m_State, values);
+                std::copy_n(values, std::min(L, output.size() - i), output.data() + i);
+            }
+        }
+
+        // Uniform in [min, max)
+        inline void FillUniform(std::span<float> output, float min = 0.0f, float max = 1.0f) noexcept
+        {
+            PULSARION_MATH_ALIGN float values[L];
+            for (std::size_t i = 0; i < output.size(); i += L)
+            {
+                RandomFunctions<L>::NextFloat(m_State, values);
+                const std::size_t count = std::min(L, output.size() - i);
+                for (std::size_t k = 0; k < count; ++k)
+                    output[i + k] = min + values[k] * (max - min);
+            }
+        }
+
+        // Every component uniform in [min, max)
+        template<std::size_t N, Qualifier Q>
+        inline void FillUniform(std::span<Vector<N, float, Q>> output, float min = 0.0f, float max = 1.0f) noexcept
+        {
+            PULSARION_MATH_ALIGN float values[L];
+            std::size_t used = L;
+            for (Vector<N, float, Q>& vector : output)
+            {
+                for (std::size_t c = 0; c < N; ++c)
+                {
+                    if (used == L)
+                    {
+                        RandomFunctions<L>::NextFloat(m_State, values);
+                        used = 0;
+                    }
+                    vector[c] = min + values[used++] * (max - min);
+                }
+            }
+        }
+
+        // Uniform on the surface of the unit sphere (w is 0 for 4 component vectors)
+        template<std::size_t N, Qualifier Q>
+        requires (N >= 3)
+        inline void FillUnitSphere(std::span<Vector<N, float, Q>> output) noexcept { FillVectors<&RandomFunctions<L>::UnitSphere, 3>(output); }
+        // Uniform on the unit hemisphere around +z
+        template<std::size_t N, Qualifier Q>
+        requires (N >= 3)
+        inline void FillHemisphere(std::span<Vector<N, float, Q>> output) noexcept { FillVectors<&RandomFunctions<L>::Hemisphere, 3>(output); }
+        // Cosine weighted on the unit hemisphere around +z, the distribution of diffuse reflections
+        template<std::size_t N, Qualifier Q>
+        requires (N >= 3)
+        inline void FillCosineHemisphere(std::span<Vector<N, float, Q>> output) noexcept { FillVectors<&RandomFunctions<L>::CosineHemisphere, 3>(output); }
+        // Uniform in the unit disc in the xy plane
+        template<std::size_t N, Qualifier Q>
+        inline void FillDisc(std::span<Vector<N, float, Q>> output) noexcept { FillVectors<&RandomFunctions<L>::Disc, 2>(output); }
+
+        // Structure of arrays versions, the spans have to have the same size
+        inline void FillUnitSphere(std::span<float> x, std::span<float> y, std::span<float> z) noexcept { FillComponents<&RandomFunctions<L>::UnitSphere>({ x, y, z }); }
+        inline void FillHemisphere(std::span<float> x, std::span<float> y, std::span<float> z) noexcept { FillComponents<&RandomFunctions<L>::Hemisphere>({ x, y, z }); }
+        inline void FillCosineHemisphere(std::span<float> x, std::span<float> y, std::span<float> z) noexcept { FillComponents<&RandomFunctions<L>::CosineHemisphere>({ x, y, z }); }
+        inline void FillDisc(std::span<float> x, std::span<float> y) noexcept { FillComponents<&RandomFunctions<L>::Disc>({ x, y }); }
+
+    private:
+        PULSARION_MATH_ALIGN std::uint32_t m_State[4][L];
+
+        static constexpr std::uint32_t JumpTable[4] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+        static constexpr std::uint32_t LongJumpTable[4] = { 0xb523952e, 0x0b6f099f, 0xccf5a0ef, 0x1c580662 };
+
+        // Reference jump of xoshiro128+, the table is a polynomial in the step function
+        static inline void JumpLane(std::uint32_t (&lane)[4], const std::uint32_t (&table)[4]) noexcept
+        {
+            std::uint32_t result[4] = {};
+            for (std::uint32_t word : table)
+            {
+                for (int bit = 0; bit < 32; ++bit)
+                {
+                    if (word & (1u << bit))
+                    {
+                        for (std::size_t i = 0; i < 4; ++i)
+                            result[i] ^= lane[i];
+                    }
+                    const std::uint32_t t = lane[1] << 9;
+                    lane[2] ^= lane[0];
+                    lane[3] ^= lane[1];
+                    lane[1] ^= lane[2];
+                    lane[0] ^= lane[3];
+                    lane[2] ^= t;
+                    lane[3] = (lane[3] << 11) | (lane[3] >> 21);
+                }
+            }
+            std::copy_n(result, 4, lane);
+        }
+
+        template<auto Sample, std::size_t Components, std::size_t N, Qualifier Q>
+        inline void FillVectors(std::span<Vector<N, float, Q>> output) noexcept
+        {
+            PULSARION_MATH_ALIGN float values[Components][L];
+            for (std::size_t i = 0; i < output.size(); i += L)
+            {
+                CallSample<Sample>(values);
+                const std::size_t count = std::min(L, output.size() - i);
+                for (std::size_t k = 0; k < count; ++k)
+                {
+                    Vector<N, float, Q>& vector = output[i + k];
+                    for (std::size_t c = 0; c < N; ++c)
+                        vector[c] = c < Components ? values[c][k] : 0.0f;
+                }
+            }
+        }
+
+        template<auto Sample, std::size_t Components>
+        inline void FillComponents(const std::span<float> (&output)[Components]) noexcept
+        {
+            PULSARION_MATH_ALIGN float values[Components][L];
+            const std::size_t size = output[0].size();
+            for (std::size_t i = 0; i < size; i += L)
+            {
+                CallSample<Sample>(values);
+                const std::size_t count = std::min(L, size - i);
+                for (std::size_t c = 0; c < Components; ++c)
+                    std::copy_n(values[c], count, output[c].data() + i);
+            }
+        }
+
+        template<auto Sample, std::size_t Components>
+        inline void CallSample(float (&values)[Components][L]) noexcept
+        {
+            if constexpr (Components == 3)
+                Sample(m_State, values[0], values[1], values[2]);
+            else
+                Sample(m_State, values[0], values[1]);
+        }
+    };
+}
+
+#include "RandomGeneric.hpp"
+
+#ifdef PULSARION_MATH_SIMD_SSE4_1
+#include "RandomSSE.hpp"
+#endif
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+
+#include <cstdint>
+
+namespace Pulsarion::Math
+{
+    template<std::size_t L>
+    struct RandomFunctions; // Steps L independent xoshiro128+ generators, stored as state[word][lane].
+}
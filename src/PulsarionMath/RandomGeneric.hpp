@@ -0,0 +1,122 @@
+#pragma once
+
+#ifndef PULSARION_MATH_RANDOM_HPP
+#include "Random.hpp"
+#endif
+
+#include "Transcendental.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Pulsarion::Math
+{
+    template<std::size_t L>
+    struct GenericRandomFunctions
+    {
+        static inline void NextUInt(std::uint32_t (&state)[4][L], std::uint32_t (&out)[L]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Random", L, "::NextUInt");
+            for (std::size_t j = 0; j < L; ++j)
+            {
+                out[j] = state[0][j] + state[3][j];
+                const std::uint32_t t = state[1][j] << 9;
+                state[2][j] ^= state[0][j];
+                state[3][j] ^= state[1][j];
+                state[1][j] ^= state[2][j];
+                state[0][j] ^= state[3][j];
+                state[2][j] ^= t;
+                state[3][j] = (state[3][j] << 11) | (state[3][j] >> 21);
+            }
+        }
+
+        // The low bits of xoshiro128+ are weak, so only the top 24 are used
+        static inline void NextFloat(std::uint32_t (&state)[4][L], float (&out)[L]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Random", L, "::NextFloat");
+            std::uint32_t bits[L];
+            NextUInt(state, bits);
+            for (std::size_t j = 0; j < L; ++j)
+                out[j] = static_cast<float>(bits[j] >> 8) * 0x1p-24f;
+        }
+
+        static inline void UnitSphere(std::uint32_t (&state)[4][L], float (&x)[L], float (&y)[L], float (&z)[L]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Random", L, "::UnitSphere");
+            float u[L];
+            NextFloat(state, u);
+            for (std::size_t j = 0; j < L; ++j)
+                z[j] = 1.0f - 2.0f * u[j];
+            Circle(state, x, y);
+            for (std::size_t j = 0; j < L; ++j)
+            {
+                const float r = std::sqrt(std::max(0.0f, 1.0f - z[j] * z[j]));
+                x[j] *= r;
+                y[j] *= r;
+            }
+        }
+
+        static inline void Hemisphere(std::uint32_t (&state)[4][L], float (&x)[L], float (&y)[L], float (&z)[L]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Random", L, "::Hemisphere");
+            float u[L];
+            NextFloat(state, u);
+            for (std::size_t j = 0; j < L; ++j)
+                z[j] = 1.0f - u[j];
+            Circle(state, x, y);
+            for (std::size_t j = 0; j < L; ++j)
+            {
+                const float r = std::sqrt(std::max(0.0f, 1.0f - z[j] * z[j]));
+                x[j] *= r;
+                y[j] *= r;
+            }
+        }
+
+        // Malley's method, a disc sample projected up onto the hemisphere
+        static inline void CosineHemisphere(std::uint32_t (&state)[4][L], float (&x)[L], float (&y)[L], float (&z)[L]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Random", L, "::CosineHemisphere");
+            float u[L];
+            NextFloat(state, u);
+            Circle(state, x, y);
+            for (std::size_t j = 0; j < L; ++j)
+            {
+                const float r = std::sqrt(u[j]);
+                x[j] *= r;
+                y[j] *= r;
+                z[j] = std::sqrt(1.0f - u[j]);
+            }
+        }
+
+        static inline void Disc(std::uint32_t (&state)[4][L], float (&x)[L], float (&y)[L]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Random", L, "::Disc");
+            float u[L];
+            NextFloat(state, u);
+            Circle(state, x, y);
+            for (std::size_t j = 0; j < L; ++j)
+            {
+                const float r = std::sqrt(u[j]);
+                x[j] *= r;
+                y[j] *= r;
+            }
+        }
+
+    private:
+        // A uniform point on the unit circle
+        static inline void Circle(std::uint32_t (&state)[4][L], float (&x)[L], float (&y)[L]) noexcept
+        {
+            float u[L];
+            NextFloat(state, u);
+            for (std::size_t j = 0; j < L; ++j)
+            {
+                // Angles in [-pi, pi) keep the range reduction trivial
+                const float angle = TranscendentalConstants<float>::Pi * (2.0f * u[j] - 1.0f);
+                ScalarTranscendental<float>::sinCos(angle, y[j], x[j]);
+            }
+        }
+    };
+
+    template<std::size_t L>
+    struct RandomFunctions : GenericRandomFunctions<L> {};
+}
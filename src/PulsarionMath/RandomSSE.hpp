@@ -0,0 +1,134 @@
+#pragma once
+
+#ifndef PULSARION_MATH_RANDOM_HPP
+#include "Random.hpp"
+#endif
+
+#include <immintrin.h>
+
+namespace Pulsarion::Math
+{
+    // Groups of 4 lanes, 8 lanes are two independent groups which also hides the latency of the step.
+    // The integers and floats are the same bits as the scalar ones, so they are kept with PULSARION_MATH_DETERMINISTIC. The samples
+    // aren't (the SIMD SinCos approximates differently), so there they are the scalar ones
+    template<std::size_t L>
+    struct RandomFunctionsSSE : GenericRandomFunctions<L>
+    {
+        static inline void NextUInt(std::uint32_t (&state)[4][L], std::uint32_t (&out)[L]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Random", L, "::NextUInt");
+            for (std::size_t j = 0; j < L; j += 4)
+                _mm_store_si128(reinterpret_cast<__m128i*>(out + j), Step(state, j));
+        }
+
+        static inline void NextFloat(std::uint32_t (&state)[4][L], float (&out)[L]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Random", L, "::NextFloat");
+            for (std::size_t j = 0; j < L; j += 4)
+                _mm_store_ps(out + j, Float(state, j));
+        }
+
+#ifndef PULSARION_MATH_DETERMINISTIC
+        static inline void UnitSphere(std::uint32_t (&state)[4][L], float (&x)[L], float (&y)[L], float (&z)[L]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Random", L, "::UnitSphere");
+            for (std::size_t j = 0; j < L; j += 4)
+            {
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 cz = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(2.0f), Float(state, j)));
+                __m128 r = _mm_sqrt_ps(_mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(cz, cz))));
+                StoreCircle(state, j, r, x, y);
+                _mm_store_ps(z + j, cz);
+            }
+        }
+
+        static inline void Hemisphere(std::uint32_t (&state)[4][L], float (&x)[L], float (&y)[L], float (&z)[L]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Random", L, "::Hemisphere");
+            for (std::size_t j = 0; j < L; j += 4)
+            {
+                __m128 cz = _mm_sub_ps(_mm_set1_ps(1.0f), Float(state, j));
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                __m128 r = _mm_sqrt_ps(_mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(cz, cz))));
+                StoreCircle(state, j, r, x, y);
+                _mm_store_ps(z + j, cz);
+            }
+        }
+
+        static inline void CosineHemisphere(std::uint32_t (&state)[4][L], float (&x)[L], float (&y)[L], float (&z)[L]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Random", L, "::CosineHemisphere");
+            for (std::size_t j = 0; j < L; j += 4)
+            {
+                __m128 u = Float(state, j);
+                StoreCircle(state, j, _mm_sqrt_ps(u), x, y);
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                _mm_store_ps(z + j, _mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), u)));
+            }
+        }
+
+        static inline void Disc(std::uint32_t (&state)[4][L], float (&x)[L], float (&y)[L]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Random", L, "::Disc");
+            for (std::size_t j = 0; j < L; j += 4)
+                StoreCircle(state, j, _mm_sqrt_ps(Float(state, j)), x, y);
+        }
+#endif
+
+    private:
+        // Lanes [j, j + 4)
+        static inline __m128i Step(std::uint32_t (&state)[4][L], std::size_t j) noexcept
+        {
+            __m128i s0 = _mm_load_si128(reinterpret_cast<const __m128i*>(state[0] + j));
+            __m128i s1 = _mm_load_si128(reinterpret_cast<const __m128i*>(state[1] + j));
+            __m128i s2 = _mm_load_si128(reinterpret_cast<const __m128i*>(state[2] + j));
+            __m128i s3 = _mm_load_si128(reinterpret_cast<const __m128i*>(state[3] + j));
+
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128i result = _mm_add_epi32(s0, s3);
+            __m128i t = _mm_slli_epi32(s1, 9);
+            s2 = _mm_xor_si128(s2, s0);
+            s3 = _mm_xor_si128(s3, s1);
+            s1 = _mm_xor_si128(s1, s2);
+            s0 = _mm_xor_si128(s0, s3);
+            s2 = _mm_xor_si128(s2, t);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+
+            _mm_store_si128(reinterpret_cast<__m128i*>(state[0] + j), s0);
+            _mm_store_si128(reinterpret_cast<__m128i*>(state[1] + j), s1);
+            _mm_store_si128(reinterpret_cast<__m128i*>(state[2] + j), s2);
+            _mm_store_si128(reinterpret_cast<__m128i*>(state[3] + j), s3);
+            return result;
+        }
+
+        // The top 24 bits, exactly representable, scaled to [0, 1)
+        static inline __m128 Float(std::uint32_t (&state)[4][L], std::size_t j) noexcept
+        {
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(Step(state, j), 8)), _mm_set1_ps(0x1p-24f));
+        }
+
+#ifndef PULSARION_MATH_DETERMINISTIC
+        static inline void StoreCircle(std::uint32_t (&state)[4][L], std::size_t j, __m128 radius, float (&x)[L], float (&y)[L]) noexcept
+        {
+            // Angles in [-pi, pi) keep the range reduction trivial
+            __m128 u = Float(state, j);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 angle = _mm_mul_ps(_mm_set1_ps(TranscendentalConstants<float>::Pi), _mm_sub_ps(_mm_add_ps(u, u), _mm_set1_ps(1.0f)));
+            __m128 sin, cos;
+            TranscendentalSSE::SinCos(angle, sin, cos);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            _mm_store_ps(x + j, _mm_mul_ps(cos, radius));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            _mm_store_ps(y + j, _mm_mul_ps(sin, radius));
+        }
+#endif
+    };
+
+    template<>
+    struct RandomFunctions<4> : RandomFunctionsSSE<4> {};
+
+    template<>
+    struct RandomFunctions<8> : RandomFunctionsSSE<8> {};
+}
@@ -0,0 +1,167 @@
+#pragma once
+#define PULSARION_MATH_REDUCE_HPP
+
+#include "Vector.hpp"
+#include "Matrix.hpp"
+#include "Parallel.hpp"
+#include "ReduceCommon.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// Reductions over spans of points: the sum, the mean (centroid), the axis aligned bounds and the covariance of xyz.
+// NaN components are skipped by the bounds, and propagate through everything else.
+// The Parallel* variants split the span between threads and merge their partial results in order,
+// so the result only depends on the thread count, not on the scheduling.
+namespace Pulsarion::Math
+{
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    struct Bounds
+    {
+        Vector<N, T, Q> min;
+        Vector<N, T, Q> max;
+
+        // The bounds of no points have min > max
+        [[nodiscard]] inline bool IsEmpty() const noexcept { return min[0] > max[0]; }
+    };
+
+    namespace Detail
+    {
+        template<std::size_t N, Arithmetic_t T>
+        struct ReducePartial
+        {
+            T sum[N] = {};
+            T min[N];
+            T max[N];
+            T covariance[6] = {};
+
+            inline ReducePartial() noexcept
+            {
+                constexpr T highest = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+                constexpr T lowest = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest();
+                std::fill(std::begin(min), std::end(min), highest);
+                std::fill(std::begin(max), std::end(max), lowest);
+            }
+
+            inline void Merge(const ReducePartial& other) noexcept
+            {
+                for (std::size_t d = 0; d < N; ++d)
+                {
+                    sum[d] += other.sum[d];
+                    min[d] = std::min(min[d], other.min[d]);
+                    max[d] = std::max(max[d], other.max[d]);
+                }
+                for (std::size_t k = 0; k < 6; ++k)
+                    covariance[k] += other.covariance[k];
+            }
+        };
+
+        // Calls block(points, partial) on every block of the span, with a partial result per thread, and merges them in order
+        template<std::size_t N, Arithmetic_t T, Qualifier Q, typename F>
+        inline ReducePartial<N, T> ParallelReduce(std::span<const Vector<N, T, Q>> points, std::size_t threadCount, F&& block)
+        {
+            constexpr std::size_t blockSize = ReduceConstants::BlockSize;
+            if (points.size() < ReduceConstants::ParallelThreshold)
+                threadCount = 1;
+            threadCount = std::max<std::size_t>(threadCount, 1);
+
+            std::vector<ReducePartial<N, T>> partials(threadCount);
+            ParallelFor(points.size(), blockSize, threadCount, [&](std::size_t begin, std::size_t end, std::size_t thread) {
+                for (std::size_t i = begin; i < end; i += blockSize)
+                    block(points.subspan(i, std::min(blockSize, end - i)), partials[thread]);
+            });
+            for (std::size_t thread = 1; thread < threadCount; ++thread)
+                partials[0].Merge(partials[thread]);
+            return partials[0];
+        }
+
+        template<std::size_t N, Arithmetic_t T, Qualifier Q>
+        inline Vector<N, T, Q> ToVector(const T (&values)[N]) noexcept
+        {
+            Vector<N, T, Q> result;
+            for (std::size_t d = 0; d < N; ++d)
+                result[d] = values[d];
+            return result;
+        }
+    }
+
+    // ---- Parallel ----
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline Vector<N, T, Q> ParallelSum(std::type_identity_t<std::span<const Vector<N, T, Q>>> points, std::size_t threadCount = DefaultThreadCount())
+    {
+        auto partial = Detail::ParallelReduce<N, T, Q>(points, threadCount, [](std::span<const Vector<N, T, Q>> block, auto& result) {
+            ReduceFunctions<N, T, Q>::Sum(block, result.sum);
+        });
+        return Detail::ToVector<N, T, Q>(partial.sum);
+    }
+
+    // The centroid, zero for no points
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline Vector<N, T, Q> ParallelMean(std::type_identity_t<std::span<const Vector<N, T, Q>>> points, std::size_t threadCount = DefaultThreadCount())
+    {
+        Vector<N, T, Q> sum = ParallelSum<N, T, Q>(points, threadCount);
+        if (points.empty())
+            return sum;
+        for (std::size_t d = 0; d < N; ++d)
+            sum[d] /= static_cast<T>(points.size());
+        return sum;
+    }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline Bounds<N, T, Q> ParallelBounds(std::type_identity_t<std::span<const Vector<N, T, Q>>> points, std::size_t threadCount = DefaultThreadCount())
+    {
+        auto partial = Detail::ParallelReduce<N, T, Q>(points, threadCount, [](std::span<const Vector<N, T, Q>> block, auto& result) {
+            ReduceFunctions<N, T, Q>::MinMax(block, result.min, result.max);
+        });
+        return Bounds<N, T, Q>{ Detail::ToVector<N, T, Q>(partial.min), Detail::ToVector<N, T, Q>(partial.max) };
+    }
+
+    // The population covariance of xyz (divided by the number of points), zero for no points.
+    // Two passes, the deviations from the mean are summed, instead of E[xy] - E[x]E[y] which cancels badly far from the origin.
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    requires (N >= 3)
+    inline Matrix<3, 3, T> ParallelCovariance(std::type_identity_t<std::span<const Vector<N, T, Q>>> points, std::size_t threadCount = DefaultThreadCount())
+    {
+        Matrix<3, 3, T> result(T(0));
+        if (points.empty())
+            return result;
+
+        const Vector<N, T, Q> centroid = ParallelMean<N, T, Q>(points, threadCount);
+        const T mean[3] = { centroid[0], centroid[1], centroid[2] };
+        auto partial = Detail::ParallelReduce<N, T, Q>(points, threadCount, [&mean](std::span<const Vector<N, T, Q>> block, auto& sums) {
+            ReduceFunctions<N, T, Q>::Covariance(block, mean, sums.covariance);
+        });
+
+        // xx, xy, xz, yy, yz, zz
+        constexpr std::size_t index[3][3] = { { 0, 1, 2 }, { 1, 3, 4 }, { 2, 4, 5 } };
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            for (std::size_t j = 0; j < 3; ++j)
+                result.Get(i, j) = partial.covariance[index[i][j]] / static_cast<T>(points.size());
+        }
+        return result;
+    }
+
+    // ---- Single threaded ----
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline Vector<N, T, Q> Sum(std::type_identity_t<std::span<const Vector<N, T, Q>>> points) { return ParallelSum<N, T, Q>(points, 1); }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline Vector<N, T, Q> Mean(std::type_identity_t<std::span<const Vector<N, T, Q>>> points) { return ParallelMean<N, T, Q>(points, 1); }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline Bounds<N, T, Q> ComputeBounds(std::type_identity_t<std::span<const Vector<N, T, Q>>> points) { return ParallelBounds<N, T, Q>(points, 1); }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    requires (N >= 3)
+    inline Matrix<3, 3, T> Covariance(std::type_identity_t<std::span<const Vector<N, T, Q>>> points) { return ParallelCovariance<N, T, Q>(points, 1); }
+}
+
+#include "ReduceGeneric.hpp"
+
+#if defined(PULSARION_MATH_SIMD_SSE4_1) && !defined(PULSARION_MATH_DETERMINISTIC)
+#include "ReduceSSE.hpp"
+#endif
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+#include "Qualifier.hpp"
+
+#include <cstddef>
+
+namespace Pulsarion::Math
+{
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    struct ReduceFunctions; // Sums, bounds and covariance sums of spans of vectors, added to the totals they are given.
+
+    struct ReduceConstants
+    {
+        // The kernels run on blocks of this many points and the block results are added up,
+        // so the rounding error of a sum grows with the number of blocks instead of the number of points
+        static constexpr std::size_t BlockSize = 4096;
+        // Below this many points, starting threads costs more than it saves
+        static constexpr std::size_t ParallelThreshold = 64 * 1024;
+    };
+}
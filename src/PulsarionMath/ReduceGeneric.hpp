@@ -0,0 +1,113 @@
+#pragma once
+
+#ifndef PULSARION_MATH_REDUCE_HPP
+#include "Reduce.hpp"
+#endif
+
+#include <span>
+
+namespace Pulsarion::Math
+{
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    struct ReduceFunctions
+    {
+        // Independent accumulators, so an addition doesn't have to wait for the one before it
+        static constexpr std::size_t Accumulators = 4;
+
+        static inline void Sum(std::span<const Vector<N, T, Q>> points, T (&sum)[N]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Reduce", N, "::Sum");
+            static_assert(Accumulators == 4, "Sum combines the accumulators as two pairs");
+            T total[Accumulators][N] = {};
+            std::size_t i = 0;
+            for (; i + Accumulators <= points.size(); i += Accumulators)
+            {
+                for (std::size_t a = 0; a < Accumulators; ++a)
+                {
+                    for (std::size_t d = 0; d < N; ++d)
+                        total[a][d] += points[i + a][d];
+                }
+            }
+            for (; i < points.size(); ++i)
+            {
+                for (std::size_t d = 0; d < N; ++d)
+                    total[0][d] += points[i][d];
+            }
+
+            // Combined like the SSE kernel of 4 component and aligned vectors
+            for (std::size_t d = 0; d < N; ++d)
+                sum[d] += (total[0][d] + total[1][d]) + (total[2][d] + total[3][d]);
+        }
+
+        // The point goes first, so a NaN component is never picked
+        static inline void MinMax(std::span<const Vector<N, T, Q>> points, T (&min)[N], T (&max)[N]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Reduce", N, "::MinMax");
+            T low[Accumulators][N], high[Accumulators][N];
+            for (std::size_t a = 0; a < Accumulators; ++a)
+            {
+                for (std::size_t d = 0; d < N; ++d)
+                {
+                    low[a][d] = min[d];
+                    high[a][d] = max[d];
+                }
+            }
+
+            std::size_t i = 0;
+            for (; i + Accumulators <= points.size(); i += Accumulators)
+            {
+                for (std::size_t a = 0; a < Accumulators; ++a)
+                {
+                    for (std::size_t d = 0; d < N; ++d)
+                    {
+                        const T value = points[i + a][d];
+                        low[a][d] = value < low[a][d] ? value : low[a][d];
+                        high[a][d] = value > high[a][d] ? value : high[a][d];
+                    }
+                }
+            }
+            for (; i < points.size(); ++i)
+            {
+                for (std::size_t d = 0; d < N; ++d)
+                {
+                    const T value = points[i][d];
+                    low[0][d] = value < low[0][d] ? value : low[0][d];
+                    high[0][d] = value > high[0][d] ? value : high[0][d];
+                }
+            }
+
+            for (std::size_t a = 0; a < Accumulators; ++a)
+            {
+                for (std::size_t d = 0; d < N; ++d)
+                {
+                    min[d] = low[a][d] < min[d] ? low[a][d] : min[d];
+                    max[d] = high[a][d] > max[d] ? high[a][d] : max[d];
+                }
+            }
+        }
+
+        // Adds the sums of the products of the deviations from the mean, in the order xx, xy, xz, yy, yz, zz
+        static inline void Covariance(std::span<const Vector<N, T, Q>> points, const T (&mean)[3], T (&sums)[6]) noexcept
+        requires (N >= 3)
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Reduce", N, "::Covariance");
+            T accumulators[Accumulators][6] = {};
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+                T (&accumulator)[6] = accumulators[i % Accumulators];
+                const T x = points[i][0] - mean[0];
+                const T y = points[i][1] - mean[1];
+                const T z = points[i][2] - mean[2];
+                accumulator[0] += x * x;
+                accumulator[1] += x * y;
+                accumulator[2] += x * z;
+                accumulator[3] += y * y;
+                accumulator[4] += y * z;
+                accumulator[5] += z * z;
+            }
+
+            for (std::size_t k = 0; k < 6; ++k)
+                sums[k] += (accumulators[0][k] + accumulators[1][k]) + (accumulators[2][k] + accumulators[3][k]);
+        }
+    };
+}
@@ -0,0 +1,250 @@
+#pragma once
+
+#ifndef PULSARION_MATH_REDUCE_HPP
+#include "Reduce.hpp"
+#endif
+
+#include "VectorLayoutSSE.hpp"
+
+#include <immintrin.h>
+#include <span>
+
+namespace Pulsarion::Math
+{
+    // 4 component vectors, and aligned 3 component ones (padded to 16 bytes), are a register per point.
+    // Packed 3 component vectors are read 4 points at a time, as 3 registers holding x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3.
+    template<std::size_t N, Qualifier Q>
+    struct ReduceFunctionsSSE
+    {
+        using V = Vector<N, float, Q>;
+        static constexpr bool Wide = N == 4 || Q == Qualifier::Aligned;
+        static_assert(Wide || sizeof(V) == 3 * sizeof(float), "Packed vectors have to be contiguous");
+
+        static inline void Sum(std::span<const V> points, float (&sum)[N]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Reduce", N, "::Sum");
+            const std::size_t count = points.size();
+            std::size_t i = 0;
+            __m128 total;
+            if constexpr (Wide)
+            {
+                __m128 accumulators[4] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+                for (; i + 4 <= count; i += 4)
+                {
+                    for (std::size_t a = 0; a < 4; ++a)
+                        accumulators[a] = _mm_add_ps(accumulators[a], Detail::LoadVectorSSE(points[i + a]));
+                }
+                for (; i < count; ++i)
+                    accumulators[0] = _mm_add_ps(accumulators[0], Detail::LoadVectorSSE(points[i]));
+                total = _mm_add_ps(_mm_add_ps(accumulators[0], accumulators[1]), _mm_add_ps(accumulators[2], accumulators[3]));
+            }
+            else
+            {
+                // Two groups of 4 points per iteration, 6 independent additions
+                __m128 accumulators[6] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+                for (; i + 8 <= count; i += 8)
+                {
+                    const float* data = &points[i].x();
+                    for (std::size_t a = 0; a < 6; ++a)
+                        accumulators[a] = _mm_add_ps(accumulators[a], _mm_loadu_ps(data + 4 * a));
+                }
+                __m128 x, y, z;
+                Detail::ToSoASSE(_mm_add_ps(accumulators[0], accumulators[3]), _mm_add_ps(accumulators[1], accumulators[4]), _mm_add_ps(accumulators[2], accumulators[5]), x, y, z);
+                total = Combine(HorizontalSum(x), HorizontalSum(y), HorizontalSum(z));
+                for (; i < count; ++i)
+                    total = _mm_add_ps(total, _mm_setr_ps(points[i].x(), points[i].y(), points[i].z(), 0.0f));
+            }
+            StoreArray(_mm_add_ps(LoadArray(sum), total), sum);
+        }
+
+        // minps and maxps return the second operand when either is NaN, so the point goes first and a NaN component is never picked
+        static inline void MinMax(std::span<const V> points, float (&min)[N], float (&max)[N]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Reduce", N, "::MinMax");
+            const std::size_t count = points.size();
+            std::size_t i = 0;
+            __m128 low, high;
+            if constexpr (Wide)
+            {
+                __m128 lows[2] = { LoadArray(min), LoadArray(min) };
+                __m128 highs[2] = { LoadArray(max), LoadArray(max) };
+                for (; i + 2 <= count; i += 2)
+                {
+                    for (std::size_t a = 0; a < 2; ++a)
+                    {
+                        const __m128 point = Detail::LoadVectorSSE(points[i + a]);
+                        lows[a] = _mm_min_ps(point, lows[a]);
+                        highs[a] = _mm_max_ps(point, highs[a]);
+                    }
+                }
+                for (; i < count; ++i)
+                {
+                    const __m128 point = Detail::LoadVectorSSE(points[i]);
+                    lows[0] = _mm_min_ps(point, lows[0]);
+                    highs[0] = _mm_max_ps(point, highs[0]);
+                }
+                low = _mm_min_ps(lows[0], lows[1]);
+                high = _mm_max_ps(highs[0], highs[1]);
+            }
+            else
+            {
+                // The bounds repeated in the same layout as the points
+                __m128 lows[3] = { _mm_setr_ps(min[0], min[1], min[2], min[0]), _mm_setr_ps(min[1], min[2], min[0], min[1]), _mm_setr_ps(min[2], min[0], min[1], min[2]) };
+                __m128 highs[3] = { _mm_setr_ps(max[0], max[1], max[2], max[0]), _mm_setr_ps(max[1], max[2], max[0], max[1]), _mm_setr_ps(max[2], max[0], max[1], max[2]) };
+                for (; i + 4 <= count; i += 4)
+                {
+                    const float* data = &points[i].x();
+                    for (std::size_t a = 0; a < 3; ++a)
+                    {
+                        const __m128 values = _mm_loadu_ps(data + 4 * a);
+                        lows[a] = _mm_min_ps(values, lows[a]);
+                        highs[a] = _mm_max_ps(values, highs[a]);
+                    }
+                }
+                __m128 x, y, z;
+                Detail::ToSoASSE(lows[0], lows[1], lows[2], x, y, z);
+                low = Combine(HorizontalMin(x), HorizontalMin(y), HorizontalMin(z));
+                Detail::ToSoASSE(highs[0], highs[1], highs[2], x, y, z);
+                high = Combine(HorizontalMax(x), HorizontalMax(y), HorizontalMax(z));
+                for (; i < count; ++i)
+                {
+                    const __m128 point = _mm_setr_ps(points[i].x(), points[i].y(), points[i].z(), 0.0f);
+                    low = _mm_min_ps(point, low);
+                    high = _mm_max_ps(point, high);
+                }
+            }
+            StoreArray(low, min);
+            StoreArray(high, max);
+        }
+
+        static inline void Covariance(std::span<const V> points, const float (&mean)[3], float (&sums)[6]) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Reduce", N, "::Covariance");
+            const std::size_t count = points.size();
+            std::size_t i = 0;
+            // xx, xy, xz, yy, yz, zz
+            __m128 accumulators[6] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+            if constexpr (Wide)
+            {
+                // d * d is xx yy zz, and d * d.yzx is xy yz zx, two points at a time
+                const __m128 center = _mm_setr_ps(mean[0], mean[1], mean[2], 0.0f);
+                for (; i + 2 <= count; i += 2)
+                {
+                    for (std::size_t a = 0; a < 2; ++a)
+                    {
+                        const __m128 d = _mm_sub_ps(Detail::LoadVectorSSE(points[i + a]), center);
+                        accumulators[3 * a] = _mm_add_ps(accumulators[3 * a], _mm_mul_ps(d, d));
+                        accumulators[3 * a + 1] = _mm_add_ps(accumulators[3 * a + 1], _mm_mul_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(3, 0, 2, 1))));
+                    }
+                }
+                for (; i < count; ++i)
+                {
+                    const __m128 d = _mm_sub_ps(Detail::LoadVectorSSE(points[i]), center);
+                    accumulators[0] = _mm_add_ps(accumulators[0], _mm_mul_ps(d, d));
+                    accumulators[1] = _mm_add_ps(accumulators[1], _mm_mul_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(3, 0, 2, 1))));
+                }
+
+                PULSARION_MATH_ALIGN float diagonal[4], offDiagonal[4];
+                _mm_store_ps(diagonal, _mm_add_ps(accumulators[0], accumulators[3]));
+                _mm_store_ps(offDiagonal, _mm_add_ps(accumulators[1], accumulators[4]));
+                sums[0] += diagonal[0];
+                sums[1] += offDiagonal[0];
+                sums[2] += offDiagonal[2];
+                sums[3] += diagonal[1];
+                sums[4] += offDiagonal[1];
+                sums[5] += diagonal[2];
+            }
+            else
+            {
+                const __m128 meanX = _mm_set1_ps(mean[0]), meanY = _mm_set1_ps(mean[1]), meanZ = _mm_set1_ps(mean[2]);
+                for (; i + 4 <= count; i += 4)
+                {
+                    const float* data = &points[i].x();
+                    __m128 x, y, z;
+                    Detail::ToSoASSE(_mm_loadu_ps(data), _mm_loadu_ps(data + 4), _mm_loadu_ps(data + 8), x, y, z);
+                    x = _mm_sub_ps(x, meanX);
+                    y = _mm_sub_ps(y, meanY);
+                    z = _mm_sub_ps(z, meanZ);
+                    accumulators[0] = _mm_add_ps(accumulators[0], _mm_mul_ps(x, x));
+                    accumulators[1] = _mm_add_ps(accumulators[1], _mm_mul_ps(x, y));
+                    accumulators[2] = _mm_add_ps(accumulators[2], _mm_mul_ps(x, z));
+                    accumulators[3] = _mm_add_ps(accumulators[3], _mm_mul_ps(y, y));
+                    accumulators[4] = _mm_add_ps(accumulators[4], _mm_mul_ps(y, z));
+                    accumulators[5] = _mm_add_ps(accumulators[5], _mm_mul_ps(z, z));
+                }
+
+                // Two horizontal adds sum four registers at once
+                PULSARION_MATH_ALIGN float total[8];
+                _mm_store_ps(total, _mm_hadd_ps(_mm_hadd_ps(accumulators[0], accumulators[1]), _mm_hadd_ps(accumulators[2], accumulators[3])));
+                _mm_store_ps(total + 4, _mm_hadd_ps(_mm_hadd_ps(accumulators[4], accumulators[5]), _mm_setzero_ps()));
+                for (; i < count; ++i)
+                {
+                    const float x = points[i].x() - mean[0];
+                    const float y = points[i].y() - mean[1];
+                    const float z = points[i].z() - mean[2];
+                    total[0] += x * x;
+                    total[1] += x * y;
+                    total[2] += x * z;
+                    total[3] += y * y;
+                    total[4] += y * z;
+                    total[5] += z * z;
+                }
+                for (std::size_t k = 0; k < 6; ++k)
+                    sums[k] += total[k];
+            }
+        }
+
+    private:
+        static inline __m128 LoadArray(const float (&values)[N]) noexcept
+        {
+            if constexpr (N == 4)
+                return _mm_loadu_ps(values);
+            else
+                return _mm_setr_ps(values[0], values[1], values[2], 0.0f);
+        }
+
+        static inline void StoreArray(__m128 value, float (&values)[N]) noexcept
+        {
+            PULSARION_MATH_ALIGN float lanes[4];
+            _mm_store_ps(lanes, value);
+            for (std::size_t d = 0; d < N; ++d)
+                values[d] = lanes[d];
+        }
+
+        // x y z 0 from the first lanes
+        static inline __m128 Combine(__m128 x, __m128 y, __m128 z) noexcept
+        {
+            return _mm_movelh_ps(_mm_unpacklo_ps(x, y), _mm_unpacklo_ps(z, _mm_setzero_ps()));
+        }
+
+        static inline __m128 HorizontalSum(__m128 value) noexcept
+        {
+            value = _mm_add_ps(value, _mm_movehl_ps(value, value));
+            return _mm_add_ss(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 1, 1, 1)));
+        }
+
+        static inline __m128 HorizontalMin(__m128 value) noexcept
+        {
+            value = _mm_min_ps(value, _mm_movehl_ps(value, value));
+            return _mm_min_ss(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 1, 1, 1)));
+        }
+
+        static inline __m128 HorizontalMax(__m128 value) noexcept
+        {
+            value = _mm_max_ps(value, _mm_movehl_ps(value, value));
+            return _mm_max_ss(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 1, 1, 1)));
+        }
+    };
+
+    template<>
+    struct ReduceFunctions<4, float, Qualifier::Aligned> : ReduceFunctionsSSE<4, Qualifier::Aligned> {};
+
+    template<>
+    struct ReduceFunctions<4, float, Qualifier::Packed> : ReduceFunctionsSSE<4, Qualifier::Packed> {};
+
+    template<>
+    struct ReduceFunctions<3, float, Qualifier::Aligned> : ReduceFunctionsSSE<3, Qualifier::Aligned> {};
+
+    template<>
+    struct ReduceFunctions<3, float, Qualifier::Packed> : ReduceFunctionsSSE<3, Qualifier::Packed> {};
+}
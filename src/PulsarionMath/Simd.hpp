@@ -1,5 +1,9 @@
 #pragma once
 
+// With PULSARION_MATH_DETERMINISTIC, float results are bit identical on every compiler, machine and SIMD backend: the SIMD kernels
+// that add in another order than the scalar ones (or approximate) are left out, the ones that match them bit for bit are kept,
+// and the build disables the contraction of multiplications and additions into FMA. Fixed point (Fixed.hpp) is deterministic regardless.
+
 #ifdef PULSARION_MATH_SIMD_SSE4_1
 #define PULSARION_MATH_ALIGN alignas(16)
 #elif defined(PULSARION_MATH_SIMD_AVX)
@@ -0,0 +1,201 @@
+#pragma once
+#define PULSARION_MATH_SPATIAL_HASH_GRID_HPP
+
+#include "Vector.hpp"
+#include "AlignedAllocator.hpp"
+#include "Parallel.hpp"
+#include "SpatialHashGridCommon.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// A uniform grid of cubic cells, hashed into a table of buckets, for radius queries over particles (SPH, crowds, ...).
+// Build sorts the particles by bucket with a counting sort (no allocation per cell), and keeps a copy of their positions
+// in that order, as separate x, y and z arrays, so a query reads each candidate bucket as one contiguous run and checks it
+// with SIMD distance tests. Different cells can share a bucket, the distance test removes their particles.
+// Only the xyz of the positions are used. The build is deterministic, particles in a bucket stay in their original order.
+namespace Pulsarion::Math
+{
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    requires (N == 3 || N == 4)
+    class SpatialHashGrid
+    {
+    public:
+        // A cell size around the query radius keeps a query to the 27 cells around the center
+        explicit inline SpatialHashGrid(T cellSize) noexcept : m_CellSize(cellSize), m_InverseCellSize(T(1) / cellSize) {}
+
+        // Rebuilds the grid for the positions, reusing the memory of the previous build.
+        // The table has a bucket per particle (rounded up to a power of 2), unless a bigger bucketCount is given.
+        inline void Build(std::span<const Vector<N, T, Q>> positions, std::size_t threadCount = DefaultThreadCount(), std::size_t bucketCount = 0)
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("SpatialHashGrid::Build");
+            const std::size_t count = positions.size();
+            m_Mask = std::bit_ceil(std::max<std::size_t>({ count, bucketCount, 1 })) - 1;
+            const std::size_t buckets = m_Mask + 1;
+            threadCount = std::clamp<std::size_t>(threadCount, 1, std::max<std::size_t>(1, count / SpatialHashGridConstants::ParallelGranularity));
+
+            m_Buckets.resize(count);
+            m_Indices.resize(count);
+            m_X.resize(count);
+            m_Y.resize(count);
+            m_Z.resize(count);
+            m_Start.assign(buckets + 1, 0);
+            // A histogram per thread, bucket major, so the threads scatter into disjoint ranges and the result doesn't depend on the thread count
+            std::vector<std::uint32_t> counts(buckets * threadCount, 0);
+
+            const auto ranges = [&](auto&& func) {
+                ParallelFor(count, SpatialHashGridConstants::ParallelGranularity, threadCount, func);
+            };
+            ranges([&](std::size_t begin, std::size_t end, std::size_t thread) {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const auto bucket = static_cast<std::uint32_t>(Bucket(positions[i][0], positions[i][1], positions[i][2]));
+                    m_Buckets[i] = bucket;
+                    ++counts[bucket * threadCount + thread];
+                }
+            });
+
+            std::uint32_t offset = 0;
+            for (std::size_t bucket = 0; bucket < buckets; ++bucket)
+            {
+                m_Start[bucket] = offset;
+                for (std::size_t thread = 0; thread < threadCount; ++thread)
+                {
+                    const std::uint32_t threadBucketCount = counts[bucket * threadCount + thread];
+                    counts[bucket * threadCount + thread] = offset;
+                    offset += threadBucketCount;
+                }
+            }
+            m_Start[buckets] = offset;
+
+            ranges([&](std::size_t begin, std::size_t end, std::size_t thread) {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const std::uint32_t slot = counts[m_Buckets[i] * threadCount + thread]++;
+                    m_Indices[slot] = static_cast<std::uint32_t>(i);
+                    m_X[slot] = positions[i][0];
+                    m_Y[slot] = positions[i][1];
+                    m_Z[slot] = positions[i][2];
+                }
+            });
+        }
+
+        // Calls callback(index, distanceSquared) for every particle within radius of center (inclusive), in no particular order
+        template<typename F>
+        inline void QueryRadius(const Vector<N, T, Q>& center, T radius, F&& callback) const
+        {
+            if (m_Indices.empty())
+                return;
+
+            const T point[3] = { center[0], center[1], center[2] };
+            const T radiusSquared = radius * radius;
+            std::int64_t low[3], high[3];
+            for (std::size_t d = 0; d < 3; ++d)
+            {
+                low[d] = Cell(point[d] - radius);
+                high[d] = Cell(point[d] + radius);
+            }
+
+            // Cells that share a bucket must report its particles once. Up to MaxSortedCells cells (the usual 27), the buckets are
+            // collected, sorted and searched once each. Bigger queries search the bucket of every cell, but only report
+            // a particle from the cell it is in
+            const auto search = [&](std::size_t bucket, auto&& report) {
+                const std::uint32_t begin = m_Start[bucket], end = m_Start[bucket + 1];
+                if (begin != end)
+                {
+                    SpatialHashGridFunctions<T>::Within(m_X.data() + begin, m_Y.data() + begin, m_Z.data() + begin, end - begin, point, radiusSquared,
+                                                        [&](std::size_t i, T distanceSquared) { report(begin + i, distanceSquared); });
+                }
+            };
+
+            constexpr std::size_t MaxCells = SpatialHashGridConstants::MaxSortedCells;
+            std::uint64_t extent[3];
+            for (std::size_t d = 0; d < 3; ++d)
+                extent[d] = static_cast<std::uint64_t>(high[d] - low[d]) + 1;
+            if (extent[0] <= MaxCells && extent[1] <= MaxCells && extent[2] <= MaxCells && extent[0] * extent[1] * extent[2] <= MaxCells)
+            {
+                std::size_t buckets[MaxCells];
+                std::size_t bucketCount = 0;
+                for (std::int64_t z = low[2]; z <= high[2]; ++z)
+                {
+                    for (std::int64_t y = low[1]; y <= high[1]; ++y)
+                    {
+                        for (std::int64_t x = low[0]; x <= high[0]; ++x)
+                            buckets[bucketCount++] = Hash(x, y, z) & m_Mask;
+                    }
+                }
+                std::sort(buckets, buckets + bucketCount);
+                const std::size_t* last = std::unique(buckets, buckets + bucketCount);
+                for (const std::size_t* bucket = buckets; bucket != last; ++bucket)
+                    search(*bucket, [&](std::size_t slot, T distanceSquared) { callback(m_Indices[slot], distanceSquared); });
+                return;
+            }
+
+            for (std::int64_t z = low[2]; z <= high[2]; ++z)
+            {
+                for (std::int64_t y = low[1]; y <= high[1]; ++y)
+                {
+                    for (std::int64_t x = low[0]; x <= high[0]; ++x)
+                    {
+                        search(Hash(x, y, z) & m_Mask, [&](std::size_t slot, T distanceSquared) {
+                            if (Cell(m_X[slot]) == x && Cell(m_Y[slot]) == y && Cell(m_Z[slot]) == z)
+                                callback(m_Indices[slot], distanceSquared);
+                        });
+                    }
+                }
+            }
+        }
+
+        // Appends the indices of the particles within radius of center to result, and returns how many there were
+        inline std::size_t QueryRadius(const Vector<N, T, Q>& center, T radius, std::vector<std::uint32_t>& result) const
+        {
+            const std::size_t before = result.size();
+            QueryRadius(center, radius, [&result](std::uint32_t index, T) { result.push_back(index); });
+            return result.size() - before;
+        }
+
+        [[nodiscard]] inline T CellSize() const noexcept { return m_CellSize; }
+        [[nodiscard]] inline std::size_t Size() const noexcept { return m_Indices.size(); }
+        [[nodiscard]] inline std::size_t BucketCount() const noexcept { return m_Start.empty() ? 0 : m_Mask + 1; }
+        // The particle indices in bucket order, iterating particles in this order keeps neighbors close in memory
+        [[nodiscard]] inline std::span<const std::uint32_t> SortedIndices() const noexcept { return m_Indices; }
+
+    private:
+        T m_CellSize;
+        T m_InverseCellSize;
+        std::size_t m_Mask = 0;
+        std::vector<std::uint32_t> m_Buckets;      // Per particle, in the original order
+        std::vector<std::uint32_t> m_Start;        // First sorted slot of each bucket, and the particle count at the end
+        std::vector<std::uint32_t> m_Indices;      // Original index of each sorted slot
+        std::vector<T, AlignedAllocator<T>> m_X;   // Sorted positions
+        std::vector<T, AlignedAllocator<T>> m_Y;
+        std::vector<T, AlignedAllocator<T>> m_Z;
+
+        inline std::int64_t Cell(T coordinate) const noexcept
+        {
+            return static_cast<std::int64_t>(std::floor(coordinate * m_InverseCellSize));
+        }
+
+        // The usual large primes of spatial hashing, on the wrapped 32 bit cell coordinates
+        static inline std::size_t Hash(std::int64_t x, std::int64_t y, std::int64_t z) noexcept
+        {
+            const auto h = (static_cast<std::uint32_t>(x) * 73856093u) ^ (static_cast<std::uint32_t>(y) * 19349663u) ^ (static_cast<std::uint32_t>(z) * 83492791u);
+            return static_cast<std::size_t>(h);
+        }
+
+        inline std::size_t Bucket(T x, T y, T z) const noexcept
+        {
+            return Hash(Cell(x), Cell(y), Cell(z)) & m_Mask;
+        }
+    };
+}
+
+#include "SpatialHashGridGeneric.hpp"
+
+#ifdef PULSARION_MATH_SIMD_SSE4_1
+#include "SpatialHashGridSSE.hpp"
+#endif
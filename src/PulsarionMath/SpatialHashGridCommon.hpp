@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct SpatialHashGridFunctions; // Distance checks of a point against a run of SoA positions.
+
+    struct SpatialHashGridConstants
+    {
+        // Particles per thread below which the build doesn't start threads
+        static constexpr std::size_t ParallelGranularity = 16 * 1024;
+        // Queries over at most this many cells sort their buckets on the stack to search each once (a 4x4x4 block)
+        static constexpr std::size_t MaxSortedCells = 64;
+    };
+}
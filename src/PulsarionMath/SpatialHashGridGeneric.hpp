@@ -0,0 +1,26 @@
+#pragma once
+
+#ifndef PULSARION_MATH_SPATIAL_HASH_GRID_HPP
+#include "SpatialHashGrid.hpp"
+#endif
+
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct SpatialHashGridFunctions
+    {
+        // Calls hit(i, distanceSquared) for every i in [0, count) with (x[i], y[i], z[i]) within the radius of center, in order
+        template<typename F>
+        static inline void Within(const T* x, const T* y, const T* z, std::size_t count, const T (&center)[3], T radiusSquared, F&& hit)
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("SpatialHashGrid::Within");
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const T dx = x[i] - center[0], dy = y[i] - center[1], dz = z[i] - center[2];
+                const T distanceSquared = dx * dx + dy * dy + dz * dz;
+                if (distanceSquared <= radiusSquared)
+                    hit(i, distanceSquared);
+            }
+        }
+    };
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#ifndef PULSARION_MATH_SPATIAL_HASH_GRID_HPP
+#include "SpatialHashGrid.hpp"
+#endif
+
+#include <bit>
+#include <immintrin.h>
+
+namespace Pulsarion::Math
+{
+    // 4 candidates per iteration, the hits are the set bits of the movemask of the comparison
+    template<>
+    struct SpatialHashGridFunctions<float>
+    {
+        template<typename F>
+        static inline void Within(const float* x, const float* y, const float* z, std::size_t count, const float (&center)[3], float radiusSquared, F&& hit)
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("SpatialHashGrid::Within");
+            const __m128 cx = _mm_set1_ps(center[0]);
+            const __m128 cy = _mm_set1_ps(center[1]);
+            const __m128 cz = _mm_set1_ps(center[2]);
+            const __m128 radius = _mm_set1_ps(radiusSquared);
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128 dx = _mm_sub_ps(_mm_loadu_ps(x + i), cx);
+                const __m128 dy = _mm_sub_ps(_mm_loadu_ps(y + i), cy);
+                const __m128 dz = _mm_sub_ps(_mm_loadu_ps(z + i), cz);
+                const __m128 distanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+                unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(distanceSquared, radius)));
+                if (mask == 0)
+                    continue;
+
+                PULSARION_MATH_ALIGN float distances[4];
+                _mm_store_ps(distances, distanceSquared);
+                for (; mask != 0; mask &= mask - 1)
+                {
+                    const auto lane = static_cast<std::size_t>(std::countr_zero(mask));
+                    hit(i + lane, distances[lane]);
+                }
+            }
+            for (; i < count; ++i)
+            {
+                const float dx = x[i] - center[0], dy = y[i] - center[1], dz = z[i] - center[2];
+                const float distanceSquared = dx * dx + dy * dy + dz * dz;
+                if (distanceSquared <= radiusSquared)
+                    hit(i, distanceSquared);
+            }
+        }
+    };
+}
@@ -0,0 +1,100 @@
+#pragma once
+#define PULSARION_MATH_SWIZZLE_HPP
+
+#include "Vector.hpp"
+#include "SwizzleCommon.hpp"
+
+// Swizzles: a vector made of the components of another, picked by indices known at compile time (v.zyxw, v.xxyy, v.wwww in shading languages).
+// The result has as many components as there are indices and the same qualifier, float vectors of 3 and 4 components are a single shuffle with SSE.
+namespace Pulsarion::Math
+{
+    template<std::size_t... I, std::size_t N, Arithmetic_t T, Qualifier Q>
+    requires (sizeof...(I) >= 2 && sizeof...(I) <= 4 && ((I < N) && ...))
+    inline constexpr Vector<sizeof...(I), T, Q> Swizzle(const Vector<N, T, Q>& vector) noexcept
+    {
+        return SwizzleFunctions<N, T, Q>::template swizzle<I...>(vector);
+    }
+
+    // All components set to component I
+    template<std::size_t I, std::size_t N, Arithmetic_t T, Qualifier Q>
+    requires (I < N)
+    inline constexpr Vector<N, T, Q> Broadcast(const Vector<N, T, Q>& vector) noexcept
+    {
+        if constexpr (N == 4)
+            return Swizzle<I, I, I, I>(vector);
+        else if constexpr (N == 3)
+            return Swizzle<I, I, I>(vector);
+        else
+            return Swizzle<I, I>(vector);
+    }
+
+    // ---- Named swizzles ----
+    // Broadcasts
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> XXXX(const Vector<4, T, Q>& vector) noexcept { return Broadcast<0>(vector); }
+
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> YYYY(const Vector<4, T, Q>& vector) noexcept { return Broadcast<1>(vector); }
+
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> ZZZZ(const Vector<4, T, Q>& vector) noexcept { return Broadcast<2>(vector); }
+
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> WWWW(const Vector<4, T, Q>& vector) noexcept { return Broadcast<3>(vector); }
+
+    // The rotations of xyz used by cross products (a.yzx * b.zxy - a.zxy * b.yzx), w stays in place
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<3, T, Q> YZX(const Vector<3, T, Q>& vector) noexcept { return Swizzle<1, 2, 0>(vector); }
+
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<3, T, Q> ZXY(const Vector<3, T, Q>& vector) noexcept { return Swizzle<2, 0, 1>(vector); }
+
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> YZXW(const Vector<4, T, Q>& vector) noexcept { return Swizzle<1, 2, 0, 3>(vector); }
+
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> ZXYW(const Vector<4, T, Q>& vector) noexcept { return Swizzle<2, 0, 1, 3>(vector); }
+
+    // Reversals
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<3, T, Q> ZYX(const Vector<3, T, Q>& vector) noexcept { return Swizzle<2, 1, 0>(vector); }
+
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> ZYXW(const Vector<4, T, Q>& vector) noexcept { return Swizzle<2, 1, 0, 3>(vector); }
+
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> WZYX(const Vector<4, T, Q>& vector) noexcept { return Swizzle<3, 2, 1, 0>(vector); }
+
+    // Pairs, for 2 component values packed in 4 and quaternion products
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> XXYY(const Vector<4, T, Q>& vector) noexcept { return Swizzle<0, 0, 1, 1>(vector); }
+
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> ZZWW(const Vector<4, T, Q>& vector) noexcept { return Swizzle<2, 2, 3, 3>(vector); }
+
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> XYXY(const Vector<4, T, Q>& vector) noexcept { return Swizzle<0, 1, 0, 1>(vector); }
+
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> ZWZW(const Vector<4, T, Q>& vector) noexcept { return Swizzle<2, 3, 2, 3>(vector); }
+
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> YXWZ(const Vector<4, T, Q>& vector) noexcept { return Swizzle<1, 0, 3, 2>(vector); }
+
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<4, T, Q> ZWXY(const Vector<4, T, Q>& vector) noexcept { return Swizzle<2, 3, 0, 1>(vector); }
+
+    // Truncation
+    template<Arithmetic_t T, Qualifier Q>
+    inline constexpr Vector<3, T, Q> XYZ(const Vector<4, T, Q>& vector) noexcept { return Swizzle<0, 1, 2>(vector); }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    requires (N >= 3)
+    inline constexpr Vector<2, T, Q> XY(const Vector<N, T, Q>& vector) noexcept { return Swizzle<0, 1>(vector); }
+}
+
+#include "SwizzleGeneric.hpp"
+
+#if defined(PULSARION_MATH_SIMD_SSE4_1)
+#include "SwizzleSSE.hpp"
+#endif
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+#include "Qualifier.hpp"
+
+namespace Pulsarion::Math
+{
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    struct SwizzleFunctions; // Reorders the components of vectors with indices known at compile time.
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#ifndef PULSARION_MATH_SWIZZLE_HPP
+#include "Swizzle.hpp"
+#endif
+
+namespace Pulsarion::Math
+{
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    struct SwizzleFunctions
+    {
+        template<std::size_t... I>
+        static inline constexpr Vector<sizeof...(I), T, Q> swizzle(const Vector<N, T, Q>& vector) noexcept
+        {
+            return Vector<sizeof...(I), T, Q>(vector[I]...);
+        }
+    };
+}
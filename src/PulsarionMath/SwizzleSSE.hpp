@@ -0,0 +1,57 @@
+#pragma once
+
+#ifndef PULSARION_MATH_SWIZZLE_HPP
+#include "Swizzle.hpp"
+#endif
+
+#include "VectorLayoutSSE.hpp"
+
+#include <immintrin.h>
+#include <type_traits>
+
+namespace Pulsarion::Math
+{
+    // One shufps of the vector with itself. Aligned 3 component results need a zero in the padding lane: a 3 component source has it
+    // in lane 3 already (the padding, or the zeroed upper lane of movss for packed ones), a 4 component source is blended with zero.
+    // Packed 3 component vectors are loaded and stored as 8 + 4 bytes, and 2 component results are reindexed like the generic ones.
+    template<std::size_t N, Qualifier Q>
+    struct SwizzleFunctionsSSE
+    {
+        using V = Vector<N, float, Q>;
+
+        template<std::size_t... I>
+        static inline constexpr Vector<sizeof...(I), float, Q> swizzle(const V& vector) noexcept
+        {
+            constexpr std::size_t M = sizeof...(I);
+            if constexpr (M == 2)
+                return Vector<M, float, Q>(vector[I]...);
+            else
+            {
+                if (std::is_constant_evaluated())
+                    return Vector<M, float, Q>(vector[I]...);
+                constexpr std::size_t indices[M] = { I... };
+                constexpr std::size_t last = M == 4 ? indices[M - 1] : N == 3 ? 3 : 0;
+                constexpr int control = _MM_SHUFFLE(last, indices[2], indices[1], indices[0]);
+                const __m128 value = Detail::LoadVectorSSE(vector);
+                __m128 result = _mm_shuffle_ps(value, value, control);
+                if constexpr (M == 3 && N == 4 && Q == Qualifier::Aligned)
+                    result = _mm_blend_ps(result, _mm_setzero_ps(), 0b1000);
+                Vector<M, float, Q> swizzled;
+                Detail::StoreVectorSSE(result, swizzled);
+                return swizzled;
+            }
+        }
+    };
+
+    template<>
+    struct SwizzleFunctions<4, float, Qualifier::Aligned> : SwizzleFunctionsSSE<4, Qualifier::Aligned> {};
+
+    template<>
+    struct SwizzleFunctions<4, float, Qualifier::Packed> : SwizzleFunctionsSSE<4, Qualifier::Packed> {};
+
+    template<>
+    struct SwizzleFunctions<3, float, Qualifier::Aligned> : SwizzleFunctionsSSE<3, Qualifier::Aligned> {};
+
+    template<>
+    struct SwizzleFunctions<3, float, Qualifier::Packed> : SwizzleFunctionsSSE<3, Qualifier::Packed> {};
+}
@@ -0,0 +1,111 @@
+#pragma once
+#define PULSARION_MATH_SYMMETRIC_EIGEN_HPP
+
+#include "Vector.hpp"
+#include "Matrix.hpp"
+#include "SymmetricEigenCommon.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+// Eigen decomposition A = V * diag(values) * V^T of symmetric 3x3 matrices (covariance matrices, inertia tensors), with the Jacobi method.
+// The eigenvalues are sorted from largest to smallest, and column i of vectors is the unit eigenvector of value i.
+// The vectors are orthonormal, but may be a reflection (a determinant of -1). The matrices are assumed to be symmetric,
+// the average of the two triangles is used.
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct EigenDecomposition
+    {
+        Vector<3, T, Qualifier::Aligned> values;
+        Matrix<3, 3, T> vectors;
+    };
+
+    // The scalar Jacobi solver, a matrix at a time, which the batched kernels are tested against
+    template<FloatingPoint_t T>
+    [[nodiscard]] inline EigenDecomposition<T> SymmetricEigenReference(const Matrix<3, 3, T>& matrix, std::size_t sweeps = SymmetricEigenConstants::Sweeps) noexcept
+    {
+        T a[3][3], v[3][3] = { { T(1), T(0), T(0) }, { T(0), T(1), T(0) }, { T(0), T(0), T(1) } };
+        for (std::size_t row = 0; row < 3; ++row)
+        {
+            for (std::size_t column = 0; column < 3; ++column)
+                a[row][column] = T(0.5) * (matrix.Get(row, column) + matrix.Get(column, row));
+        }
+
+        constexpr std::size_t pairs[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+        for (std::size_t sweep = 0; sweep < sweeps; ++sweep)
+        {
+            for (const auto& pair : pairs)
+            {
+                const std::size_t p = pair[0], q = pair[1], r = 3 - p - q;
+                if (a[p][q] == T(0))
+                    continue;
+
+                // The rotation that zeroes a[p][q], t = tan of its angle, the smaller root so |angle| <= pi / 4
+                const T theta = (a[q][q] - a[p][p]) / (T(2) * a[p][q]);
+                const T t = std::copysign(T(1), theta) / (std::abs(theta) + std::sqrt(theta * theta + T(1)));
+                const T c = T(1) / std::sqrt(t * t + T(1));
+                const T s = t * c;
+
+                a[p][p] -= t * a[p][q];
+                a[q][q] += t * a[p][q];
+                a[p][q] = a[q][p] = T(0);
+                const T rp = c * a[r][p] - s * a[r][q];
+                const T rq = s * a[r][p] + c * a[r][q];
+                a[r][p] = a[p][r] = rp;
+                a[r][q] = a[q][r] = rq;
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    const T kp = c * v[k][p] - s * v[k][q];
+                    const T kq = s * v[k][p] + c * v[k][q];
+                    v[k][p] = kp;
+                    v[k][q] = kq;
+                }
+            }
+        }
+
+        // Sorting network of the 3 values, largest first
+        std::size_t order[3] = { 0, 1, 2 };
+        const auto sort = [&](std::size_t i, std::size_t j) {
+            if (a[order[i]][order[i]] < a[order[j]][order[j]])
+                std::swap(order[i], order[j]);
+        };
+        sort(0, 1);
+        sort(1, 2);
+        sort(0, 1);
+
+        EigenDecomposition<T> result;
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            result.values[i] = a[order[i]][order[i]];
+            for (std::size_t k = 0; k < 3; ++k)
+                result.vectors.Get(k, i) = v[k][order[i]];
+        }
+        return result;
+    }
+
+    template<FloatingPoint_t T>
+    inline void SymmetricEigen(std::type_identity_t<std::span<const Matrix<3, 3, T>>> matrices, std::type_identity_t<std::span<EigenDecomposition<T>>> results,
+                               std::size_t sweeps = SymmetricEigenConstants::Sweeps) noexcept
+    {
+        assert(matrices.size() == results.size());
+        SymmetricEigenFunctions<T>::Solve(matrices, results, sweeps);
+    }
+
+    template<FloatingPoint_t T>
+    [[nodiscard]] inline EigenDecomposition<T> SymmetricEigen(const Matrix<3, 3, T>& matrix, std::size_t sweeps = SymmetricEigenConstants::Sweeps) noexcept
+    {
+        EigenDecomposition<T> result;
+        SymmetricEigenFunctions<T>::Solve(std::span<const Matrix<3, 3, T>>(&matrix, 1), std::span<EigenDecomposition<T>>(&result, 1), sweeps);
+        return result;
+    }
+}
+
+#include "SymmetricEigenGeneric.hpp"
+
+#if defined(PULSARION_MATH_SIMD_SSE4_1) && defined(PULSARION_MATH_MATRIX_COLUMN_MAJOR) && !defined(PULSARION_MATH_DETERMINISTIC)
+#include "SymmetricEigenSSE.hpp"
+#endif
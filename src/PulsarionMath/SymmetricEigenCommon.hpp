@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct SymmetricEigenFunctions; // Eigenvalues and eigenvectors of spans of symmetric 3x3 matrices.
+
+    struct SymmetricEigenConstants
+    {
+        // Cyclic Jacobi converges quadratically, 4 sweeps of the 3 rotations already reach the rounding error of a double
+        // on random matrices, the fifth is a margin. The count is fixed so lanes of different matrices never wait for each other.
+        static constexpr std::size_t Sweeps = 5;
+    };
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#ifndef PULSARION_MATH_SYMMETRIC_EIGEN_HPP
+#include "SymmetricEigen.hpp"
+#endif
+
+#include <span>
+
+namespace Pulsarion::Math
+{
+    template<FloatingPoint_t T>
+    struct SymmetricEigenFunctions
+    {
+        static inline void Solve(std::span<const Matrix<3, 3, T>> matrices, std::span<EigenDecomposition<T>> results, std::size_t sweeps) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("SymmetricEigen::Solve");
+            for (std::size_t i = 0; i < matrices.size(); ++i)
+                results[i] = SymmetricEigenReference<T>(matrices[i], sweeps);
+        }
+    };
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#ifndef PULSARION_MATH_SYMMETRIC_EIGEN_HPP
+#include "SymmetricEigen.hpp"
+#endif
+
+#include <immintrin.h>
+#include <span>
+
+namespace Pulsarion::Math
+{
+    // 4 matrices at a time, a lane each: the 6 distinct elements and the 9 of the eigenvectors are registers holding that element of all 4.
+    // Every rotation is computed in every lane, a zero off diagonal element gets the identity rotation from a mask instead of a branch,
+    // and the final sort is compare and blend. A span that isn't a multiple of 4 is padded with identity matrices.
+    template<>
+    struct SymmetricEigenFunctions<float>
+    {
+        static inline void Solve(std::span<const Matrix<3, 3, float>> matrices, std::span<EigenDecomposition<float>> results, std::size_t sweeps) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("SymmetricEigen::Solve");
+            static const Matrix<3, 3, float> identity;
+            EigenDecomposition<float> scratch[4];
+            for (std::size_t i = 0; i < matrices.size(); i += 4)
+            {
+                const Matrix<3, 3, float>* in[4];
+                EigenDecomposition<float>* out[4];
+                for (std::size_t lane = 0; lane < 4; ++lane)
+                {
+                    const bool valid = i + lane < matrices.size();
+                    in[lane] = valid ? &matrices[i + lane] : &identity;
+                    out[lane] = valid ? &results[i + lane] : &scratch[lane];
+                }
+                Solve4(in, out, sweeps);
+            }
+        }
+
+    private:
+        struct Lanes
+        {
+            __m128 a00, a11, a22, a01, a02, a12;
+            __m128 v[3][3]; // v[row][column]
+        };
+
+        static inline void Solve4(const Matrix<3, 3, float>* const (&in)[4], EigenDecomposition<float>* const (&out)[4], std::size_t sweeps) noexcept
+        {
+            const __m128 half = _mm_set1_ps(0.5f);
+            Lanes lanes;
+            __m128 columns[3][4];
+            for (std::size_t column = 0; column < 3; ++column)
+            {
+                for (std::size_t lane = 0; lane < 4; ++lane)
+                    columns[column][lane] = _mm_load_ps(&(*in[lane])[column].x());
+                // Now columns[column][row] is element (row, column) of every matrix
+                _MM_TRANSPOSE4_PS(columns[column][0], columns[column][1], columns[column][2], columns[column][3]);
+            }
+            lanes.a00 = columns[0][0];
+            lanes.a11 = columns[1][1];
+            lanes.a22 = columns[2][2];
+            lanes.a01 = _mm_mul_ps(half, _mm_add_ps(columns[1][0], columns[0][1]));
+            lanes.a02 = _mm_mul_ps(half, _mm_add_ps(columns[2][0], columns[0][2]));
+            lanes.a12 = _mm_mul_ps(half, _mm_add_ps(columns[2][1], columns[1][2]));
+            for (std::size_t row = 0; row < 3; ++row)
+            {
+                for (std::size_t column = 0; column < 3; ++column)
+                    lanes.v[row][column] = row == column ? _mm_set1_ps(1.0f) : _mm_setzero_ps();
+            }
+
+            for (std::size_t sweep = 0; sweep < sweeps; ++sweep)
+            {
+                // The third row and column is the one the rotation of p and q leaves alone
+                Rotate<0, 1>(lanes, lanes.a00, lanes.a11, lanes.a01, lanes.a02, lanes.a12);
+                Rotate<0, 2>(lanes, lanes.a00, lanes.a22, lanes.a02, lanes.a01, lanes.a12);
+                Rotate<1, 2>(lanes, lanes.a11, lanes.a22, lanes.a12, lanes.a01, lanes.a02);
+            }
+
+            __m128 values[3] = { lanes.a00, lanes.a11, lanes.a22 };
+            Sort(lanes, values, 0, 1);
+            Sort(lanes, values, 1, 2);
+            Sort(lanes, values, 0, 1);
+
+            __m128 padding = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(values[0], values[1], values[2], padding);
+            const __m128 transposedValues[4] = { values[0], values[1], values[2], padding };
+            for (std::size_t lane = 0; lane < 4; ++lane)
+                _mm_store_ps(&out[lane]->values.x(), transposedValues[lane]);
+
+            for (std::size_t column = 0; column < 3; ++column)
+            {
+                __m128 rows[4] = { lanes.v[0][column], lanes.v[1][column], lanes.v[2][column], _mm_setzero_ps() };
+                _MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+                for (std::size_t lane = 0; lane < 4; ++lane)
+                    _mm_store_ps(&out[lane]->vectors[column].x(), rows[lane]);
+            }
+        }
+
+        // The rotation of p and q that zeroes apq, arp and arq are the elements of the other row in the columns p and q
+        template<std::size_t P, std::size_t Q>
+        static inline void Rotate(Lanes& lanes, __m128& app, __m128& aqq, __m128& apq, __m128& arp, __m128& arq) noexcept
+        {
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 sign = _mm_set1_ps(-0.0f);
+
+            // t = sign(theta) / (|theta| + sqrt(theta^2 + 1)), and 0 in lanes where apq is already 0 (where theta is infinite or NaN)
+            const __m128 theta = _mm_div_ps(_mm_sub_ps(aqq, app), _mm_add_ps(apq, apq));
+            const __m128 magnitude = _mm_add_ps(_mm_andnot_ps(sign, theta), _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(theta, theta), one)));
+            __m128 t = _mm_div_ps(_mm_or_ps(_mm_and_ps(sign, theta), one), magnitude);
+            t = _mm_and_ps(t, _mm_cmpneq_ps(apq, _mm_setzero_ps()));
+            const __m128 c = _mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(t, t), one)));
+            const __m128 s = _mm_mul_ps(t, c);
+
+            const __m128 shift = _mm_mul_ps(t, apq);
+            app = _mm_sub_ps(app, shift);
+            aqq = _mm_add_ps(aqq, shift);
+            apq = _mm_setzero_ps();
+            const __m128 rp = _mm_sub_ps(_mm_mul_ps(c, arp), _mm_mul_ps(s, arq));
+            const __m128 rq = _mm_add_ps(_mm_mul_ps(s, arp), _mm_mul_ps(c, arq));
+            arp = rp;
+            arq = rq;
+
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                const __m128 kp = _mm_sub_ps(_mm_mul_ps(c, lanes.v[k][P]), _mm_mul_ps(s, lanes.v[k][Q]));
+                const __m128 kq = _mm_add_ps(_mm_mul_ps(s, lanes.v[k][P]), _mm_mul_ps(c, lanes.v[k][Q]));
+                lanes.v[k][P] = kp;
+                lanes.v[k][Q] = kq;
+            }
+        }
+
+        // Swaps values i and j (and their vectors) in the lanes where value i is smaller
+        static inline void Sort(Lanes& lanes, __m128 (&values)[3], std::size_t i, std::size_t j) noexcept
+        {
+            const __m128 swap = _mm_cmplt_ps(values[i], values[j]);
+            const __m128 first = _mm_blendv_ps(values[i], values[j], swap);
+            values[j] = _mm_blendv_ps(values[j], values[i], swap);
+            values[i] = first;
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                const __m128 vi = _mm_blendv_ps(lanes.v[k][i], lanes.v[k][j], swap);
+                lanes.v[k][j] = _mm_blendv_ps(lanes.v[k][j], lanes.v[k][i], swap);
+                lanes.v[k][i] = vi;
+            }
+        }
+    };
+}
@@ -0,0 +1,122 @@
+#pragma once
+#define PULSARION_MATH_TRANSCENDENTAL_HPP
+
+#include "Vector.hpp"
+#include "TranscendentalCommon.hpp"
+
+#include <span>
+#include <type_traits>
+
+// Lane-wise transcendental functions on vectors, and on spans of vectors.
+// Errors are measured against a long double reference, in ULP of the result (absolute error for Fast* unless stated):
+//  - Sin, Cos, SinCos: float <= 2 ULP for |x| < 100, 1e-7 absolute for |x| < 8192 (the range reduction loses accuracy past that),
+//    double <= 2 ULP for |x| < 8192
+//  - Tan: float <= 4 ULP for |x| < pi / 2, double <= 4 ULP for |x| < 8192
+//  - Atan2: <= 3 ULP, NaN if either input is NaN
+//  - Exp: <= 2 ULP, overflows to infinity past MaxLog, flushes to zero below MinLog
+//  - Log: <= 1 ULP, log(0) = -infinity, log(x < 0) = NaN
+//  - Pow: exp(y * log(x)), so the error grows with y * log(x): up to 2 * |y * log(x)| ULP, pow(x < 0, y) = NaN
+//  - FastSin, FastCos, FastSinCos: 2e-5 for |x| < 100, 6e-5 for |x| < 1000
+//  - FastExp: 1e-5 relative error, FastLog: 2e-7 on [0.5, 2] and 2e-7 relative elsewhere, both only for finite positive normal inputs
+namespace Pulsarion::Math
+{
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline Vector<N, T, Q> Sin(const Vector<N, T, Q>& vector) noexcept { return TranscendentalFunctions<N, T, Q>::sin(vector); }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline Vector<N, T, Q> Cos(const Vector<N, T, Q>& vector) noexcept { return TranscendentalFunctions<N, T, Q>::cos(vector); }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline void SinCos(const Vector<N, T, Q>& vector, Vector<N, T, Q>& sin, Vector<N, T, Q>& cos) noexcept
+    {
+        TranscendentalFunctions<N, T, Q>::sinCos(vector, sin, cos);
+    }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline Vector<N, T, Q> Tan(const Vector<N, T, Q>& vector) noexcept { return TranscendentalFunctions<N, T, Q>::tan(vector); }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline Vector<N, T, Q> Atan2(const Vector<N, T, Q>& y, const Vector<N, T, Q>& x) noexcept { return TranscendentalFunctions<N, T, Q>::atan2(y, x); }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline Vector<N, T, Q> Exp(const Vector<N, T, Q>& vector) noexcept { return TranscendentalFunctions<N, T, Q>::exp(vector); }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline Vector<N, T, Q> Log(const Vector<N, T, Q>& vector) noexcept { return TranscendentalFunctions<N, T, Q>::log(vector); }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline Vector<N, T, Q> Pow(const Vector<N, T, Q>& x, const Vector<N, T, Q>& y) noexcept { return TranscendentalFunctions<N, T, Q>::pow(x, y); }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline Vector<N, T, Q> FastSin(const Vector<N, T, Q>& vector) noexcept { return TranscendentalFunctions<N, T, Q>::fastSin(vector); }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline Vector<N, T, Q> FastCos(const Vector<N, T, Q>& vector) noexcept { return TranscendentalFunctions<N, T, Q>::fastCos(vector); }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline void FastSinCos(const Vector<N, T, Q>& vector, Vector<N, T, Q>& sin, Vector<N, T, Q>& cos) noexcept
+    {
+        TranscendentalFunctions<N, T, Q>::fastSinCos(vector, sin, cos);
+    }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline Vector<N, T, Q> FastExp(const Vector<N, T, Q>& vector) noexcept { return TranscendentalFunctions<N, T, Q>::fastExp(vector); }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline Vector<N, T, Q> FastLog(const Vector<N, T, Q>& vector) noexcept { return TranscendentalFunctions<N, T, Q>::fastLog(vector); }
+
+    // ---- Batches ----
+    // The output span has to be at least as big as the input, it can be the same memory as the input
+#define PULSARION_MATH_TRANSCENDENTAL_BATCH(Name, function)                                                                          \
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>                                                                          \
+    inline void Name(std::type_identity_t<std::span<const Vector<N, T, Q>>> input, std::span<Vector<N, T, Q>> output) noexcept      \
+    {                                                                                                                                \
+        for (std::size_t i = 0; i < input.size(); ++i)                                                                               \
+            output[i] = TranscendentalFunctions<N, T, Q>::function(input[i]);                                                       \
+    }
+
+    PULSARION_MATH_TRANSCENDENTAL_BATCH(Sin, sin)
+    PULSARION_MATH_TRANSCENDENTAL_BATCH(Cos, cos)
+    PULSARION_MATH_TRANSCENDENTAL_BATCH(Tan, tan)
+    PULSARION_MATH_TRANSCENDENTAL_BATCH(Exp, exp)
+    PULSARION_MATH_TRANSCENDENTAL_BATCH(Log, log)
+    PULSARION_MATH_TRANSCENDENTAL_BATCH(FastSin, fastSin)
+    PULSARION_MATH_TRANSCENDENTAL_BATCH(FastCos, fastCos)
+    PULSARION_MATH_TRANSCENDENTAL_BATCH(FastExp, fastExp)
+    PULSARION_MATH_TRANSCENDENTAL_BATCH(FastLog, fastLog)
+#undef PULSARION_MATH_TRANSCENDENTAL_BATCH
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline void SinCos(std::type_identity_t<std::span<const Vector<N, T, Q>>> input, std::span<Vector<N, T, Q>> sin, std::span<Vector<N, T, Q>> cos) noexcept
+    {
+        for (std::size_t i = 0; i < input.size(); ++i)
+            TranscendentalFunctions<N, T, Q>::sinCos(input[i], sin[i], cos[i]);
+    }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline void FastSinCos(std::type_identity_t<std::span<const Vector<N, T, Q>>> input, std::span<Vector<N, T, Q>> sin, std::span<Vector<N, T, Q>> cos) noexcept
+    {
+        for (std::size_t i = 0; i < input.size(); ++i)
+            TranscendentalFunctions<N, T, Q>::fastSinCos(input[i], sin[i], cos[i]);
+    }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline void Atan2(std::type_identity_t<std::span<const Vector<N, T, Q>>> y, std::type_identity_t<std::span<const Vector<N, T, Q>>> x, std::span<Vector<N, T, Q>> output) noexcept
+    {
+        for (std::size_t i = 0; i < y.size(); ++i)
+            output[i] = TranscendentalFunctions<N, T, Q>::atan2(y[i], x[i]);
+    }
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    inline void Pow(std::type_identity_t<std::span<const Vector<N, T, Q>>> x, std::type_identity_t<std::span<const Vector<N, T, Q>>> y, std::span<Vector<N, T, Q>> output) noexcept
+    {
+        for (std::size_t i = 0; i < x.size(); ++i)
+            output[i] = TranscendentalFunctions<N, T, Q>::pow(x[i], y[i]);
+    }
+}
+
+#include "TranscendentalGeneric.hpp"
+
+#if defined(PULSARION_MATH_SIMD_SSE4_1) && !defined(PULSARION_MATH_DETERMINISTIC)
+#include "TranscendentalSSE.hpp"
+#endif
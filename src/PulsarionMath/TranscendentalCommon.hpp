@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+#include "Qualifier.hpp"
+
+namespace Pulsarion::Math
+{
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    struct TranscendentalFunctions; // Lane-wise transcendental functions for the Vector class.
+
+    template<FloatingPoint_t T>
+    struct TranscendentalConstants; // Range reduction constants and polynomial coefficients, shared by every backend.
+
+    template<>
+    struct TranscendentalConstants<float>
+    {
+        static constexpr float TwoOverPi = 0.636619772367581343f;
+        static constexpr float Pi = 3.14159265358979324f;
+        static constexpr float PiOverTwo = 1.57079632679489662f;
+        static constexpr float PiOverFour = 0.785398163397448310f;
+        // pi / 2 split in three, the first two have enough trailing zeros for the products with the quadrant to be exact
+        static constexpr float PiOverTwo1 = 1.5703125f;
+        static constexpr float PiOverTwo2 = 4.837512969970703125e-4f;
+        static constexpr float PiOverTwo3 = 7.54978995489188216e-8f;
+        static constexpr float Log2E = 1.44269504088896341f;
+        static constexpr float Ln2 = 0.693147180559945309f;
+        // ln(2) split in two, Ln2Hi * k is exact for every exponent k
+        static constexpr float Ln2Hi = 0.693359375f;
+        static constexpr float Ln2Lo = -2.12194440e-4f;
+        static constexpr float Sqrt2 = 1.41421356237309505f;
+        static constexpr float TanPiOverEight = 0.414213562373095049f;
+        // Past these exp overflows to infinity or underflows to zero
+        static constexpr float MaxLog = 88.7228391f;
+        static constexpr float MinLog = -103.972084f;
+
+        static constexpr int MantissaBits = 23;
+        static constexpr int ExponentBias = 127;
+
+        // All coefficients are ordered from the highest degree down.
+        // sin(r) = r + r * z * P(z), cos(r) = 1 - z / 2 + z * z * P(z), with z = r * r and |r| <= pi / 4 (Cephes)
+        static constexpr float SinCoefficients[] = { -1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f };
+        static constexpr float CosCoefficients[] = { 2.443315711809948e-5f, -1.388731625493765e-3f, 4.166664568298827e-2f };
+        // atan(a) = a + a * z * P(z), with |a| <= tan(pi / 8) (Cephes)
+        static constexpr float AtanCoefficients[] = { 8.05374449538e-2f, -1.38776856032e-1f, 1.99777106478e-1f, -3.33329491539e-1f };
+        // exp(r) = 1 + r + r * r * P(r), with |r| <= ln(2) / 2 (Cephes)
+        static constexpr float ExpCoefficients[] = { 1.9875691500e-4f, 1.3981999507e-3f, 8.3334519073e-3f, 4.1665795894e-2f, 1.6666665459e-1f, 5.0000001201e-1f };
+        // log(1 + f) = f - f * f / 2 + s * (f * f / 2 + z * P(z)), with s = f / (2 + f) and z = s * s (fdlibm)
+        static constexpr float LogCoefficients[] = { 0.24279078841f, 0.28498786688f, 0.40000972152f, 0.66666662693f };
+
+        // Lower degree minimax fits used by the Fast functions
+        // sin(r) = r + r * z * P(z), cos(r) = 1 + z * P(z)
+        static constexpr float FastSinCoefficients[] = { 8.163282464e-3f, -1.666339040e-1f };
+        static constexpr float FastCosCoefficients[] = { 4.045845469e-2f, -4.997605583e-1f };
+        // exp(r) = 1 + r + r * r * P(r)
+        static constexpr float FastExpCoefficients[] = { 4.127769854e-2f, 1.675351571e-1f, 5.000511663e-1f };
+        // log(m) = 2 * s * (1 + z * P(z)), with s = (m - 1) / (m + 1) and z = s * s
+        static constexpr float FastLogCoefficients[] = { 2.060099359e-1f, 3.332781110e-1f };
+    };
+
+    template<>
+    struct TranscendentalConstants<double>
+    {
+        static constexpr double TwoOverPi = 0.636619772367581343075535053490057448;
+        static constexpr double Pi = 3.14159265358979323846264338327950288;
+        static constexpr double PiOverTwo = 1.57079632679489661923132169163975144;
+        static constexpr double PiOverFour = 0.785398163397448309615660845819875721;
+        static constexpr double PiOverTwo1 = 1.57079625129699707031e+0;
+        static constexpr double PiOverTwo2 = 7.54978941586159635335e-8;
+        static constexpr double PiOverTwo3 = 5.39030285815811905290e-15;
+        static constexpr double Log2E = 1.44269504088896340735992468100189214;
+        static constexpr double Ln2 = 0.693147180559945309417232121458176568;
+        static constexpr double Ln2Hi = 6.93145751953125e-1;
+        static constexpr double Ln2Lo = 1.42860682030941723212e-6;
+        static constexpr double Sqrt2 = 1.41421356237309504880168872420969808;
+        static constexpr double TanPiOverEight = 0.414213562373095048801688724209698079;
+        static constexpr double MaxLog = 709.782712893383996;
+        static constexpr double MinLog = -745.133219101941108;
+
+        static constexpr int MantissaBits = 52;
+        static constexpr int ExponentBias = 1023;
+
+        // Same forms as the float ones, with more terms (Cephes)
+        static constexpr double SinCoefficients[] = { 1.58962301576546568060e-10, -2.50507477628578072866e-8, 2.75573136213857245213e-6,
+                                                      -1.98412698295895385996e-4, 8.33333333332211858878e-3, -1.66666666666666307295e-1 };
+        static constexpr double CosCoefficients[] = { -1.13585365213876817300e-11, 2.08757008419747316778e-9, -2.75573141792967388112e-7,
+                                                      2.48015872888517045348e-5, -1.38888888888730564116e-3, 4.16666666666665929218e-2 };
+        // atan(a) = a + a * z * P(z) / Q(z) (Cephes)
+        static constexpr double AtanCoefficientsP[] = { -8.750608600031904122785e-1, -1.615753718733365076637e1, -7.500855792314704667340e1,
+                                                        -1.228866684490136173410e2, -6.485021904942025371773e1 };
+        static constexpr double AtanCoefficientsQ[] = { 1.0, 2.485846490142306297962e1, 1.650270098316988542046e2, 4.328810604912902668951e2,
+                                                        4.853903996359136964868e2, 1.945506571482613964425e2 };
+        // Taylor series, 1 / 13! ... 1 / 2!
+        static constexpr double ExpCoefficients[] = { 1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0, 1.0 / 3628800.0, 1.0 / 362880.0, 1.0 / 40320.0,
+                                                      1.0 / 5040.0, 1.0 / 720.0, 1.0 / 120.0, 1.0 / 24.0, 1.0 / 6.0, 1.0 / 2.0 };
+        // (fdlibm)
+        static constexpr double LogCoefficients[] = { 1.479819860511658591e-01, 1.531383769920937332e-01, 1.818357216161805012e-01, 2.222219843214978396e-01,
+                                                      2.857142874366239149e-01, 3.999999999940941908e-01, 6.666666666666735130e-01 };
+
+        // The Fast functions are single precision accurate for double too
+        static constexpr double FastSinCoefficients[] = { 8.163282464484568e-3, -1.666339040465781e-1 };
+        static constexpr double FastCosCoefficients[] = { 4.045845469107363e-2, -4.997605583048265e-1 };
+        static constexpr double FastExpCoefficients[] = { 4.127769854401920e-2, 1.675351570781514e-1, 5.000511662569244e-1 };
+        static constexpr double FastLogCoefficients[] = { 2.060099359092365e-1, 3.332781109638220e-1 };
+    };
+}
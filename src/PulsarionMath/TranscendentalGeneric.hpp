@@ -0,0 +1,341 @@
+#pragma once
+
+#ifndef PULSARION_MATH_TRANSCENDENTAL_HPP
+#include "Transcendental.hpp"
+#endif
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace Pulsarion::Math
+{
+    // The same range reductions and polynomials as the SIMD backends, one lane at a time, so every backend
+    // gives the same results (up to rounding), and libm isn't involved.
+    template<FloatingPoint_t T>
+    struct ScalarTranscendental
+    {
+        using Constants = TranscendentalConstants<T>;
+        using Int = std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>;
+        using UInt = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+        static inline void sinCos(T x, T& sin, T& cos) noexcept
+        {
+            const T j = std::nearbyint(x * Constants::TwoOverPi);
+            const T r = ((x - j * Constants::PiOverTwo1) - j * Constants::PiOverTwo2) - j * Constants::PiOverTwo3;
+            const T z = r * r;
+            const T s = r + r * z * Polynomial(z, Constants::SinCoefficients);
+            const T c = T(1) - z * T(0.5) + z * z * Polynomial(z, Constants::CosCoefficients);
+            ApplyQuadrant(Quadrant(j), s, c, sin, cos);
+        }
+
+        static inline T sin(T x) noexcept
+        {
+            T s, c;
+            sinCos(x, s, c);
+            return s;
+        }
+
+        static inline T cos(T x) noexcept
+        {
+            T s, c;
+            sinCos(x, s, c);
+            return c;
+        }
+
+        static inline T tan(T x) noexcept
+        {
+            const T j = std::nearbyint(x * Constants::TwoOverPi);
+            const T r = ((x - j * Constants::PiOverTwo1) - j * Constants::PiOverTwo2) - j * Constants::PiOverTwo3;
+            const T z = r * r;
+            const T s = r + r * z * Polynomial(z, Constants::SinCoefficients);
+            const T c = T(1) - z * T(0.5) + z * z * Polynomial(z, Constants::CosCoefficients);
+            // tan(x + pi / 2) = -cos(x) / sin(x)
+            return (Quadrant(j) & 1) ? -c / s : s / c;
+        }
+
+        static inline T atan2(T y, T x) noexcept
+        {
+            if (std::isnan(x) || std::isnan(y))
+                return x + y;
+
+            const T ax = std::abs(x);
+            const T ay = std::abs(y);
+            const T max = std::max(ax, ay);
+            const T min = std::min(ax, ay);
+            // Equal magnitudes (including two infinities) are exactly pi / 4
+            T a = max == T(0) ? T(0) : (min == max ? T(1) : min / max);
+
+            T offset = 0;
+            if (a > Constants::TanPiOverEight)
+            {
+                a = (a - T(1)) / (a + T(1));
+                offset = Constants::PiOverFour;
+            }
+            T result = offset + Atan(a);
+
+            if (ay > ax)
+                result = Constants::PiOverTwo - result;
+            if (std::signbit(x))
+                result = Constants::Pi - result;
+            return std::copysign(result, y);
+        }
+
+        static inline T exp(T x) noexcept
+        {
+            if (std::isnan(x))
+                return x;
+            if (x > Constants::MaxLog)
+                return std::numeric_limits<T>::infinity();
+            if (x < Constants::MinLog)
+                return T(0);
+
+            const T n = std::nearbyint(x * Constants::Log2E);
+            const T r = (x - n * Constants::Ln2Hi) - n * Constants::Ln2Lo;
+            const T p = T(1) + r + r * r * Polynomial(r, Constants::ExpCoefficients);
+            return ScaleByPow2(p, static_cast<Int>(n));
+        }
+
+        static inline T log(T x) noexcept
+        {
+            if (std::isnan(x) || x == std::numeric_limits<T>::infinity())
+                return x;
+            if (x < T(0))
+                return std::numeric_limits<T>::quiet_NaN();
+            if (x == T(0))
+                return -std::numeric_limits<T>::infinity();
+
+            Int k = 0;
+            if (x < std::numeric_limits<T>::min())
+            {
+                // Denormals are normalized first
+                x *= Pow2(Constants::MantissaBits + 2);
+                k = -(Constants::MantissaBits + 2);
+            }
+
+            T m;
+            k += Decompose(x, m);
+            const T f = m - T(1);
+            const T s = f / (T(2) + f);
+            const T z = s * s;
+            const T r = z * Polynomial(z, Constants::LogCoefficients);
+            const T halfF2 = T(0.5) * f * f;
+            const T kf = static_cast<T>(k);
+            return kf * Constants::Ln2Hi - ((halfF2 - (s * (halfF2 + r) + kf * Constants::Ln2Lo)) - f);
+        }
+
+        static inline T pow(T x, T y) noexcept
+        {
+            if (y == T(0) || x == T(1))
+                return T(1);
+            return exp(y * log(x));
+        }
+
+        static inline void fastSinCos(T x, T& sin, T& cos) noexcept
+        {
+            const T j = std::nearbyint(x * Constants::TwoOverPi);
+            const T r = x - j * Constants::PiOverTwo;
+            const T z = r * r;
+            const T s = r + r * z * Polynomial(z, Constants::FastSinCoefficients);
+            const T c = T(1) + z * Polynomial(z, Constants::FastCosCoefficients);
+            ApplyQuadrant(Quadrant(j), s, c, sin, cos);
+        }
+
+        static inline T fastSin(T x) noexcept
+        {
+            T s, c;
+            fastSinCos(x, s, c);
+            return s;
+        }
+
+        static inline T fastCos(T x) noexcept
+        {
+            T s, c;
+            fastSinCos(x, s, c);
+            return c;
+        }
+
+        static inline T fastExp(T x) noexcept
+        {
+            x = std::clamp(x, Constants::MinLog, Constants::MaxLog);
+            const T n = std::nearbyint(x * Constants::Log2E);
+            const T r = x - n * Constants::Ln2;
+            const T p = T(1) + r + r * r * Polynomial(r, Constants::FastExpCoefficients);
+            return ScaleByPow2(p, static_cast<Int>(n));
+        }
+
+        static inline T fastLog(T x) noexcept
+        {
+            T m;
+            const Int k = Decompose(x, m);
+            const T s = (m - T(1)) / (m + T(1));
+            const T z = s * s;
+            return static_cast<T>(k) * Constants::Ln2 + T(2) * s * (T(1) + z * Polynomial(z, Constants::FastLogCoefficients));
+        }
+
+    private:
+        template<std::size_t K>
+        static inline constexpr T Polynomial(T x, const T (&coefficients)[K]) noexcept
+        {
+            T result = coefficients[0];
+            for (std::size_t i = 1; i < K; ++i)
+                result = result * x + coefficients[i];
+            return result;
+        }
+
+        // j mod 4, every float past 2^62 is a multiple of 4
+        static inline int Quadrant(T j) noexcept
+        {
+            return std::abs(j) < T(0x1p62) ? static_cast<int>(static_cast<std::int64_t>(j) & 3) : 0;
+        }
+
+        static inline void ApplyQuadrant(int quadrant, T s, T c, T& sin, T& cos) noexcept
+        {
+            // sin(x + pi / 2) = cos(x), cos(x + pi / 2) = -sin(x)
+            sin = (quadrant & 1) ? c : s;
+            cos = (quadrant & 1) ? s : c;
+            if (quadrant & 2)
+                sin = -sin;
+            if ((quadrant + 1) & 2)
+                cos = -cos;
+        }
+
+        static inline T Atan(T a) noexcept
+        {
+            const T z = a * a;
+            if constexpr (std::is_same_v<T, float>)
+                return a + a * z * Polynomial(z, Constants::AtanCoefficients);
+            else
+                return a + a * z * Polynomial(z, Constants::AtanCoefficientsP) / Polynomial(z, Constants::AtanCoefficientsQ);
+        }
+
+        static inline T Pow2(Int n) noexcept
+        {
+            return std::bit_cast<T>(static_cast<UInt>(n + Constants::ExponentBias) << Constants::MantissaBits);
+        }
+
+        // Split in two, so the results past the range of a single exponent (denormals and the top of MaxLog) work
+        static inline T ScaleByPow2(T x, Int n) noexcept
+        {
+            const Int half = n >> 1;
+            return x * Pow2(half) * Pow2(n - half);
+        }
+
+        // x = m * 2^k with m in [sqrt(2) / 2, sqrt(2)], x has to be positive and normal
+        static inline Int Decompose(T x, T& m) noexcept
+        {
+            constexpr UInt mantissaMask = (UInt(1) << Constants::MantissaBits) - 1;
+            const UInt bits = std::bit_cast<UInt>(x);
+            Int k = static_cast<Int>(bits >> Constants::MantissaBits) - Constants::ExponentBias;
+            m = std::bit_cast<T>((bits & mantissaMask) | (static_cast<UInt>(Constants::ExponentBias) << Constants::MantissaBits));
+            if (m > Constants::Sqrt2)
+            {
+                m *= T(0.5);
+                ++k;
+            }
+            return k;
+        }
+    };
+
+    template<std::size_t N, FloatingPoint_t T, Qualifier Q>
+    struct TranscendentalFunctions
+    {
+        static inline Vector<N, T, Q> sin(const Vector<N, T, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental", N, "::sin");
+            return Apply<ScalarTranscendental<T>::sin>(vector);
+        }
+
+        static inline Vector<N, T, Q> cos(const Vector<N, T, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental", N, "::cos");
+            return Apply<ScalarTranscendental<T>::cos>(vector);
+        }
+
+        static inline Vector<N, T, Q> tan(const Vector<N, T, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental", N, "::tan");
+            return Apply<ScalarTranscendental<T>::tan>(vector);
+        }
+
+        static inline Vector<N, T, Q> exp(const Vector<N, T, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental", N, "::exp");
+            return Apply<ScalarTranscendental<T>::exp>(vector);
+        }
+
+        static inline Vector<N, T, Q> log(const Vector<N, T, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental", N, "::log");
+            return Apply<ScalarTranscendental<T>::log>(vector);
+        }
+
+        static inline Vector<N, T, Q> fastSin(const Vector<N, T, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental", N, "::fastSin");
+            return Apply<ScalarTranscendental<T>::fastSin>(vector);
+        }
+
+        static inline Vector<N, T, Q> fastCos(const Vector<N, T, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental", N, "::fastCos");
+            return Apply<ScalarTranscendental<T>::fastCos>(vector);
+        }
+
+        static inline Vector<N, T, Q> fastExp(const Vector<N, T, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental", N, "::fastExp");
+            return Apply<ScalarTranscendental<T>::fastExp>(vector);
+        }
+
+        static inline Vector<N, T, Q> fastLog(const Vector<N, T, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental", N, "::fastLog");
+            return Apply<ScalarTranscendental<T>::fastLog>(vector);
+        }
+
+        static inline void sinCos(const Vector<N, T, Q>& vector, Vector<N, T, Q>& sin, Vector<N, T, Q>& cos) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental", N, "::sinCos");
+            for (std::size_t i = 0; i < N; ++i)
+                ScalarTranscendental<T>::sinCos(vector[i], sin[i], cos[i]);
+        }
+
+        static inline void fastSinCos(const Vector<N, T, Q>& vector, Vector<N, T, Q>& sin, Vector<N, T, Q>& cos) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental", N, "::fastSinCos");
+            for (std::size_t i = 0; i < N; ++i)
+                ScalarTranscendental<T>::fastSinCos(vector[i], sin[i], cos[i]);
+        }
+
+        static inline Vector<N, T, Q> atan2(const Vector<N, T, Q>& y, const Vector<N, T, Q>& x) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental", N, "::atan2");
+            Vector<N, T, Q> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result[i] = ScalarTranscendental<T>::atan2(y[i], x[i]);
+            return result;
+        }
+
+        static inline Vector<N, T, Q> pow(const Vector<N, T, Q>& x, const Vector<N, T, Q>& y) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental", N, "::pow");
+            Vector<N, T, Q> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result[i] = ScalarTranscendental<T>::pow(x[i], y[i]);
+            return result;
+        }
+
+    private:
+        template<T (*Function)(T) noexcept>
+        static inline Vector<N, T, Q> Apply(const Vector<N, T, Q>& vector) noexcept
+        {
+            Vector<N, T, Q> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result[i] = Function(vector[i]);
+            return result;
+        }
+    };
+}
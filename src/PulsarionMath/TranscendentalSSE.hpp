@@ -0,0 +1,398 @@
+#pragma once
+
+#ifndef PULSARION_MATH_TRANSCENDENTAL_HPP
+#include "Transcendental.hpp"
+#endif
+
+#include "VectorLayoutSSE.hpp"
+
+#include <immintrin.h>
+#include <limits>
+
+namespace Pulsarion::Math
+{
+    // The float algorithms of ScalarTranscendental, four lanes at a time, with the branches replaced by blends
+    struct TranscendentalSSE
+    {
+        using Constants = TranscendentalConstants<float>;
+
+        static inline void SinCos(__m128 x, __m128& sin, __m128& cos) noexcept
+        {
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 j = _mm_round_ps(_mm_mul_ps(x, _mm_set1_ps(Constants::TwoOverPi)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            __m128 r = ReducePiOverTwo(x, j);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 z = _mm_mul_ps(r, r);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, z), Polynomial(z, Constants::SinCoefficients)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 c = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            c = _mm_add_ps(c, _mm_mul_ps(_mm_mul_ps(z, z), Polynomial(z, Constants::CosCoefficients)));
+            ApplyQuadrant(_mm_cvtps_epi32(j), s, c, sin, cos);
+        }
+
+        static inline __m128 Tan(__m128 x) noexcept
+        {
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 j = _mm_round_ps(_mm_mul_ps(x, _mm_set1_ps(Constants::TwoOverPi)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            __m128 r = ReducePiOverTwo(x, j);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 z = _mm_mul_ps(r, r);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, z), Polynomial(z, Constants::SinCoefficients)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 c = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            c = _mm_add_ps(c, _mm_mul_ps(_mm_mul_ps(z, z), Polynomial(z, Constants::CosCoefficients)));
+
+            // tan(x + pi / 2) = -cos(x) / sin(x)
+            __m128i odd = _mm_slli_epi32(_mm_cvtps_epi32(j), 31);
+            __m128 swap = _mm_castsi128_ps(odd);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 result = _mm_div_ps(_mm_blendv_ps(s, c, swap), _mm_blendv_ps(c, s, swap));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_xor_ps(result, swap);
+        }
+
+        static inline __m128 Atan2(__m128 y, __m128 x) noexcept
+        {
+            __m128 signMask = _mm_set1_ps(-0.0f);
+            __m128 one = _mm_set1_ps(1.0f);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 ax = _mm_andnot_ps(signMask, x);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 ay = _mm_andnot_ps(signMask, y);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 max = _mm_max_ps(ax, ay);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 min = _mm_min_ps(ax, ay);
+
+            // Equal magnitudes (including two infinities) are exactly pi / 4
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 a = _mm_blendv_ps(_mm_div_ps(min, max), one, _mm_cmpeq_ps(min, max));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            a = _mm_andnot_ps(_mm_cmpeq_ps(max, _mm_setzero_ps()), a);
+
+            __m128 big = _mm_cmpgt_ps(a, _mm_set1_ps(Constants::TanPiOverEight));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            a = _mm_blendv_ps(a, _mm_div_ps(_mm_sub_ps(a, one), _mm_add_ps(a, one)), big);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 offset = _mm_and_ps(big, _mm_set1_ps(Constants::PiOverFour));
+
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 z = _mm_mul_ps(a, a);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 result = _mm_add_ps(a, _mm_mul_ps(_mm_mul_ps(a, z), Polynomial(z, Constants::AtanCoefficients)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            result = _mm_add_ps(result, offset);
+
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            result = _mm_blendv_ps(result, _mm_sub_ps(_mm_set1_ps(Constants::PiOverTwo), result), _mm_cmpgt_ps(ay, ax));
+            // The sign bit of x selects, so -0 counts as negative
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            result = _mm_blendv_ps(result, _mm_sub_ps(_mm_set1_ps(Constants::Pi), result), x);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            result = _mm_or_ps(result, _mm_and_ps(y, signMask));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_or_ps(result, _mm_cmpunord_ps(x, y));
+        }
+
+        static inline __m128 Exp(__m128 x) noexcept
+        {
+            __m128 overflow = _mm_cmpgt_ps(x, _mm_set1_ps(Constants::MaxLog));
+            __m128 underflow = _mm_cmplt_ps(x, _mm_set1_ps(Constants::MinLog));
+            __m128 nan = _mm_cmpunord_ps(x, x);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 clamped = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(Constants::MinLog)), _mm_set1_ps(Constants::MaxLog));
+
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 n = _mm_round_ps(_mm_mul_ps(clamped, _mm_set1_ps(Constants::Log2E)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 r = _mm_sub_ps(clamped, _mm_mul_ps(n, _mm_set1_ps(Constants::Ln2Hi)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            r = _mm_sub_ps(r, _mm_mul_ps(n, _mm_set1_ps(Constants::Ln2Lo)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 p = _mm_add_ps(_mm_add_ps(_mm_set1_ps(1.0f), r), _mm_mul_ps(_mm_mul_ps(r, r), Polynomial(r, Constants::ExpCoefficients)));
+            p = ScaleByPow2(p, _mm_cvtps_epi32(n));
+
+            p = _mm_blendv_ps(p, _mm_set1_ps(std::numeric_limits<float>::infinity()), overflow);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            p = _mm_andnot_ps(underflow, p);
+            return _mm_blendv_ps(p, x, nan);
+        }
+
+        static inline __m128 Log(__m128 x) noexcept
+        {
+            __m128 one = _mm_set1_ps(1.0f);
+            __m128 half = _mm_set1_ps(0.5f);
+
+            // Denormals are normalized first
+            __m128 denormal = _mm_cmplt_ps(x, _mm_set1_ps(std::numeric_limits<float>::min()));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 normalized = _mm_blendv_ps(x, _mm_mul_ps(x, _mm_set1_ps(0x1p25f)), denormal);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128i k = _mm_and_si128(_mm_castps_si128(denormal), _mm_set1_epi32(-25));
+
+            __m128 m;
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            k = _mm_add_epi32(k, Decompose(normalized, m));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 f = _mm_sub_ps(m, one);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 s = _mm_div_ps(f, _mm_add_ps(_mm_set1_ps(2.0f), f));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 z = _mm_mul_ps(s, s);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 r = _mm_mul_ps(z, Polynomial(z, Constants::LogCoefficients));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 halfF2 = _mm_mul_ps(_mm_mul_ps(half, f), f);
+            __m128 kf = _mm_cvtepi32_ps(k);
+
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 result = _mm_add_ps(_mm_mul_ps(s, _mm_add_ps(halfF2, r)), _mm_mul_ps(kf, _mm_set1_ps(Constants::Ln2Lo)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            result = _mm_sub_ps(_mm_sub_ps(halfF2, result), f);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            result = _mm_sub_ps(_mm_mul_ps(kf, _mm_set1_ps(Constants::Ln2Hi)), result);
+
+            __m128 infinity = _mm_set1_ps(std::numeric_limits<float>::infinity());
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            result = _mm_blendv_ps(result, _mm_sub_ps(_mm_setzero_ps(), infinity), _mm_cmpeq_ps(x, _mm_setzero_ps()));
+            result = _mm_blendv_ps(result, infinity, _mm_cmpeq_ps(x, infinity));
+            // Negative numbers and NaN
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_or_ps(result, _mm_cmpnge_ps(x, _mm_setzero_ps()));
+        }
+
+        static inline __m128 Pow(__m128 x, __m128 y) noexcept
+        {
+            __m128 one = _mm_set1_ps(1.0f);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 result = Exp(_mm_mul_ps(y, Log(x)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_blendv_ps(result, one, _mm_or_ps(_mm_cmpeq_ps(y, _mm_setzero_ps()), _mm_cmpeq_ps(x, one)));
+        }
+
+        static inline void FastSinCos(__m128 x, __m128& sin, __m128& cos) noexcept
+        {
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 j = _mm_round_ps(_mm_mul_ps(x, _mm_set1_ps(Constants::TwoOverPi)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 r = _mm_sub_ps(x, _mm_mul_ps(j, _mm_set1_ps(Constants::PiOverTwo)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 z = _mm_mul_ps(r, r);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, z), Polynomial(z, Constants::FastSinCoefficients)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 c = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(z, Polynomial(z, Constants::FastCosCoefficients)));
+            ApplyQuadrant(_mm_cvtps_epi32(j), s, c, sin, cos);
+        }
+
+        static inline __m128 FastExp(__m128 x) noexcept
+        {
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(Constants::MinLog)), _mm_set1_ps(Constants::MaxLog));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 n = _mm_round_ps(_mm_mul_ps(x, _mm_set1_ps(Constants::Log2E)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 r = _mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(Constants::Ln2)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 p = _mm_add_ps(_mm_add_ps(_mm_set1_ps(1.0f), r), _mm_mul_ps(_mm_mul_ps(r, r), Polynomial(r, Constants::FastExpCoefficients)));
+            return ScaleByPow2(p, _mm_cvtps_epi32(n));
+        }
+
+        static inline __m128 FastLog(__m128 x) noexcept
+        {
+            __m128 one = _mm_set1_ps(1.0f);
+            __m128 m;
+            __m128 kf = _mm_cvtepi32_ps(Decompose(x, m));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 s = _mm_div_ps(_mm_sub_ps(m, one), _mm_add_ps(m, one));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 z = _mm_mul_ps(s, s);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 p = _mm_add_ps(one, _mm_mul_ps(z, Polynomial(z, Constants::FastLogCoefficients)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_add_ps(_mm_mul_ps(kf, _mm_set1_ps(Constants::Ln2)), _mm_mul_ps(_mm_add_ps(s, s), p));
+        }
+
+    private:
+        template<std::size_t K>
+        static inline __m128 Polynomial(__m128 x, const float (&coefficients)[K]) noexcept
+        {
+            __m128 result = _mm_set1_ps(coefficients[0]);
+            for (std::size_t i = 1; i < K; ++i)
+                //NOLINTNEXTLINE(portability-simd-intrinsics)
+                result = _mm_add_ps(_mm_mul_ps(result, x), _mm_set1_ps(coefficients[i]));
+            return result;
+        }
+
+        static inline __m128 ReducePiOverTwo(__m128 x, __m128 j) noexcept
+        {
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 r = _mm_sub_ps(x, _mm_mul_ps(j, _mm_set1_ps(Constants::PiOverTwo1)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            r = _mm_sub_ps(r, _mm_mul_ps(j, _mm_set1_ps(Constants::PiOverTwo2)));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_sub_ps(r, _mm_mul_ps(j, _mm_set1_ps(Constants::PiOverTwo3)));
+        }
+
+        // Out of range quadrants convert to 0x80000000, which is a multiple of 4, like every float that large
+        static inline void ApplyQuadrant(__m128i quadrant, __m128 s, __m128 c, __m128& sin, __m128& cos) noexcept
+        {
+            // sin(x + pi / 2) = cos(x), cos(x + pi / 2) = -sin(x)
+            __m128 swap = _mm_castsi128_ps(_mm_slli_epi32(quadrant, 31));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128i next = _mm_add_epi32(quadrant, _mm_set1_epi32(1));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(next, _mm_set1_epi32(2)), 30));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            sin = _mm_xor_ps(_mm_blendv_ps(s, c, swap), sinSign);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            cos = _mm_xor_ps(_mm_blendv_ps(c, s, swap), cosSign);
+        }
+
+        static inline __m128 Pow2(__m128i n) noexcept
+        {
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(Constants::ExponentBias)), Constants::MantissaBits));
+        }
+
+        static inline __m128 ScaleByPow2(__m128 x, __m128i n) noexcept
+        {
+            __m128i half = _mm_srai_epi32(n, 1);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_mul_ps(_mm_mul_ps(x, Pow2(half)), Pow2(_mm_sub_epi32(n, half)));
+        }
+
+        // x = m * 2^k with m in [sqrt(2) / 2, sqrt(2)], x has to be positive and normal
+        static inline __m128i Decompose(__m128 x, __m128& m) noexcept
+        {
+            __m128i bits = _mm_castps_si128(x);
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            __m128i k = _mm_sub_epi32(_mm_srli_epi32(bits, Constants::MantissaBits), _mm_set1_epi32(Constants::ExponentBias));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+
+            __m128 big = _mm_cmpgt_ps(m, _mm_set1_ps(Constants::Sqrt2));
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            m = _mm_blendv_ps(m, _mm_mul_ps(m, _mm_set1_ps(0.5f)), big);
+            // The mask is -1 where m was halved
+            //NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_sub_epi32(k, _mm_castps_si128(big));
+        }
+    };
+
+    template<Qualifier Q>
+    struct TranscendentalFunctionsSSE
+    {
+        static inline Vector<4, float, Q> sin(const Vector<4, float, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental4::sin");
+            __m128 s, c;
+            TranscendentalSSE::SinCos(Detail::LoadVectorSSE(vector), s, c);
+            return Store(s);
+        }
+
+        static inline Vector<4, float, Q> cos(const Vector<4, float, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental4::cos");
+            __m128 s, c;
+            TranscendentalSSE::SinCos(Detail::LoadVectorSSE(vector), s, c);
+            return Store(c);
+        }
+
+        static inline void sinCos(const Vector<4, float, Q>& vector, Vector<4, float, Q>& sin, Vector<4, float, Q>& cos) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental4::sinCos");
+            __m128 s, c;
+            TranscendentalSSE::SinCos(Detail::LoadVectorSSE(vector), s, c);
+            sin = Store(s);
+            cos = Store(c);
+        }
+
+        static inline Vector<4, float, Q> tan(const Vector<4, float, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental4::tan");
+            return Store(TranscendentalSSE::Tan(Detail::LoadVectorSSE(vector)));
+        }
+
+        static inline Vector<4, float, Q> atan2(const Vector<4, float, Q>& y, const Vector<4, float, Q>& x) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental4::atan2");
+            return Store(TranscendentalSSE::Atan2(Detail::LoadVectorSSE(y), Detail::LoadVectorSSE(x)));
+        }
+
+        static inline Vector<4, float, Q> exp(const Vector<4, float, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental4::exp");
+            return Store(TranscendentalSSE::Exp(Detail::LoadVectorSSE(vector)));
+        }
+
+        static inline Vector<4, float, Q> log(const Vector<4, float, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental4::log");
+            return Store(TranscendentalSSE::Log(Detail::LoadVectorSSE(vector)));
+        }
+
+        static inline Vector<4, float, Q> pow(const Vector<4, float, Q>& x, const Vector<4, float, Q>& y) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental4::pow");
+            return Store(TranscendentalSSE::Pow(Detail::LoadVectorSSE(x), Detail::LoadVectorSSE(y)));
+        }
+
+        static inline Vector<4, float, Q> fastSin(const Vector<4, float, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental4::fastSin");
+            __m128 s, c;
+            TranscendentalSSE::FastSinCos(Detail::LoadVectorSSE(vector), s, c);
+            return Store(s);
+        }
+
+        static inline Vector<4, float, Q> fastCos(const Vector<4, float, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental4::fastCos");
+            __m128 s, c;
+            TranscendentalSSE::FastSinCos(Detail::LoadVectorSSE(vector), s, c);
+            return Store(c);
+        }
+
+        static inline void fastSinCos(const Vector<4, float, Q>& vector, Vector<4, float, Q>& sin, Vector<4, float, Q>& cos) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental4::fastSinCos");
+            __m128 s, c;
+            TranscendentalSSE::FastSinCos(Detail::LoadVectorSSE(vector), s, c);
+            sin = Store(s);
+            cos = Store(c);
+        }
+
+        static inline Vector<4, float, Q> fastExp(const Vector<4, float, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental4::fastExp");
+            return Store(TranscendentalSSE::FastExp(Detail::LoadVectorSSE(vector)));
+        }
+
+        static inline Vector<4, float, Q> fastLog(const Vector<4, float, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transcendental4::fastLog");
+            return Store(TranscendentalSSE::FastLog(Detail::LoadVectorSSE(vector)));
+        }
+
+    private:
+        static inline Vector<4, float, Q> Store(__m128 value) noexcept
+        {
+            Vector<4, float, Q> result;
+            Detail::StoreVectorSSE(value, result);
+            return result;
+        }
+    };
+
+    template<>
+    struct TranscendentalFunctions<4, float, Qualifier::Aligned> : TranscendentalFunctionsSSE<Qualifier::Aligned> {};
+
+    template<>
+    struct TranscendentalFunctions<4, float, Qualifier::Packed> : TranscendentalFunctionsSSE<Qualifier::Packed> {};
+}
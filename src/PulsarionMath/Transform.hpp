@@ -0,0 +1,37 @@
+#pragma once
+#define PULSARION_MATH_TRANSFORM_HPP
+
+#include "Vector.hpp"
+#include "Matrix.hpp"
+#include "TransformCommon.hpp"
+
+#include <cassert>
+#include <span>
+#include <type_traits>
+
+// Transforms of whole spans of points by a 4x4 matrix, instead of a matrix vector multiplication per point.
+// 3 component points have an implicit w of 1 and the w of the result is dropped, so the matrix should be affine.
+// 4 component points are multiplied as they are. The output can be the input itself, but no other overlap is allowed.
+namespace Pulsarion::Math
+{
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    requires (N == 3 || N == 4)
+    inline void TransformPoints(const Matrix<4, 4, T>& matrix, std::type_identity_t<std::span<const Vector<N, T, Q>>> points, std::type_identity_t<std::span<Vector<N, T, Q>>> result) noexcept
+    {
+        assert(points.size() == result.size());
+        TransformFunctions<N, T, Q>::TransformPoints(matrix, points, result);
+    }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    requires (N == 3 || N == 4)
+    inline void TransformPointsInPlace(const Matrix<4, 4, T>& matrix, std::type_identity_t<std::span<Vector<N, T, Q>>> points) noexcept
+    {
+        TransformFunctions<N, T, Q>::TransformPoints(matrix, points, points);
+    }
+}
+
+#include "TransformGeneric.hpp"
+
+#if defined(PULSARION_MATH_SIMD_SSE4_1) && !defined(PULSARION_MATH_DETERMINISTIC)
+#include "TransformSSE.hpp"
+#endif
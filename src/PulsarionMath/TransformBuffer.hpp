@@ -0,0 +1,170 @@
+#pragma once
+
+#include "Matrix.hpp"
+#include "AlignedAllocator.hpp"
+#include "Instrument.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <span>
+
+// Hands arrays of transforms from one writer thread (the simulation) to one reader thread (the renderer) without locks.
+// There are three copies of the array: the writer fills its back copy and publishes it with one atomic exchange,
+// the reader takes the newest published copy with another, so neither ever waits (publishing a frame the reader didn't take replaces it).
+//
+// Writes mark a range of indices dirty, each published frame carries the range that changed since the frame the reader holds,
+// so the reader copies only that range out, and the writer brings a copy it gets back up to date by copying only the ranges
+// published while it was away. Ranges are the hull of the written indices, writes to a few contiguous blocks are the cheap case.
+// The copies and the state of each side are cache line aligned, so the two threads never share a line they write.
+namespace Pulsarion::Math
+{
+    // Indices [begin, end)
+    struct TransformRange
+    {
+        std::size_t begin = 0;
+        std::size_t end = 0;
+
+        [[nodiscard]] inline constexpr bool Empty() const noexcept { return begin >= end; }
+        [[nodiscard]] inline constexpr std::size_t Size() const noexcept { return Empty() ? 0 : end - begin; }
+
+        [[nodiscard]] inline constexpr TransformRange Union(const TransformRange& other) const noexcept
+        {
+            if (Empty())
+                return other;
+            if (other.Empty())
+                return *this;
+            return { std::min(begin, other.begin), std::max(end, other.end) };
+        }
+    };
+
+    template<std::size_t R, std::size_t C, Arithmetic_t T>
+    class TransformBuffer
+    {
+    public:
+        using Transform = Matrix<R, C, T>;
+
+        // All copies start as identities
+        explicit inline TransformBuffer(std::size_t count)
+        {
+            for (auto& copy : m_Copies)
+                copy.data.assign(count, Transform());
+        }
+
+        TransformBuffer(const TransformBuffer&) = delete;
+        TransformBuffer& operator=(const TransformBuffer&) = delete;
+
+        [[nodiscard]] inline std::size_t Size() const noexcept { return m_Copies[0].data.size(); }
+
+        // ---- Writer ----
+        // The back copy holds the last published frame plus the writes since, so unchanged transforms need no writes
+        [[nodiscard]] inline std::span<const Transform> Back() const noexcept { return m_Copies[m_Writer.back].data; }
+
+        inline void Set(std::size_t index, const Transform& transform) noexcept
+        {
+            m_Copies[m_Writer.back].data[index] = transform;
+            m_Writer.frame = m_Writer.frame.Union({ index, index + 1 });
+        }
+
+        // Marks [begin, begin + count) dirty and returns it for writing
+        [[nodiscard]] inline std::span<Transform> Write(std::size_t begin, std::size_t count) noexcept
+        {
+            m_Writer.frame = m_Writer.frame.Union({ begin, begin + count });
+            return std::span<Transform>(m_Copies[m_Writer.back].data).subspan(begin, count);
+        }
+
+        // Makes the writes since the last call visible to the reader, never blocks
+        inline void Publish() noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("TransformBuffer::Publish");
+            const std::uint32_t published = m_Writer.back;
+            const TransformRange frame = m_Writer.frame;
+            // A frame the reader hasn't taken is replaced, so its range is carried over. The reader can take it between this load
+            // and the exchange, the carried range is then only larger than needed (only the writer sets the flag, it can't appear)
+            const std::uint32_t middle = m_Middle.value.load(std::memory_order_acquire);
+            m_Copies[published].changed = (middle & Fresh) != 0 ? frame.Union(m_Copies[middle & IndexMask].changed) : frame;
+            for (std::uint32_t copy = 0; copy < 3; ++copy)
+                if (copy != published)
+                    m_Writer.pending[copy] = m_Writer.pending[copy].Union(frame);
+
+            const std::uint32_t back = m_Middle.value.exchange(published | Fresh, std::memory_order_acq_rel) & IndexMask;
+
+            // The reader only reads the published copy, so it can be read here while the reader copies from it
+            const TransformRange stale = m_Writer.pending[back];
+            std::copy(m_Copies[published].data.begin() + static_cast<std::ptrdiff_t>(stale.begin),
+                      m_Copies[published].data.begin() + static_cast<std::ptrdiff_t>(stale.end),
+                      m_Copies[back].data.begin() + static_cast<std::ptrdiff_t>(stale.begin));
+            m_Writer.pending[back] = {};
+            m_Writer.back = back;
+            m_Writer.frame = {};
+        }
+
+        // ---- Reader ----
+        // Takes the newest published frame, false (keeping the current one) if nothing was published since the last call. Never blocks
+        inline bool Acquire() noexcept
+        {
+            if ((m_Middle.value.load(std::memory_order_relaxed) & Fresh) == 0)
+            {
+                m_Reader.changed = {};
+                return false;
+            }
+            m_Reader.front = m_Middle.value.exchange(m_Reader.front, std::memory_order_acq_rel) & IndexMask;
+            m_Reader.changed = m_Copies[m_Reader.front].changed;
+            return true;
+        }
+
+        // The frame taken by the last Acquire
+        [[nodiscard]] inline std::span<const Transform> Front() const noexcept { return m_Copies[m_Reader.front].data; }
+
+        // The indices that differ between the frame taken by the last Acquire and the one before it
+        [[nodiscard]] inline TransformRange Changed() const noexcept { return m_Reader.changed; }
+
+        // Acquires, and copies the changed transforms to the destination, which has to hold the previous frame
+        // (identities at first, or a full copy of Front). False if nothing was published
+        inline bool CopyChanged(std::span<Transform> destination) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("TransformBuffer::CopyChanged");
+            if (!Acquire())
+                return false;
+            const auto& front = m_Copies[m_Reader.front].data;
+            std::copy(front.begin() + static_cast<std::ptrdiff_t>(m_Reader.changed.begin),
+                      front.begin() + static_cast<std::ptrdiff_t>(m_Reader.changed.end),
+                      destination.begin() + static_cast<std::ptrdiff_t>(m_Reader.changed.begin));
+            return true;
+        }
+
+    private:
+        static constexpr std::uint32_t Fresh = 4; // Set in the middle index by Publish, cleared when the reader takes it
+        static constexpr std::uint32_t IndexMask = 3;
+        static constexpr std::size_t CacheLine = 64;
+
+        struct alignas(CacheLine) Copy
+        {
+            AlignedVector<Transform, CacheLine> data;
+            TransformRange changed; // Since the frame the reader held when this one was published, written before publishing
+        };
+
+        struct alignas(CacheLine) WriterState
+        {
+            std::uint32_t back = 0;
+            TransformRange frame;
+            TransformRange pending[3]; // Of each copy, the ranges published while the writer didn't own it
+        };
+
+        struct alignas(CacheLine) ReaderState
+        {
+            std::uint32_t front = 2;
+            TransformRange changed;
+        };
+
+        struct alignas(CacheLine) Middle
+        {
+            std::atomic<std::uint32_t> value = 1;
+        };
+
+        Copy m_Copies[3];
+        WriterState m_Writer;
+        ReaderState m_Reader;
+        Middle m_Middle;
+    };
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#ifndef PULSARION_MATH_TRANSFORM_HPP
+#include "Transform.hpp"
+#endif
+
+#include <span>
+
+namespace Pulsarion::Math
+{
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    struct TransformFunctions
+    {
+        static inline void TransformPoints(const Matrix<4, 4, T>& matrix, std::span<const Vector<N, T, Q>> points, std::span<Vector<N, T, Q>> result) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transform", N, "::TransformPoints");
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+                T point[4] = { points[i][0], points[i][1], points[i][2], T(1) };
+                if constexpr (N == 4)
+                    point[3] = points[i][3];
+                for (std::size_t row = 0; row < N; ++row)
+                    result[i][row] = matrix.Get(row, 0) * point[0] + matrix.Get(row, 1) * point[1] + matrix.Get(row, 2) * point[2] + matrix.Get(row, 3) * point[3];
+            }
+        }
+    };
+}
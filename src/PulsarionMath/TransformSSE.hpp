@@ -0,0 +1,89 @@
+#pragma once
+
+#ifndef PULSARION_MATH_TRANSFORM_HPP
+#include "Transform.hpp"
+#endif
+
+#include "VectorLayoutSSE.hpp"
+
+#include <immintrin.h>
+#include <span>
+
+namespace Pulsarion::Math
+{
+    // 4 component vectors, and aligned 3 component ones (padded to 16 bytes), are a register per point (the padding lane of the results is zero).
+    // Packed 3 component vectors are transformed 4 points at a time, transposed to x0 x1 x2 x3 | y0 y1 y2 y3 | z0 z1 z2 z3 and back,
+    // so every output register is 3 multiply adds with broadcast matrix elements.
+    template<std::size_t N, Qualifier Q>
+    struct TransformFunctionsSSE
+    {
+        using V = Vector<N, float, Q>;
+        static constexpr bool Wide = N == 4 || Q == Qualifier::Aligned;
+        static_assert(Wide || sizeof(V) == 3 * sizeof(float), "Packed vectors have to be contiguous");
+
+        static inline void TransformPoints(const Matrix<4, 4, float>& matrix, std::span<const V> points, std::span<V> result) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Transform", N, "::TransformPoints");
+            const std::size_t count = points.size();
+            const __m128 columns[4] = { _mm_load_ps(&matrix[0].x()), _mm_load_ps(&matrix[1].x()), _mm_load_ps(&matrix[2].x()), _mm_load_ps(&matrix[3].x()) };
+            std::size_t i = 0;
+            if constexpr (Wide)
+            {
+                for (; i < count; ++i)
+                    Detail::StoreVectorSSE(Detail::TransformVectorSSE<N>(columns, Detail::LoadVectorSSE(points[i])), result[i]);
+            }
+            else
+            {
+                // m[row][column], broadcast once
+                __m128 m[3][4];
+                for (std::size_t column = 0; column < 4; ++column)
+                {
+                    m[0][column] = _mm_shuffle_ps(columns[column], columns[column], _MM_SHUFFLE(0, 0, 0, 0));
+                    m[1][column] = _mm_shuffle_ps(columns[column], columns[column], _MM_SHUFFLE(1, 1, 1, 1));
+                    m[2][column] = _mm_shuffle_ps(columns[column], columns[column], _MM_SHUFFLE(2, 2, 2, 2));
+                }
+
+                for (; i + 4 <= count; i += 4)
+                {
+                    const float* in = &points[i].x();
+                    __m128 x, y, z;
+                    Detail::ToSoASSE(_mm_loadu_ps(in), _mm_loadu_ps(in + 4), _mm_loadu_ps(in + 8), x, y, z);
+                    __m128 rows[3];
+                    for (std::size_t row = 0; row < 3; ++row)
+                        rows[row] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m[row][0], x), _mm_mul_ps(m[row][1], y)), _mm_add_ps(_mm_mul_ps(m[row][2], z), m[row][3]));
+
+                    __m128 a, b, c;
+                    Detail::ToAoSSSE(rows[0], rows[1], rows[2], a, b, c);
+                    float* out = &result[i].x();
+                    _mm_storeu_ps(out, a);
+                    _mm_storeu_ps(out + 4, b);
+                    _mm_storeu_ps(out + 8, c);
+                }
+
+                // A register per point, only the last point of the span can't be read or written as 4 floats
+                for (; i < count; ++i)
+                {
+                    const __m128 point = _mm_setr_ps(points[i].x(), points[i].y(), points[i].z(), 0.0f);
+                    const __m128 value = Detail::TransformVectorSSE<3>(columns, point);
+                    PULSARION_MATH_ALIGN float lanes[4];
+                    _mm_store_ps(lanes, value);
+                    result[i].x() = lanes[0];
+                    result[i].y() = lanes[1];
+                    result[i].z() = lanes[2];
+                }
+            }
+        }
+    };
+
+    template<>
+    struct TransformFunctions<4, float, Qualifier::Aligned> : TransformFunctionsSSE<4, Qualifier::Aligned> {};
+
+    template<>
+    struct TransformFunctions<4, float, Qualifier::Packed> : TransformFunctionsSSE<4, Qualifier::Packed> {};
+
+    template<>
+    struct TransformFunctions<3, float, Qualifier::Aligned> : TransformFunctionsSSE<3, Qualifier::Aligned> {};
+
+    template<>
+    struct TransformFunctions<3, float, Qualifier::Packed> : TransformFunctionsSSE<3, Qualifier::Packed> {};
+}
@@ -96,7 +96,7 @@ namespace Pulsarion::Math
     }
 }
 
-#ifdef PULSARION_MATH_SIMD_SSE4_1
+#if defined(PULSARION_MATH_SIMD_SSE4_1) && !defined(PULSARION_MATH_DETERMINISTIC)
 #include "Vector4PackedSSE.hpp"
 #include "Vector4AlignedSSE.hpp"
 #elif defined(PULSARION_MATH_SIMD_AVX)
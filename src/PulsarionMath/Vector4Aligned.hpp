@@ -11,56 +11,67 @@ namespace Pulsarion::Math
     {
         static inline constexpr Vector<4, T, Qualifier::Aligned> negate(const Vector<4, T, Qualifier::Aligned>& vector) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::negate");
             return Vector<4, T, Qualifier::Aligned>{ -vector.x(), -vector.y(), -vector.z(), -vector.w() };
         }
 
         static inline constexpr Vector<4, T, Qualifier::Aligned> add(const Vector<4, T, Qualifier::Aligned>& left, const Vector<4, T, Qualifier::Aligned>& right) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::add");
             return Vector<4, T, Qualifier::Aligned>{ left.x() + right.x(), left.y() + right.y(), left.z() + right.z(), left.w() + right.w() };
         }
 
         static inline constexpr Vector<4, T, Qualifier::Aligned> subtract(const Vector<4, T, Qualifier::Aligned>& left, const Vector<4, T, Qualifier::Aligned>& right) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::subtract");
             return Vector<4, T, Qualifier::Aligned>{ left.x() - right.x(), left.y() - right.y(), left.z() - right.z(), left.w() - right.w() };
         }
 
         static inline constexpr Vector<4, T, Qualifier::Aligned> multiply(const Vector<4, T, Qualifier::Aligned>& left, const Vector<4, T, Qualifier::Aligned>& right) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::multiply");
             return Vector<4, T, Qualifier::Aligned>{ left.x() * right.x(), left.y() * right.y(), left.z() * right.z(), left.w() * right.w() };
         }
 
         static inline constexpr Vector<4, T, Qualifier::Aligned> divide(const Vector<4, T, Qualifier::Aligned>& left, const Vector<4, T, Qualifier::Aligned>& right) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::divide");
             return Vector<4, T, Qualifier::Aligned>{ left.x() / right.x(), left.y() / right.y(), left.z() / right.z(), left.w() / right.w() };
         }
 
         static inline constexpr Vector<4, T, Qualifier::Aligned> multiplyScale(const Vector<4, T, Qualifier::Aligned>& vector, T scalar) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::multiplyScale");
             return Vector<4, T, Qualifier::Aligned>{ vector.x() * scalar, vector.y() * scalar, vector.z() * scalar, vector.w() * scalar };
         }
 
         static inline constexpr Vector<4, T, Qualifier::Aligned> divideScale(const Vector<4, T, Qualifier::Aligned>& vector, T scalar) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::divideScale");
             return Vector<4, T, Qualifier::Aligned>{ vector.x() / scalar, vector.y() / scalar, vector.z() / scalar, vector.w() / scalar };
         }
 
         static inline constexpr bool equal(const Vector<4, T, Qualifier::Aligned>& left, const Vector<4, T, Qualifier::Aligned>& right) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::equal");
             return left.x() == right.x() && left.y() == right.y() && left.z() == right.z() && left.w() == right.w();
         }
 
         static inline constexpr bool notEqual(const Vector<4, T, Qualifier::Aligned>& left, const Vector<4, T, Qualifier::Aligned>& right) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::notEqual");
             return left.x() != right.x() || left.y() != right.y() || left.z() != right.z() || left.w() != right.w();
         }
 
         static inline constexpr T dot(const Vector<4, T, Qualifier::Aligned>& left, const Vector<4, T, Qualifier::Aligned>& right) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::dot");
             return left.x() * right.x() + left.y() * right.y() + left.z() * right.z() + left.w() * right.w();
         }
 
         static inline constexpr T lengthSquared(const Vector<4, T, Qualifier::Aligned>& vector) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::lengthSquared");
             return vector.x() * vector.x() + vector.y() * vector.y() + vector.z() * vector.z() + vector.w() * vector.w();
         }
     };
@@ -4,6 +4,7 @@
 #endif
 
 #include <immintrin.h>
+#include <type_traits>
 
 namespace Pulsarion::Math
 {
@@ -12,21 +13,25 @@ namespace Pulsarion::Math
     {
         static inline constexpr Vector<4, float, Qualifier::Aligned> negate(const Vector<4, float, Qualifier::Aligned>& vector) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::negate");
             return Vector<4, float, Qualifier::Aligned>{ -vector.x(), -vector.y(), -vector.z(), -vector.w() };
         }
 
         static inline constexpr Vector<4, float, Qualifier::Aligned> add(const Vector<4, float, Qualifier::Aligned>& left, const Vector<4, float, Qualifier::Aligned>& right) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::add");
             return Vector<4, float, Qualifier::Aligned>{ left.x() + right.x(), left.y() + right.y(), left.z() + right.z(), left.w() + right.w() };
         }
 
         static inline constexpr Vector<4, float, Qualifier::Aligned> subtract(const Vector<4, float, Qualifier::Aligned>& left, const Vector<4, float, Qualifier::Aligned>& right) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::subtract");
             return Vector<4, float, Qualifier::Aligned>{ left.x() - right.x(), left.y() - right.y(), left.z() - right.z(), left.w() - right.w() };
         }
 
         static inline Vector<4, float, Qualifier::Aligned> multiply(const Vector<4, float, Qualifier::Aligned>& left, const Vector<4, float, Qualifier::Aligned>& right) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::multiply");
             __m128 left128 = _mm_load_ps(&left.x());
             __m128 right128 = _mm_load_ps(&right.x());
             // NOLINTNEXTLINE(portability-simd-intrinsics)
@@ -38,6 +43,7 @@ namespace Pulsarion::Math
 
         static inline Vector<4, float, Qualifier::Aligned> divide(const Vector<4, float, Qualifier::Aligned>& left, const Vector<4, float, Qualifier::Aligned>& right) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::divide");
             __m128 left128 = _mm_load_ps(&left.x());
             __m128 right128 = _mm_load_ps(&right.x());
             // NOLINTNEXTLINE(portability-simd-intrinsics)
@@ -49,6 +55,7 @@ namespace Pulsarion::Math
 
         static inline Vector<4, float, Qualifier::Aligned> multiplyScale(const Vector<4, float, Qualifier::Aligned>& vector, float scalar) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::multiplyScale");
             __m128 vector128 = _mm_load_ps(&vector.x());
             // NOLINTNEXTLINE(portability-simd-intrinsics)
             __m128 result = _mm_mul_ps(vector128, _mm_set1_ps(scalar));
@@ -59,6 +66,7 @@ namespace Pulsarion::Math
 
         static inline Vector<4, float, Qualifier::Aligned> divideScale(const Vector<4, float, Qualifier::Aligned>& vector, float scalar) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::divideScale");
             __m128 vector128 = _mm_load_ps(&vector.x());
             // NOLINTNEXTLINE(portability-simd-intrinsics)
             __m128 result = _mm_div_ps(vector128, _mm_set1_ps(scalar));
@@ -69,16 +77,26 @@ namespace Pulsarion::Math
 
         static inline constexpr bool equal(const Vector<4, float, Qualifier::Aligned>& left, const Vector<4, float, Qualifier::Aligned>& right) noexcept
         {
-            return left.x() == right.x() && left.y() == right.y() && left.z() == right.z() && left.w() == right.w();
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::equal");
+            if (std::is_constant_evaluated())
+                return left.x() == right.x() && left.y() == right.y() && left.z() == right.z() && left.w() == right.w();
+            // One comparison and a movemask, instead of four compares and branches
+            // NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_movemask_ps(_mm_cmpeq_ps(_mm_load_ps(&left.x()), _mm_load_ps(&right.x()))) == 0xF;
         }
 
         static inline constexpr bool notEqual(const Vector<4, float, Qualifier::Aligned>& left, const Vector<4, float, Qualifier::Aligned>& right) noexcept
         {
-            return left.x() != right.x() || left.y() != right.y() || left.z() != right.z() || left.w() != right.w();
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::notEqual");
+            if (std::is_constant_evaluated())
+                return left.x() != right.x() || left.y() != right.y() || left.z() != right.z() || left.w() != right.w();
+            // NOLINTNEXTLINE(portability-simd-intrinsics)
+            return _mm_movemask_ps(_mm_cmpneq_ps(_mm_load_ps(&left.x()), _mm_load_ps(&right.x()))) != 0;
         }
 
         static inline float dot(const Vector<4, float, Qualifier::Aligned>& left, const Vector<4, float, Qualifier::Aligned>& right) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::dot");
             __m128 left128 = _mm_load_ps(&left.x());
             __m128 right128 = _mm_load_ps(&right.x());
             // NOLINTNEXTLINE(portability-simd-intrinsics)
@@ -88,6 +106,7 @@ namespace Pulsarion::Math
 
         static inline float lengthSquared(const Vector<4, float, Qualifier::Aligned>& vector) noexcept
         {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Vector4Aligned::lengthSquared");
             // x * x + y * y + z * z + w * w == dot(vector, vector)
             return dot(vector, vector); // This is to save caching another function
         }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core.hpp"
+#include "Instrument.hpp"
 #include "Qualifier.hpp"
 
 namespace Pulsarion::Math
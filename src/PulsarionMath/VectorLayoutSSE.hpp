@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Vector.hpp"
+
+#include <immintrin.h>
+
+// The register layouts the SSE kernels share: a float vector in a register, and 4 packed
+// 3 component vectors (3 registers) to and from one register per component.
+namespace Pulsarion::Math::Detail
+{
+    // Aligned vectors are one aligned load (3 component ones with their padding lane). Packed 3 component vectors are loaded
+    // as 8 + 4 bytes, so nothing past the vector is read, and lane 3 is zero. The 8 bytes go through movq (an integer load),
+    // which is defined for any address, packed vectors are only aligned to 4
+    template<std::size_t N, Qualifier Q>
+    inline __m128 LoadVectorSSE(const Vector<N, float, Q>& vector) noexcept
+    {
+        if constexpr (Q == Qualifier::Aligned)
+            return _mm_load_ps(&vector.x());
+        else if constexpr (N == 4)
+            return _mm_loadu_ps(&vector.x());
+        else
+            return _mm_movelh_ps(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&vector.x()))), _mm_load_ss(&vector.z()));
+    }
+
+    // Aligned 3 component vectors store lane 3 into their padding, packed ones only write their 12 bytes
+    template<std::size_t N, Qualifier Q>
+    inline void StoreVectorSSE(__m128 value, Vector<N, float, Q>& vector) noexcept
+    {
+        if constexpr (Q == Qualifier::Aligned)
+            _mm_store_ps(&vector.x(), value);
+        else if constexpr (N == 4)
+            _mm_storeu_ps(&vector.x(), value);
+        else
+        {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(&vector.x()), _mm_castps_si128(value));
+            _mm_store_ss(&vector.z(), _mm_movehl_ps(value, value));
+        }
+    }
+
+    // column0 * x + column1 * y + column2 * z + column3 * w, with w = 1 for 3 components, whose lane 3 is cleared
+    template<std::size_t N>
+    inline __m128 TransformVectorSSE(const __m128 (&columns)[4], __m128 value) noexcept
+    {
+        const __m128 xy = _mm_add_ps(_mm_mul_ps(columns[0], _mm_shuffle_ps(value, value, _MM_SHUFFLE(0, 0, 0, 0))),
+                                     _mm_mul_ps(columns[1], _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 1, 1, 1))));
+        const __m128 z = _mm_mul_ps(columns[2], _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 2, 2, 2)));
+        if constexpr (N == 4)
+            return _mm_add_ps(xy, _mm_add_ps(z, _mm_mul_ps(columns[3], _mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 3, 3)))));
+        else
+            return _mm_blend_ps(_mm_add_ps(xy, _mm_add_ps(z, columns[3])), _mm_setzero_ps(), 0b1000);
+    }
+
+    // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3 to x0 x1 x2 x3 | y0 y1 y2 y3 | z0 z1 z2 z3
+    inline void ToSoASSE(__m128 a, __m128 b, __m128 c, __m128& x, __m128& y, __m128& z) noexcept
+    {
+        const __m128 x2y2x3y3 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+        const __m128 y0z0y1z1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+        x = _mm_shuffle_ps(a, x2y2x3y3, _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm_shuffle_ps(y0z0y1z1, x2y2x3y3, _MM_SHUFFLE(3, 1, 2, 0));
+        z = _mm_shuffle_ps(y0z0y1z1, c, _MM_SHUFFLE(3, 0, 3, 1));
+    }
+
+    // The inverse of ToSoASSE
+    inline void ToAoSSSE(__m128 x, __m128 y, __m128 z, __m128& a, __m128& b, __m128& c) noexcept
+    {
+        const __m128 x0y0x1y1 = _mm_unpacklo_ps(x, y);
+        const __m128 x2y2x3y3 = _mm_unpackhi_ps(x, y);
+        a = _mm_shuffle_ps(x0y0x1y1, _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+        b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), x2y2x3y3, _MM_SHUFFLE(1, 0, 2, 0));
+        c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+}
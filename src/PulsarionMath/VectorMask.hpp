@@ -0,0 +1,132 @@
+#pragma once
+#define PULSARION_MATH_VECTOR_MASK_HPP
+
+#include "Vector.hpp"
+#include "VectorMaskCommon.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+// Lane-wise comparisons of vectors, and selection between them without branches.
+// Comparisons are ordered, so a NaN lane is false for everything except NotEqual.
+// Min and Max return the right lane when either is NaN (like minps and maxps), so Clamp and Saturate map NaN to the lower bound.
+namespace Pulsarion::Math
+{
+    // All bits of a lane set where it is true, the same layout as the result of an SSE comparison
+    template<std::size_t N>
+    requires (N >= 2 && N <= 4)
+    class VectorMask
+    {
+    public:
+        PULSARION_MATH_ALIGN std::uint32_t data[N];
+
+        // ---- Constructors ----
+        inline constexpr VectorMask(bool x, bool y, bool z, bool w) noexcept
+        requires (N == 4) : data{ Lane(x), Lane(y), Lane(z), Lane(w) } {}
+        inline constexpr VectorMask(bool x, bool y, bool z) noexcept
+        requires (N == 3) : data{ Lane(x), Lane(y), Lane(z) } {}
+        inline constexpr VectorMask(bool x, bool y) noexcept
+        requires (N == 2) : data{ Lane(x), Lane(y) } {}
+        explicit inline constexpr VectorMask(bool value) noexcept
+        {
+            for (std::size_t i = 0; i < N; ++i)
+                data[i] = Lane(value);
+        }
+        inline constexpr VectorMask() noexcept : VectorMask(false) {}
+
+        // ---- Accessors ----
+        inline constexpr bool operator[](std::size_t index) const noexcept { return data[index] != 0; }
+
+        // ---- Logic operators ----
+        inline VectorMask operator&(const VectorMask& other) const noexcept { return MaskFunctions<N>::logicalAnd(*this, other); }
+        inline VectorMask operator|(const VectorMask& other) const noexcept { return MaskFunctions<N>::logicalOr(*this, other); }
+        inline VectorMask operator^(const VectorMask& other) const noexcept { return MaskFunctions<N>::logicalXor(*this, other); }
+        inline VectorMask operator~() const noexcept { return MaskFunctions<N>::logicalNot(*this); }
+
+    private:
+        static inline constexpr std::uint32_t Lane(bool value) noexcept { return value ? 0xFFFFFFFFu : 0u; }
+    };
+
+    // ---- Reductions ----
+    // Bit i is set where lane i is true
+    template<std::size_t N>
+    inline int MoveMask(const VectorMask<N>& mask) noexcept { return MaskFunctions<N>::moveMask(mask); }
+
+    template<std::size_t N>
+    inline bool Any(const VectorMask<N>& mask) noexcept { return MoveMask(mask) != 0; }
+
+    template<std::size_t N>
+    inline bool All(const VectorMask<N>& mask) noexcept { return MoveMask(mask) == (1 << N) - 1; }
+
+    template<std::size_t N>
+    inline bool None(const VectorMask<N>& mask) noexcept { return MoveMask(mask) == 0; }
+
+    // ---- Comparisons ----
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline VectorMask<N> LessThan(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept { return VectorMaskFunctions<N, T, Q>::lessThan(left, right); }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline VectorMask<N> LessEqual(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept { return VectorMaskFunctions<N, T, Q>::lessEqual(left, right); }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline VectorMask<N> GreaterThan(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept { return VectorMaskFunctions<N, T, Q>::lessThan(right, left); }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline VectorMask<N> GreaterEqual(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept { return VectorMaskFunctions<N, T, Q>::lessEqual(right, left); }
+
+    // Lane-wise, unlike operator== which compares the whole vector
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline VectorMask<N> Equal(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept { return VectorMaskFunctions<N, T, Q>::equal(left, right); }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline VectorMask<N> NotEqual(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept { return VectorMaskFunctions<N, T, Q>::notEqual(left, right); }
+
+    // |left - right| <= epsilon
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline VectorMask<N> NearEqual(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right, std::type_identity_t<T> epsilon) noexcept
+    {
+        return VectorMaskFunctions<N, T, Q>::nearEqual(left, right, epsilon);
+    }
+
+    // ---- Selection ----
+    // The lanes of left where the mask is true, and of right elsewhere
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline Vector<N, T, Q> Select(const VectorMask<N>& mask, const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept
+    {
+        return VectorMaskFunctions<N, T, Q>::select(mask, left, right);
+    }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline Vector<N, T, Q> Min(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept { return VectorMaskFunctions<N, T, Q>::min(left, right); }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline Vector<N, T, Q> Max(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept { return VectorMaskFunctions<N, T, Q>::max(left, right); }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline Vector<N, T, Q> Clamp(const Vector<N, T, Q>& vector, const Vector<N, T, Q>& min, const Vector<N, T, Q>& max) noexcept
+    {
+        return VectorMaskFunctions<N, T, Q>::clamp(vector, min, max);
+    }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline Vector<N, T, Q> Clamp(const Vector<N, T, Q>& vector, std::type_identity_t<T> min, std::type_identity_t<T> max) noexcept
+    {
+        return VectorMaskFunctions<N, T, Q>::clamp(vector, Vector<N, T, Q>(min), Vector<N, T, Q>(max));
+    }
+
+    // Clamped to [0, 1]
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline Vector<N, T, Q> Saturate(const Vector<N, T, Q>& vector) noexcept
+    {
+        return VectorMaskFunctions<N, T, Q>::clamp(vector, Vector<N, T, Q>(T(0)), Vector<N, T, Q>(T(1)));
+    }
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    inline Vector<N, T, Q> Abs(const Vector<N, T, Q>& vector) noexcept { return VectorMaskFunctions<N, T, Q>::abs(vector); }
+}
+
+#include "VectorMaskGeneric.hpp"
+
+#ifdef PULSARION_MATH_SIMD_SSE4_1
+#include "VectorMaskSSE.hpp"
+#endif
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Instrument.hpp"
+#include "Qualifier.hpp"
+
+namespace Pulsarion::Math
+{
+    template<std::size_t N>
+    struct MaskFunctions; // Logic and reductions on lane masks.
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    struct VectorMaskFunctions; // Lane-wise comparisons and branchless selection for the Vector class.
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#ifndef PULSARION_MATH_VECTOR_MASK_HPP
+#include "VectorMask.hpp"
+#endif
+
+#include <cmath>
+#include <type_traits>
+
+namespace Pulsarion::Math
+{
+    template<std::size_t N>
+    struct MaskFunctions
+    {
+        static inline int moveMask(const VectorMask<N>& mask) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Mask", N, "::moveMask");
+            // The sign bit of each lane, like movmskps
+            int result = 0;
+            for (std::size_t i = 0; i < N; ++i)
+                result |= static_cast<int>(mask.data[i] >> 31) << i;
+            return result;
+        }
+
+        static inline VectorMask<N> logicalAnd(const VectorMask<N>& left, const VectorMask<N>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Mask", N, "::logicalAnd");
+            VectorMask<N> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result.data[i] = left.data[i] & right.data[i];
+            return result;
+        }
+
+        static inline VectorMask<N> logicalOr(const VectorMask<N>& left, const VectorMask<N>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Mask", N, "::logicalOr");
+            VectorMask<N> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result.data[i] = left.data[i] | right.data[i];
+            return result;
+        }
+
+        static inline VectorMask<N> logicalXor(const VectorMask<N>& left, const VectorMask<N>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Mask", N, "::logicalXor");
+            VectorMask<N> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result.data[i] = left.data[i] ^ right.data[i];
+            return result;
+        }
+
+        static inline VectorMask<N> logicalNot(const VectorMask<N>& mask) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Mask", N, "::logicalNot");
+            VectorMask<N> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result.data[i] = ~mask.data[i];
+            return result;
+        }
+    };
+
+    template<std::size_t N, Arithmetic_t T, Qualifier Q>
+    struct VectorMaskFunctions
+    {
+        static inline VectorMask<N> lessThan(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask", N, "::lessThan");
+            return Compare(left, right, [](T a, T b) { return a < b; });
+        }
+
+        static inline VectorMask<N> lessEqual(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask", N, "::lessEqual");
+            return Compare(left, right, [](T a, T b) { return a <= b; });
+        }
+
+        static inline VectorMask<N> equal(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask", N, "::equal");
+            return Compare(left, right, [](T a, T b) { return a == b; });
+        }
+
+        static inline VectorMask<N> notEqual(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask", N, "::notEqual");
+            return Compare(left, right, [](T a, T b) { return a != b; });
+        }
+
+        static inline VectorMask<N> nearEqual(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right, T epsilon) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask", N, "::nearEqual");
+            // Ordered this way, unsigned types don't wrap around
+            return Compare(left, right, [epsilon](T a, T b) { return (a > b ? a - b : b - a) <= epsilon; });
+        }
+
+        static inline Vector<N, T, Q> select(const VectorMask<N>& mask, const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask", N, "::select");
+            Vector<N, T, Q> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result[i] = mask[i] ? left[i] : right[i];
+            return result;
+        }
+
+        static inline Vector<N, T, Q> min(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask", N, "::min");
+            Vector<N, T, Q> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result[i] = Min(left[i], right[i]);
+            return result;
+        }
+
+        static inline Vector<N, T, Q> max(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask", N, "::max");
+            Vector<N, T, Q> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result[i] = Max(left[i], right[i]);
+            return result;
+        }
+
+        static inline Vector<N, T, Q> clamp(const Vector<N, T, Q>& vector, const Vector<N, T, Q>& min, const Vector<N, T, Q>& max) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask", N, "::clamp");
+            Vector<N, T, Q> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result[i] = Min(Max(vector[i], min[i]), max[i]);
+            return result;
+        }
+
+        static inline Vector<N, T, Q> abs(const Vector<N, T, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask", N, "::abs");
+            Vector<N, T, Q> result;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                // std::abs clears the sign of -0 and NaN as well, like masking off the sign bit
+                if constexpr (std::is_floating_point_v<T>)
+                    result[i] = std::abs(vector[i]);
+                else if constexpr (std::is_unsigned_v<T>)
+                    result[i] = vector[i];
+                else // Signed integers and the scalars of IsArithmetic (Fixed)
+                    result[i] = static_cast<T>(vector[i] < T(0) ? -vector[i] : vector[i]);
+            }
+            return result;
+        }
+
+    private:
+        template<typename F>
+        static inline VectorMask<N> Compare(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right, F predicate) noexcept
+        {
+            VectorMask<N> result;
+            for (std::size_t i = 0; i < N; ++i)
+                result.data[i] = predicate(left[i], right[i]) ? 0xFFFFFFFFu : 0u;
+            return result;
+        }
+
+        // The same operand order as minps and maxps, the right lane is returned when either is NaN
+        static inline T Min(T left, T right) noexcept { return left < right ? left : right; }
+        static inline T Max(T left, T right) noexcept { return left > right ? left : right; }
+    };
+}
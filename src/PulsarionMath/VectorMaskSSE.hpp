@@ -0,0 +1,146 @@
+#pragma once
+
+#ifndef PULSARION_MATH_VECTOR_MASK_HPP
+#include "VectorMask.hpp"
+#endif
+
+#include "VectorLayoutSSE.hpp"
+
+#include <immintrin.h>
+
+namespace Pulsarion::Math
+{
+    template<>
+    struct MaskFunctions<4>
+    {
+        static inline int moveMask(const VectorMask<4>& mask) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Mask4::moveMask");
+            return _mm_movemask_ps(_mm_castsi128_ps(Load(mask)));
+        }
+
+        static inline VectorMask<4> logicalAnd(const VectorMask<4>& left, const VectorMask<4>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Mask4::logicalAnd");
+            return Store(_mm_and_si128(Load(left), Load(right)));
+        }
+
+        static inline VectorMask<4> logicalOr(const VectorMask<4>& left, const VectorMask<4>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Mask4::logicalOr");
+            return Store(_mm_or_si128(Load(left), Load(right)));
+        }
+
+        static inline VectorMask<4> logicalXor(const VectorMask<4>& left, const VectorMask<4>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Mask4::logicalXor");
+            return Store(_mm_xor_si128(Load(left), Load(right)));
+        }
+
+        static inline VectorMask<4> logicalNot(const VectorMask<4>& mask) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("Mask4::logicalNot");
+            return Store(_mm_xor_si128(Load(mask), _mm_set1_epi32(-1)));
+        }
+
+        static inline __m128i Load(const VectorMask<4>& mask) noexcept
+        {
+            return _mm_load_si128(reinterpret_cast<const __m128i*>(mask.data));
+        }
+
+        static inline VectorMask<4> Store(__m128i value) noexcept
+        {
+            VectorMask<4> result;
+            _mm_store_si128(reinterpret_cast<__m128i*>(result.data), value);
+            return result;
+        }
+    };
+
+    template<Qualifier Q>
+    struct VectorMaskFunctionsSSE
+    {
+        static inline VectorMask<4> lessThan(const Vector<4, float, Q>& left, const Vector<4, float, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask4::lessThan");
+            return StoreMask(_mm_cmplt_ps(Detail::LoadVectorSSE(left), Detail::LoadVectorSSE(right)));
+        }
+
+        static inline VectorMask<4> lessEqual(const Vector<4, float, Q>& left, const Vector<4, float, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask4::lessEqual");
+            return StoreMask(_mm_cmple_ps(Detail::LoadVectorSSE(left), Detail::LoadVectorSSE(right)));
+        }
+
+        static inline VectorMask<4> equal(const Vector<4, float, Q>& left, const Vector<4, float, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask4::equal");
+            return StoreMask(_mm_cmpeq_ps(Detail::LoadVectorSSE(left), Detail::LoadVectorSSE(right)));
+        }
+
+        static inline VectorMask<4> notEqual(const Vector<4, float, Q>& left, const Vector<4, float, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask4::notEqual");
+            return StoreMask(_mm_cmpneq_ps(Detail::LoadVectorSSE(left), Detail::LoadVectorSSE(right)));
+        }
+
+        static inline VectorMask<4> nearEqual(const Vector<4, float, Q>& left, const Vector<4, float, Q>& right, float epsilon) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask4::nearEqual");
+            return StoreMask(_mm_cmple_ps(Abs(_mm_sub_ps(Detail::LoadVectorSSE(left), Detail::LoadVectorSSE(right))), _mm_set1_ps(epsilon)));
+        }
+
+        static inline Vector<4, float, Q> select(const VectorMask<4>& mask, const Vector<4, float, Q>& left, const Vector<4, float, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask4::select");
+            return Store(_mm_blendv_ps(Detail::LoadVectorSSE(right), Detail::LoadVectorSSE(left), _mm_castsi128_ps(MaskFunctions<4>::Load(mask))));
+        }
+
+        static inline Vector<4, float, Q> min(const Vector<4, float, Q>& left, const Vector<4, float, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask4::min");
+            return Store(_mm_min_ps(Detail::LoadVectorSSE(left), Detail::LoadVectorSSE(right)));
+        }
+
+        static inline Vector<4, float, Q> max(const Vector<4, float, Q>& left, const Vector<4, float, Q>& right) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask4::max");
+            return Store(_mm_max_ps(Detail::LoadVectorSSE(left), Detail::LoadVectorSSE(right)));
+        }
+
+        static inline Vector<4, float, Q> clamp(const Vector<4, float, Q>& vector, const Vector<4, float, Q>& min, const Vector<4, float, Q>& max) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask4::clamp");
+            return Store(_mm_min_ps(_mm_max_ps(Detail::LoadVectorSSE(vector), Detail::LoadVectorSSE(min)), Detail::LoadVectorSSE(max)));
+        }
+
+        static inline Vector<4, float, Q> abs(const Vector<4, float, Q>& vector) noexcept
+        {
+            PULSARION_MATH_INSTRUMENT_KERNEL("VectorMask4::abs");
+            return Store(Abs(Detail::LoadVectorSSE(vector)));
+        }
+
+    private:
+        static inline __m128 Abs(__m128 value) noexcept
+        {
+            return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+        }
+
+        static inline Vector<4, float, Q> Store(__m128 value) noexcept
+        {
+            Vector<4, float, Q> result;
+            Detail::StoreVectorSSE(value, result);
+            return result;
+        }
+
+        static inline VectorMask<4> StoreMask(__m128 value) noexcept
+        {
+            return MaskFunctions<4>::Store(_mm_castps_si128(value));
+        }
+    };
+
+    template<>
+    struct VectorMaskFunctions<4, float, Qualifier::Aligned> : VectorMaskFunctionsSSE<Qualifier::Aligned> {};
+
+    template<>
+    struct VectorMaskFunctions<4, float, Qualifier::Packed> : VectorMaskFunctionsSSE<Qualifier::Packed> {};
+}
@@ -0,0 +1,301 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Accuracy.hpp"
+#include "PulsarionMath/Matrix.hpp"
+#include "PulsarionMath/Transcendental.hpp"
+
+#include <bit>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace Pulsarion::Math;
+using Accuracy::UlpStats;
+
+namespace
+{
+    using Vec4 = Vector<4, float, Qualifier::Aligned>;
+
+    // Correct rounding, plus the rounding of the long double reference itself
+    constexpr long double CorrectlyRounded = 0.5L + 1e-9L;
+    constexpr std::size_t SampleCount = 1 << 16;
+
+    constexpr float EdgeCases[] = {
+        0.0f, -0.0f, 1.0f, -1.0f, 1e-30f, -1e30f, 3.0f, 1.0f / 3.0f,
+        std::numeric_limits<float>::denorm_min(), -1e-40f, std::numeric_limits<float>::min(), -std::numeric_limits<float>::min() / 2.0f,
+        std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), std::numeric_limits<float>::epsilon(), 1.0f + std::numeric_limits<float>::epsilon(),
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(), -2.5f,
+    };
+
+    // The edge cases, then random bit patterns, which cover every exponent (denormals, NaN and infinity included)
+    std::vector<float> AnyFloats(std::uint32_t seed)
+    {
+        std::mt19937 engine(seed);
+        std::vector<float> values(std::begin(EdgeCases), std::end(EdgeCases));
+        while (values.size() < SampleCount)
+            values.push_back(std::bit_cast<float>(static_cast<std::uint32_t>(engine())));
+        return values;
+    }
+
+    // Signed values within a few orders of magnitude of 1, so sums of products neither overflow nor underflow
+    std::vector<float> ModerateFloats(std::uint32_t seed)
+    {
+        std::mt19937 engine(seed);
+        std::uniform_real_distribution<float> mantissa(-1.0f, 1.0f);
+        std::uniform_int_distribution<int> exponent(-8, 8);
+        std::vector<float> values(SampleCount);
+        for (float& value : values)
+            value = std::ldexp(mantissa(engine), exponent(engine));
+        return values;
+    }
+
+    Vec4 Load(const std::vector<float>& values, std::size_t index)
+    {
+        return Vec4(values[index], values[index + 1], values[index + 2], values[index + 3]);
+    }
+
+    void Report(const std::vector<UlpStats>& stats)
+    {
+        Accuracy::Dump(std::cout, stats);
+    }
+
+    template<Qualifier Q>
+    std::vector<UlpStats> MeasureElementwise(const char* prefix)
+    {
+        using V = Vector<4, float, Q>;
+        using F = VectorFunctions<4, float, Q>;
+        const std::string name = prefix;
+        std::vector<UlpStats> stats = { UlpStats(name + "::negate"), UlpStats(name + "::add"), UlpStats(name + "::subtract"), UlpStats(name + "::multiply"),
+                                        UlpStats(name + "::divide"), UlpStats(name + "::multiplyScale"), UlpStats(name + "::divideScale") };
+
+        const std::vector<float> left = AnyFloats(1), right = AnyFloats(2);
+        // Every edge case against every other one as well
+        std::vector<float> lefts = left, rights = right;
+        for (float a : EdgeCases)
+        {
+            for (float b : EdgeCases)
+            {
+                lefts.push_back(a);
+                rights.push_back(b);
+            }
+        }
+
+        for (std::size_t i = 0; i + 4 <= lefts.size(); i += 4)
+        {
+            const V a(lefts[i], lefts[i + 1], lefts[i + 2], lefts[i + 3]);
+            const V b(rights[i], rights[i + 1], rights[i + 2], rights[i + 3]);
+            const float scalar = rights[i];
+            const V results[] = { F::negate(a), F::add(a, b), F::subtract(a, b), F::multiply(a, b), F::divide(a, b), F::multiplyScale(a, scalar), F::divideScale(a, scalar) };
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                const long double x = a[k], y = b[k], s = scalar;
+                const long double references[] = { -x, x + y, x - y, x * y, x / y, x * s, x / s };
+                for (std::size_t kernel = 0; kernel < stats.size(); ++kernel)
+                    stats[kernel].Add(references[kernel], results[kernel][k]);
+            }
+        }
+        return stats;
+    }
+
+    // Sums of products, measured in ULP of the sum of their magnitudes
+    struct DotReference
+    {
+        long double sum = 0.0L;
+        long double magnitude = 0.0L;
+
+        void Add(long double left, long double right)
+        {
+            sum += left * right;
+            magnitude += std::abs(left * right);
+        }
+    };
+
+    // M is Matrix<R, C, float>, or Affine3x4<float>
+    template<std::size_t R, std::size_t C, typename M = Matrix<R, C, float>>
+    void MeasureMatrix(std::vector<UlpStats>& stats)
+    {
+        constexpr bool Affine = std::is_same_v<M, Affine3x4<float>>;
+        const std::string name = Affine ? std::string("Affine3x4") : "Matrix" + std::to_string(R) + "x" + std::to_string(C);
+        UlpStats multiply(name + "::Multiply");
+        UlpStats vecMultiply(name + "::VecMultiply");
+
+        const std::vector<float> values = ModerateFloats(R * 10 + C);
+        constexpr std::size_t Stride = 2 * R * C + C;
+        for (std::size_t offset = 0; offset + Stride <= values.size(); offset += Stride)
+        {
+            M left, right;
+            Vector<C, float, Qualifier::Aligned> vector;
+            for (std::size_t i = 0; i < R; ++i)
+            {
+                for (std::size_t j = 0; j < C; ++j)
+                {
+                    left.Get(i, j) = values[offset + i * C + j];
+                    right.Get(i, j) = values[offset + R * C + i * C + j];
+                }
+            }
+            for (std::size_t j = 0; j < C; ++j)
+                vector[j] = values[offset + 2 * R * C + j];
+
+            // The affine 3x4 has an implicit (0, 0, 0, 1) last row, the others only multiply square
+            if constexpr (R == C || Affine)
+            {
+                const M product = left * right;
+                for (std::size_t i = 0; i < R; ++i)
+                {
+                    for (std::size_t j = 0; j < C; ++j)
+                    {
+                        DotReference reference;
+                        for (std::size_t k = 0; k < R; ++k)
+                            reference.Add(left.Get(i, k), right.Get(k, j));
+                        if (Affine && j == 3)
+                            reference.Add(left.Get(i, 3), 1.0L);
+                        multiply.Add(reference.sum, product.Get(i, j), reference.magnitude);
+                    }
+                }
+            }
+
+            const Vector<Affine ? 4 : R, float, Qualifier::Aligned> transformed = left * vector;
+            for (std::size_t i = 0; i < R; ++i)
+            {
+                DotReference reference;
+                for (std::size_t k = 0; k < C; ++k)
+                    reference.Add(left.Get(i, k), vector[k]);
+                vecMultiply.Add(reference.sum, transformed[i], reference.magnitude);
+            }
+        }
+        stats.push_back(multiply);
+        stats.push_back(vecMultiply);
+    }
+
+    template<typename F, typename R>
+    UlpStats MeasureTranscendental(const char* name, F function, R reference, float from, float to, bool absolute = false)
+    {
+        UlpStats stats(name);
+        std::mt19937 engine(7);
+        std::uniform_real_distribution<float> distribution(from, to);
+        for (std::size_t i = 0; i < SampleCount; i += 4)
+        {
+            const Vec4 input(distribution(engine), distribution(engine), distribution(engine), distribution(engine));
+            const Vec4 output = function(input);
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                const long double expected = reference(static_cast<long double>(input[k]));
+                stats.Add(expected, output[k], absolute ? 1.0L : expected);
+            }
+        }
+        return stats;
+    }
+}
+
+TEST(AccuracyTests, Ulp)
+{
+    EXPECT_EQ(std::ldexp(1.0L, -23), Accuracy::Ulp<float>(1.0L));
+    EXPECT_EQ(std::ldexp(1.0L, -23), Accuracy::Ulp<float>(-1.999L));
+    EXPECT_EQ(std::ldexp(1.0L, -24), Accuracy::Ulp<float>(0.75L));
+    EXPECT_EQ(std::ldexp(1.0L, -52), Accuracy::Ulp<double>(1.5L));
+    // Every denormal (and zero) has the spacing of the smallest one
+    EXPECT_EQ(std::numeric_limits<float>::denorm_min(), Accuracy::Ulp<float>(0.0L));
+    EXPECT_EQ(std::numeric_limits<float>::denorm_min(), Accuracy::Ulp<float>(1e-42L));
+    EXPECT_EQ(std::numeric_limits<float>::denorm_min(), Accuracy::Ulp<float>(std::numeric_limits<float>::min()));
+
+    UlpStats stats("Test");
+    stats.Add(1.0L, 1.0f + std::numeric_limits<float>::epsilon());
+    stats.Add(1e40L, std::numeric_limits<float>::infinity());
+    stats.Add(1.0L, std::numeric_limits<float>::infinity());
+    stats.Add(std::numeric_limits<long double>::quiet_NaN(), 0.0f);
+    stats.Add(std::numeric_limits<long double>::quiet_NaN(), std::numeric_limits<float>::quiet_NaN());
+    EXPECT_EQ(5u, stats.samples);
+    EXPECT_EQ(2u, stats.mismatches);
+    EXPECT_EQ(1.0L, stats.maxUlp);
+    EXPECT_EQ(0.2L, stats.MeanUlp());
+}
+
+TEST(AccuracyTests, ElementwiseIsCorrectlyRounded)
+{
+    std::vector<UlpStats> stats = MeasureElementwise<Qualifier::Aligned>("Vector4Aligned");
+    std::vector<UlpStats> packed = MeasureElementwise<Qualifier::Packed>("Vector4Packed");
+    stats.insert(stats.end(), packed.begin(), packed.end());
+    Report(stats);
+
+    for (const UlpStats& kernel : stats)
+    {
+        EXPECT_LE(kernel.maxUlp, CorrectlyRounded) << kernel.kernel << " " << static_cast<double>(kernel.worstReference);
+        EXPECT_EQ(0u, kernel.mismatches) << kernel.kernel;
+    }
+}
+
+TEST(AccuracyTests, DotProducts)
+{
+    std::vector<UlpStats> stats = { UlpStats("Vector4Aligned::dot"), UlpStats("Vector4Aligned::lengthSquared"),
+                                    UlpStats("Vector4Packed::dot"), UlpStats("Vector4Packed::lengthSquared") };
+    const std::vector<float> left = ModerateFloats(3), right = ModerateFloats(4);
+    for (std::size_t i = 0; i + 4 <= left.size(); i += 4)
+    {
+        const Vec4 a = Load(left, i), b = Load(right, i);
+        const Vector<4, float, Qualifier::Packed> packedA(a.x(), a.y(), a.z(), a.w()), packedB(b.x(), b.y(), b.z(), b.w());
+        DotReference dot, lengthSquared;
+        for (std::size_t k = 0; k < 4; ++k)
+        {
+            dot.Add(a[k], b[k]);
+            lengthSquared.Add(a[k], a[k]);
+        }
+        stats[0].Add(dot.sum, VectorFunctions<4, float, Qualifier::Aligned>::dot(a, b), dot.magnitude);
+        stats[1].Add(lengthSquared.sum, VectorFunctions<4, float, Qualifier::Aligned>::lengthSquared(a));
+        stats[2].Add(dot.sum, VectorFunctions<4, float, Qualifier::Packed>::dot(packedA, packedB), dot.magnitude);
+        stats[3].Add(lengthSquared.sum, VectorFunctions<4, float, Qualifier::Packed>::lengthSquared(packedA));
+    }
+    Report(stats);
+
+    // Four rounded products and three rounded additions
+    for (const UlpStats& kernel : stats)
+    {
+        EXPECT_LE(kernel.maxUlp, 3.5L) << kernel.kernel;
+        EXPECT_EQ(0u, kernel.mismatches) << kernel.kernel;
+    }
+}
+
+TEST(AccuracyTests, MatrixProducts)
+{
+    std::vector<UlpStats> stats;
+    MeasureMatrix<2, 2>(stats);
+    MeasureMatrix<3, 3>(stats);
+    MeasureMatrix<4, 4>(stats);
+    MeasureMatrix<3, 4>(stats);
+    MeasureMatrix<3, 4, Affine3x4<float>>(stats);
+    Report(stats);
+
+    for (const UlpStats& kernel : stats)
+    {
+        EXPECT_LE(kernel.maxUlp, 3.5L) << kernel.kernel;
+        EXPECT_EQ(0u, kernel.mismatches) << kernel.kernel;
+    }
+}
+
+TEST(AccuracyTests, Transcendentals)
+{
+    constexpr float HalfPi = 1.57079632f;
+    const std::vector<UlpStats> stats = {
+        MeasureTranscendental("Sin", [](const Vec4& v) { return Sin(v); }, [](long double x) { return std::sin(x); }, -100.0f, 100.0f),
+        MeasureTranscendental("Cos", [](const Vec4& v) { return Cos(v); }, [](long double x) { return std::cos(x); }, -100.0f, 100.0f),
+        MeasureTranscendental("Tan", [](const Vec4& v) { return Tan(v); }, [](long double x) { return std::tan(x); }, -HalfPi, HalfPi),
+        MeasureTranscendental("Exp", [](const Vec4& v) { return Exp(v); }, [](long double x) { return std::exp(x); }, -87.0f, 88.0f),
+        MeasureTranscendental("Log", [](const Vec4& v) { return Log(v); }, [](long double x) { return std::log(x); }, 1e-3f, 1e3f),
+        MeasureTranscendental("Atan2 (y, 1)", [](const Vec4& v) { return Atan2(v, Vec4(1.0f)); }, [](long double y) { return std::atan2(y, 1.0L); }, -50.0f, 50.0f),
+        // The fast variants are measured in ULP of 1, their documented error is absolute
+        MeasureTranscendental("FastSin (absolute)", [](const Vec4& v) { return FastSin(v); }, [](long double x) { return std::sin(x); }, -100.0f, 100.0f, true),
+        MeasureTranscendental("FastCos (absolute)", [](const Vec4& v) { return FastCos(v); }, [](long double x) { return std::cos(x); }, -100.0f, 100.0f, true),
+        MeasureTranscendental("FastLog (absolute)", [](const Vec4& v) { return FastLog(v); }, [](long double x) { return std::log(x); }, 0.5f, 2.0f, true),
+    };
+    Report(stats);
+
+    // The bounds documented in Transcendental.hpp
+    const long double bounds[] = { 2.0L, 2.0L, 4.0L, 2.0L, 1.0L, 3.0L, 2e-5L * (1 << 23), 2e-5L * (1 << 23), 2e-7L * (1 << 23) };
+    for (std::size_t i = 0; i < stats.size(); ++i)
+    {
+        EXPECT_LE(stats[i].maxUlp, bounds[i]) << stats[i].kernel;
+        EXPECT_EQ(0u, stats[i].mismatches) << stats[i].kernel;
+    }
+}
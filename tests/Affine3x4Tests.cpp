@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Matrix.hpp"
+
+using namespace Pulsarion::Math;
+
+TEST(Affine3x4Tests, DefaultConstructor)
+{
+    Affine3x4<float> m;
+    // Should be an identity matrix
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+            EXPECT_FLOAT_EQ(i == j ? 1.0f : 0.0f, m.Get(i, j));
+    }
+}
+
+TEST(Affine3x4Tests, Size)
+{
+    EXPECT_EQ(sizeof(Matrix<4, 4, float>) / 4 * 3, sizeof(Affine3x4<float>));
+}
+
+TEST(Affine3x4Tests, ToMatrix4x4)
+{
+    Affine3x4<float> m(1.0f, 2.0f, 3.0f, 4.0f,
+                       5.0f, 6.0f, 7.0f, 8.0f,
+                       9.0f, 10.0f, 11.0f, 12.0f);
+    Matrix<4, 4, float> promoted = m.ToMatrix4x4();
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+            EXPECT_FLOAT_EQ(m.Get(i, j), promoted.Get(i, j));
+    }
+    EXPECT_FLOAT_EQ(0.0f, promoted.Get(3, 0));
+    EXPECT_FLOAT_EQ(0.0f, promoted.Get(3, 1));
+    EXPECT_FLOAT_EQ(0.0f, promoted.Get(3, 2));
+    EXPECT_FLOAT_EQ(1.0f, promoted.Get(3, 3));
+
+    Affine3x4<float> demoted(promoted);
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+            EXPECT_FLOAT_EQ(m.Get(i, j), demoted.Get(i, j));
+    }
+}
+
+TEST(Affine3x4Tests, MatrixMultiply)
+{
+    Affine3x4<float> m1(1.0f, 2.0f, 3.0f, 4.0f,
+                        5.0f, 6.0f, 7.0f, 8.0f,
+                        9.0f, 10.0f, 11.0f, 12.0f);
+    Affine3x4<float> m2(2.0f, 0.0f, 1.0f, -1.0f,
+                        0.0f, 3.0f, 0.0f, 2.0f,
+                        1.0f, 0.0f, 4.0f, 5.0f);
+    Affine3x4<float> result = m1 * m2;
+    Matrix<4, 4, float> expected = m1.ToMatrix4x4() * m2.ToMatrix4x4();
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+            EXPECT_FLOAT_EQ(expected.Get(i, j), result.Get(i, j));
+    }
+}
+
+TEST(Affine3x4Tests, VectorMultiply)
+{
+    Affine3x4<float> m(1.0f, 2.0f, 3.0f, 4.0f,
+                       5.0f, 6.0f, 7.0f, 8.0f,
+                       9.0f, 10.0f, 11.0f, 12.0f);
+    Vector<4, float, Qualifier::Aligned> v(1.0f, 2.0f, 3.0f, 4.0f);
+
+    Vector<4, float, Qualifier::Aligned> result = m * v;
+    EXPECT_FLOAT_EQ(30.0f, result[0]);
+    EXPECT_FLOAT_EQ(70.0f, result[1]);
+    EXPECT_FLOAT_EQ(110.0f, result[2]);
+    EXPECT_FLOAT_EQ(4.0f, result[3]);
+}
+
+TEST(Affine3x4Tests, TransformPoint)
+{
+    Affine3x4<float> m(1.0f, 2.0f, 3.0f, 4.0f,
+                       5.0f, 6.0f, 7.0f, 8.0f,
+                       9.0f, 10.0f, 11.0f, 12.0f);
+    Vector<4, float, Qualifier::Aligned> v(1.0f, 2.0f, 3.0f, 7.0f);
+
+    Vector<4, float, Qualifier::Aligned> result = m.TransformPoint(v);
+    EXPECT_FLOAT_EQ(18.0f, result[0]);
+    EXPECT_FLOAT_EQ(46.0f, result[1]);
+    EXPECT_FLOAT_EQ(74.0f, result[2]);
+    EXPECT_FLOAT_EQ(1.0f, result[3]);
+}
+
+TEST(Affine3x4Tests, TransformDirection)
+{
+    Affine3x4<float> m(1.0f, 2.0f, 3.0f, 4.0f,
+                       5.0f, 6.0f, 7.0f, 8.0f,
+                       9.0f, 10.0f, 11.0f, 12.0f);
+    Vector<4, float, Qualifier::Aligned> v(1.0f, 2.0f, 3.0f, 7.0f);
+
+    Vector<4, float, Qualifier::Aligned> result = m.TransformDirection(v);
+    EXPECT_FLOAT_EQ(14.0f, result[0]);
+    EXPECT_FLOAT_EQ(38.0f, result[1]);
+    EXPECT_FLOAT_EQ(62.0f, result[2]);
+    EXPECT_FLOAT_EQ(0.0f, result[3]);
+}
+
+TEST(Affine3x4Tests, Inverse)
+{
+    Affine3x4<float> m(2.0f, 0.0f, 1.0f, -1.0f,
+                       1.0f, 3.0f, 0.0f, 2.0f,
+                       1.0f, 0.0f, 4.0f, 5.0f);
+    Affine3x4<float> result = m * m.Inverse();
+    Affine3x4<float> reversed = m.Inverse() * m;
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            EXPECT_NEAR(i == j ? 1.0f : 0.0f, result.Get(i, j), 1e-5f);
+            EXPECT_NEAR(i == j ? 1.0f : 0.0f, reversed.Get(i, j), 1e-5f);
+        }
+    }
+}
+
+TEST(Affine3x4Tests, InverseOrthonormal)
+{
+    // 90 degree rotation around z, then a translation
+    Affine3x4<float> m(0.0f, -1.0f, 0.0f, 3.0f,
+                       1.0f, 0.0f, 0.0f, -2.0f,
+                       0.0f, 0.0f, 1.0f, 5.0f);
+    Affine3x4<float> inverse = m.InverseOrthonormal();
+    Affine3x4<float> expected = m.Inverse();
+    Affine3x4<float> result = m * inverse;
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            EXPECT_FLOAT_EQ(expected.Get(i, j), inverse.Get(i, j));
+            EXPECT_FLOAT_EQ(i == j ? 1.0f : 0.0f, result.Get(i, j));
+        }
+    }
+}
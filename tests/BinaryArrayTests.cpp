@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/BinaryArray.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    using Matrix4f = Matrix<4, 4, float>;
+    using Vector3fPacked = Vector<3, float, Qualifier::Packed>;
+    using Vector4dAligned = Vector<4, double, Qualifier::Aligned>;
+
+    std::filesystem::path TempPath(const char* name)
+    {
+        return std::filesystem::temp_directory_path() / (std::string("PulsarionMath") + name + ".bin");
+    }
+
+    std::vector<Matrix<4, 4, float>> MakeMatrices(std::size_t count)
+    {
+        std::vector<Matrix<4, 4, float>> matrices(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            for (std::size_t row = 0; row < 4; ++row)
+            {
+                for (std::size_t column = 0; column < 4; ++column)
+                    matrices[i].Get(row, column) = static_cast<float>(i * 16 + row * 4 + column);
+            }
+        }
+        return matrices;
+    }
+}
+
+TEST(BinaryArrayTests, MatricesRoundTrip)
+{
+    const auto path = TempPath("Matrices");
+    const auto matrices = MakeMatrices(1000);
+    ASSERT_EQ(BinaryArrayStatus::Ok, WriteBinaryArray<Matrix4f>(path, matrices));
+    EXPECT_EQ(sizeof(BinaryArrayHeader) + matrices.size() * sizeof(Matrix4f), std::filesystem::file_size(path));
+
+    MappedBinaryArray file;
+    ASSERT_EQ(BinaryArrayStatus::Ok, file.Open(path));
+    EXPECT_EQ(1000u, file.Header().count);
+    EXPECT_EQ(4, file.Header().rows);
+    EXPECT_EQ(4, file.Header().columns);
+    const auto view = file.As<Matrix4f>();
+    ASSERT_EQ(1000u, view.size());
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(view.data()) % BinaryArrayHeader::PayloadAlignment);
+    for (std::size_t i = 0; i < view.size(); ++i)
+    {
+        for (std::size_t row = 0; row < 4; ++row)
+        {
+            for (std::size_t column = 0; column < 4; ++column)
+                ASSERT_EQ(matrices[i].Get(row, column), view[i].Get(row, column));
+        }
+    }
+
+    file.Close();
+    EXPECT_FALSE(file.IsOpen());
+    EXPECT_TRUE(file.As<Matrix4f>().empty());
+    std::filesystem::remove(path);
+}
+
+TEST(BinaryArrayTests, VectorsRoundTrip)
+{
+    const auto path = TempPath("Vectors");
+    std::vector<Vector3fPacked> points;
+    for (int i = 0; i < 17; ++i)
+        points.emplace_back(static_cast<float>(i), static_cast<float>(-i), 0.5f * static_cast<float>(i));
+    ASSERT_EQ(BinaryArrayStatus::Ok, WriteBinaryArray<Vector3fPacked>(path, points));
+
+    MappedBinaryArray file;
+    ASSERT_EQ(BinaryArrayStatus::Ok, file.Open(path));
+    const auto view = file.As<Vector3fPacked>();
+    ASSERT_EQ(points.size(), view.size());
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        for (std::size_t d = 0; d < 3; ++d)
+            EXPECT_EQ(points[i][d], view[i][d]);
+    }
+
+    // The mapping moves with the object
+    MappedBinaryArray moved = std::move(file);
+    EXPECT_EQ(view.data(), moved.As<Vector3fPacked>().data());
+    moved.Close();
+    std::filesystem::remove(path);
+}
+
+TEST(BinaryArrayTests, Empty)
+{
+    const auto path = TempPath("Empty");
+    ASSERT_EQ(BinaryArrayStatus::Ok, WriteBinaryArray<Vector4dAligned>(path, {}));
+    MappedBinaryArray file;
+    ASSERT_EQ(BinaryArrayStatus::Ok, file.Open(path));
+    EXPECT_EQ(BinaryArrayStatus::Ok, file.Check<Vector4dAligned>());
+    EXPECT_TRUE(file.As<Vector4dAligned>().empty());
+    file.Close();
+    std::filesystem::remove(path);
+}
+
+TEST(BinaryArrayTests, RejectsOtherTypes)
+{
+    const auto path = TempPath("Types");
+    ASSERT_EQ(BinaryArrayStatus::Ok, WriteBinaryArray<Matrix4f>(path, MakeMatrices(3)));
+    MappedBinaryArray file;
+    ASSERT_EQ(BinaryArrayStatus::Ok, file.Open(path));
+    EXPECT_EQ(BinaryArrayStatus::TypeMismatch, (file.Check<Matrix<4, 4, double>>()));
+    EXPECT_EQ(BinaryArrayStatus::TypeMismatch, (file.Check<Matrix<3, 4, float>>()));
+    EXPECT_EQ(BinaryArrayStatus::TypeMismatch, (file.Check<Affine3x4<float>>()));
+    EXPECT_EQ(BinaryArrayStatus::TypeMismatch, (file.Check<Vector<4, float, Qualifier::Aligned>>()));
+    EXPECT_TRUE((file.As<Matrix<4, 4, double>>().empty()));
+    file.Close();
+    std::filesystem::remove(path);
+}
+
+TEST(BinaryArrayTests, RejectsCorruptFiles)
+{
+    const auto path = TempPath("Corrupt");
+    MappedBinaryArray file;
+    // A mapped file can't be truncated on every platform, so it is closed first
+    const auto write = [&path, &file](const BinaryArrayHeader& header, std::size_t payload) {
+        file.Close();
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        const std::vector<char> zeros(payload);
+        stream.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+    };
+
+    // Fewer elements than the header says
+    write(MakeBinaryArrayHeader<Matrix4f>(10), 9 * sizeof(Matrix4f));
+    ASSERT_EQ(BinaryArrayStatus::Ok, file.Open(path));
+    EXPECT_EQ(BinaryArrayStatus::Truncated, file.Check<Matrix4f>());
+
+    // Written with the other major order
+    BinaryArrayHeader header = MakeBinaryArrayHeader<Matrix4f>(2);
+    header.layout = header.layout == BinaryLayout::ColumnMajor ? BinaryLayout::RowMajor : BinaryLayout::ColumnMajor;
+    write(header, 2 * sizeof(Matrix4f));
+    ASSERT_EQ(BinaryArrayStatus::Ok, file.Open(path));
+    EXPECT_EQ(BinaryArrayStatus::LayoutMismatch, file.Check<Matrix4f>());
+
+    // Written by a build that aligned the elements differently
+    header = MakeBinaryArrayHeader<Matrix4f>(2);
+    header.elementAlignment = alignof(Matrix4f) / 2;
+    write(header, 2 * sizeof(Matrix4f));
+    ASSERT_EQ(BinaryArrayStatus::Ok, file.Open(path));
+    EXPECT_EQ(BinaryArrayStatus::TypeMismatch, file.Check<Matrix4f>());
+
+    header = MakeBinaryArrayHeader<Matrix4f>(2);
+    header.magic[0] = 'X';
+    write(header, 2 * sizeof(Matrix4f));
+    ASSERT_EQ(BinaryArrayStatus::Ok, file.Open(path));
+    EXPECT_EQ(BinaryArrayStatus::BadMagic, file.Check<Matrix4f>());
+
+    header = MakeBinaryArrayHeader<Matrix4f>(2);
+    header.version = 2;
+    write(header, 2 * sizeof(Matrix4f));
+    ASSERT_EQ(BinaryArrayStatus::Ok, file.Open(path));
+    EXPECT_EQ(BinaryArrayStatus::UnsupportedVersion, file.Check<Matrix4f>());
+
+    // Shorter than a header
+    file.Close();
+    {
+        std::ofstream shortFile(path, std::ios::binary | std::ios::trunc);
+        shortFile << "PMATH";
+    }
+    EXPECT_EQ(BinaryArrayStatus::Truncated, file.Open(path));
+    EXPECT_EQ(BinaryArrayStatus::NotOpen, file.Check<Matrix4f>());
+
+    file.Close();
+    std::filesystem::remove(path);
+    EXPECT_EQ(BinaryArrayStatus::OpenFailed, file.Open(path));
+}
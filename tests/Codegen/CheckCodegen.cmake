@@ -0,0 +1,100 @@
+# Compares the code generated for the kernels in Kernels.cpp with the checked in budgets, run by CTest as
+#   cmake -DOBJECTS=<Kernels.o> -DOBJDUMP=<objdump> -DBUDGETS=<Budgets/ISA.txt> [-DLLVM_MCA=<llvm-mca> -DMCA_CPU=<cpu>] -P CheckCodegen.cmake
+# Each line of the budgets is "<kernel> <instructions> <memory operations>". A kernel fails if it has more instructions or
+# memory operations (instructions with a memory operand, lea excluded) than its budget, or if it is missing from the object.
+# Spilling shows up as both, so a compiler upgrade that spills fails here. Kernels well under their budget are reported,
+# so the budget can be tightened. With llvm-mca, the estimated reciprocal throughput of each kernel is reported as well (never fails).
+cmake_minimum_required(VERSION 3.20)
+
+foreach (variable OBJECTS OBJDUMP BUDGETS)
+    if (NOT DEFINED ${variable})
+        message(FATAL_ERROR "CheckCodegen: ${variable} is not set")
+    endif()
+endforeach()
+
+execute_process(COMMAND "${OBJDUMP}" -d --no-show-raw-insn ${OBJECTS}
+    OUTPUT_VARIABLE disassembly
+    RESULT_VARIABLE result)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "CheckCodegen: ${OBJDUMP} failed (${result})")
+endif()
+
+# Counts of each kernel, and its instructions as assembly for llvm-mca
+string(REPLACE ";" "," disassembly "${disassembly}")
+string(REPLACE "\n" ";" lines "${disassembly}")
+set(kernel "")
+set(kernels "")
+foreach (line IN LISTS lines)
+    if (line MATCHES "^[0-9a-f]+ <([A-Za-z0-9_]+)>:$")
+        set(kernel "${CMAKE_MATCH_1}")
+        list(APPEND kernels "${kernel}")
+        set(instructions_${kernel} 0)
+        set(memory_${kernel} 0)
+        set(assembly_${kernel} "")
+    elseif (NOT kernel STREQUAL "" AND line MATCHES "^ +[0-9a-f]+:\t([a-z0-9]+)(.*)$")
+        set(mnemonic "${CMAKE_MATCH_1}")
+        set(operands "${CMAKE_MATCH_2}")
+        if (mnemonic MATCHES "^(nop|int3)")
+            continue() # Padding
+        endif()
+        math(EXPR instructions_${kernel} "${instructions_${kernel}} + 1")
+        if (operands MATCHES "\\(" AND NOT mnemonic STREQUAL "lea")
+            math(EXPR memory_${kernel} "${memory_${kernel}} + 1")
+        endif()
+        # Branch targets are printed as "3e <Kernel+0x3e>", llvm-mca takes the address
+        string(REGEX REPLACE "[ \t]+([0-9a-f]+) <[^>]*>" " 0x\\1" operands "${operands}")
+        string(REGEX REPLACE "[ \t]*#.*$" "" operands "${operands}")
+        string(APPEND assembly_${kernel} "${mnemonic}${operands}\n")
+    endif()
+endforeach()
+
+file(STRINGS "${BUDGETS}" budgets REGEX "^[^#]")
+set(failures 0)
+foreach (budget IN LISTS budgets)
+    if (NOT budget MATCHES "^([A-Za-z0-9_]+)[ \t]+([0-9]+)[ \t]+([0-9]+)[ \t]*$")
+        message(FATAL_ERROR "CheckCodegen: malformed budget \"${budget}\" in ${BUDGETS}")
+    endif()
+    set(name "${CMAKE_MATCH_1}")
+    set(maxInstructions "${CMAKE_MATCH_2}")
+    set(maxMemory "${CMAKE_MATCH_3}")
+
+    if (NOT name IN_LIST kernels)
+        message(SEND_ERROR "${name}: not found in the object")
+        math(EXPR failures "${failures} + 1")
+        continue()
+    endif()
+
+    set(report "${name}: ${instructions_${name}}/${maxInstructions} instructions, ${memory_${name}}/${maxMemory} memory operations")
+    if (DEFINED LLVM_MCA AND NOT LLVM_MCA STREQUAL "")
+        file(WRITE "${CMAKE_CURRENT_BINARY_DIR}/${name}.s" "${assembly_${name}}")
+        set(cpu "")
+        if (DEFINED MCA_CPU AND NOT MCA_CPU STREQUAL "")
+            set(cpu "-mcpu=${MCA_CPU}")
+        endif()
+        execute_process(COMMAND "${LLVM_MCA}" ${cpu} "${CMAKE_CURRENT_BINARY_DIR}/${name}.s"
+            OUTPUT_VARIABLE analysis
+            ERROR_QUIET
+            RESULT_VARIABLE result)
+        if (result EQUAL 0 AND analysis MATCHES "Block RThroughput: ([0-9.]+)")
+            string(APPEND report ", ${CMAKE_MATCH_1} cycles reciprocal throughput (llvm-mca)")
+        endif()
+    endif()
+
+    if (instructions_${name} GREATER maxInstructions OR memory_${name} GREATER maxMemory)
+        message(SEND_ERROR "${report} - over budget")
+        math(EXPR failures "${failures} + 1")
+    else()
+        # Under 3/4 of the budget (and more than a few instructions), the code got better or the kernel changed, the budget can be lowered
+        math(EXPR slackInstructions "${instructions_${name}} * 4")
+        math(EXPR slackBudget "${maxInstructions} * 3")
+        math(EXPR slack "${maxInstructions} - ${instructions_${name}}")
+        if (slackInstructions LESS slackBudget AND slack GREATER 4)
+            string(APPEND report " - well under budget, consider lowering it")
+        endif()
+        message(STATUS "${report}")
+    endif()
+endforeach()
+
+if (failures GREATER 0)
+    message(FATAL_ERROR "CheckCodegen: ${failures} kernel(s) over budget or missing (${BUDGETS})")
+endif()
@@ -0,0 +1,92 @@
+// Every hot kernel in a function of its own, compiled with optimizations and disassembled by CheckCodegen.cmake,
+// which compares the instruction and memory operation counts of each with the budgets of the instruction set (Budgets/<ISA>.txt).
+// The functions are extern "C" so the symbols are the names in the budgets, arguments and results go through pointers
+// so the loads and stores of the kernel are all there is besides it.
+#include "PulsarionMath/Matrix.hpp"
+#include "PulsarionMath/Affine3x4.hpp"
+#include "PulsarionMath/Swizzle.hpp"
+
+using namespace Pulsarion::Math;
+
+using Matrix4x4f = Matrix<4, 4, float>;
+using Affine3x4f = Affine3x4<float>;
+using Matrix3x3f = Matrix<3, 3, float>;
+using Vector4f = Vector<4, float, Qualifier::Aligned>;
+using Vector3f = Vector<3, float, Qualifier::Aligned>;
+
+#define PULSARION_CODEGEN_KERNEL extern "C" __attribute__((noinline))
+
+PULSARION_CODEGEN_KERNEL void Matrix4x4_Multiply(Matrix4x4f* result, const Matrix4x4f* left, const Matrix4x4f* right) noexcept
+{
+    *result = MatrixFunctions<4, 4, float>::Multiply(*left, *right);
+}
+
+PULSARION_CODEGEN_KERNEL void Matrix4x4_VecMultiply(Vector4f* result, const Matrix4x4f* matrix, const Vector4f* vector) noexcept
+{
+    *result = MatrixFunctions<4, 4, float>::VecMultiply(*matrix, *vector);
+}
+
+PULSARION_CODEGEN_KERNEL void Matrix4x4_TransposeInPlace(Matrix4x4f* matrix) noexcept
+{
+    MatrixFunctions<4, 4, float>::TransposeInPlace(*matrix);
+}
+
+PULSARION_CODEGEN_KERNEL void Affine3x4_Multiply(Affine3x4f* result, const Affine3x4f* left, const Affine3x4f* right) noexcept
+{
+    *result = Affine3x4Functions<float>::Multiply(*left, *right);
+}
+
+PULSARION_CODEGEN_KERNEL void Affine3x4_VecMultiply(Vector4f* result, const Affine3x4f* matrix, const Vector4f* vector) noexcept
+{
+    *result = Affine3x4Functions<float>::VecMultiply(*matrix, *vector);
+}
+
+PULSARION_CODEGEN_KERNEL void Affine3x4_Inverse(Affine3x4f* result, const Affine3x4f* matrix) noexcept
+{
+    *result = Affine3x4Functions<float>::Inverse(*matrix);
+}
+
+PULSARION_CODEGEN_KERNEL void Affine3x4_InverseOrthonormal(Affine3x4f* result, const Affine3x4f* matrix) noexcept
+{
+    *result = Affine3x4Functions<float>::InverseOrthonormal(*matrix);
+}
+
+PULSARION_CODEGEN_KERNEL void Matrix3x3_Multiply(Matrix3x3f* result, const Matrix3x3f* left, const Matrix3x3f* right) noexcept
+{
+    *result = MatrixFunctions<3, 3, float>::Multiply(*left, *right);
+}
+
+PULSARION_CODEGEN_KERNEL void Matrix3x3_VecMultiply(Vector3f* result, const Matrix3x3f* matrix, const Vector3f* vector) noexcept
+{
+    *result = MatrixFunctions<3, 3, float>::VecMultiply(*matrix, *vector);
+}
+
+PULSARION_CODEGEN_KERNEL void Matrix3x3_TransposeInPlace(Matrix3x3f* matrix) noexcept
+{
+    MatrixFunctions<3, 3, float>::TransposeInPlace(*matrix);
+}
+
+PULSARION_CODEGEN_KERNEL void Vector4_Add(Vector4f* result, const Vector4f* left, const Vector4f* right) noexcept
+{
+    *result = VectorFunctions<4, float, Qualifier::Aligned>::add(*left, *right);
+}
+
+PULSARION_CODEGEN_KERNEL void Vector4_Multiply(Vector4f* result, const Vector4f* left, const Vector4f* right) noexcept
+{
+    *result = VectorFunctions<4, float, Qualifier::Aligned>::multiply(*left, *right);
+}
+
+PULSARION_CODEGEN_KERNEL float Vector4_Dot(const Vector4f* left, const Vector4f* right) noexcept
+{
+    return VectorFunctions<4, float, Qualifier::Aligned>::dot(*left, *right);
+}
+
+PULSARION_CODEGEN_KERNEL float Vector4_LengthSquared(const Vector4f* vector) noexcept
+{
+    return VectorFunctions<4, float, Qualifier::Aligned>::lengthSquared(*vector);
+}
+
+PULSARION_CODEGEN_KERNEL void Vector4_SwizzleZYXW(Vector4f* result, const Vector4f* vector) noexcept
+{
+    *result = ZYXW(*vector);
+}
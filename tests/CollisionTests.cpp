@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Collision.hpp"
+#include "PulsarionMath/Gjk.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    using Vec4 = Vector<4, float, Qualifier::Aligned>;
+    using Vec3P = Vector<3, float, Qualifier::Packed>;
+
+    OBB<float> AxisAligned(float x, float y, float z, float hx, float hy, float hz)
+    {
+        return { Vec3P(x, y, z), { Vec3P(1.0f, 0.0f, 0.0f), Vec3P(0.0f, 1.0f, 0.0f), Vec3P(0.0f, 0.0f, 1.0f) }, Vec3P(hx, hy, hz) };
+    }
+
+    // A random rotation from a random unit quaternion
+    OBB<float> RandomBox(std::mt19937& random, float spread)
+    {
+        std::normal_distribution<float> normal;
+        std::uniform_real_distribution<float> position(-spread, spread), extent(0.1f, 1.5f);
+        float q[4] = { normal(random), normal(random), normal(random), normal(random) };
+        const float length = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+        for (float& c : q)
+            c /= length;
+        const float w = q[0], x = q[1], y = q[2], z = q[3];
+        OBB<float> box;
+        box.center = Vec3P(position(random), position(random), position(random));
+        box.axes[0] = Vec3P(1 - 2 * (y * y + z * z), 2 * (x * y + w * z), 2 * (x * z - w * y));
+        box.axes[1] = Vec3P(2 * (x * y - w * z), 1 - 2 * (x * x + z * z), 2 * (y * z + w * x));
+        box.axes[2] = Vec3P(2 * (x * z + w * y), 2 * (y * z - w * x), 1 - 2 * (x * x + y * y));
+        box.halfExtents = Vec3P(extent(random), extent(random), extent(random));
+        return box;
+    }
+}
+
+TEST(CollisionTests, OBBsOverlap)
+{
+    const OBB<float> a = AxisAligned(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f);
+    EXPECT_TRUE(OBBsOverlap(a, AxisAligned(1.5f, 0.5f, 0.0f, 1.0f, 1.0f, 1.0f)));
+    EXPECT_FALSE(OBBsOverlap(a, AxisAligned(2.5f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f)));
+    EXPECT_FALSE(OBBsOverlap(a, AxisAligned(0.0f, -2.1f, 0.0f, 1.0f, 1.0f, 1.0f)));
+
+    // Rotated 45 degrees about z, its corner reaches sqrt(2) along x
+    const float s = std::sqrt(0.5f);
+    OBB<float> rotated = AxisAligned(2.3f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f);
+    rotated.axes[0] = Vec3P(s, s, 0.0f);
+    rotated.axes[1] = Vec3P(-s, s, 0.0f);
+    EXPECT_TRUE(OBBsOverlap(a, rotated));
+    rotated.center = Vec3P(2.5f, 0.0f, 0.0f);
+    EXPECT_FALSE(OBBsOverlap(a, rotated));
+
+    // Separated only along a cross product of edges: two edges crossing at right angles, skewed apart along z
+    OBB<float> edgeA = AxisAligned(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f);
+    edgeA.axes[0] = Vec3P(s, 0.0f, s);
+    edgeA.axes[2] = Vec3P(-s, 0.0f, s);
+    OBB<float> edgeB = AxisAligned(0.0f, 0.0f, 2.0f * std::sqrt(2.0f) + 0.05f, 1.0f, 1.0f, 1.0f);
+    edgeB.axes[1] = Vec3P(0.0f, s, s);
+    edgeB.axes[2] = Vec3P(0.0f, -s, s);
+    EXPECT_FALSE(OBBsOverlap(edgeA, edgeB));
+    edgeB.center = Vec3P(0.0f, 0.0f, 2.0f * std::sqrt(2.0f) - 0.05f);
+    EXPECT_TRUE(OBBsOverlap(edgeA, edgeB));
+}
+
+TEST(CollisionTests, BatchedMatchesScalar)
+{
+    std::mt19937 random(9);
+    std::vector<OBB<float>> boxes(200);
+    for (auto& box : boxes)
+        box = RandomBox(random, 3.0f);
+    std::uniform_int_distribution<std::uint32_t> index(0, static_cast<std::uint32_t>(boxes.size() - 1));
+    for (std::size_t count : { 0u, 1u, 3u, 4u, 7u, 5000u })
+    {
+        std::vector<CollisionPair> pairs(count);
+        for (auto& pair : pairs)
+            pair = { index(random), index(random) };
+        std::vector<std::uint8_t> overlaps(count, 2);
+        TestOBBPairs<float>(boxes, pairs, overlaps);
+        std::size_t overlapping = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ASSERT_EQ(overlaps[i], OBBsOverlap(boxes[pairs[i].a], boxes[pairs[i].b]) ? 1 : 0) << count << " " << i;
+            overlapping += overlaps[i];
+        }
+        if (count == 5000)
+        {
+            EXPECT_GT(overlapping, 100u);
+            EXPECT_LT(overlapping, 4900u);
+        }
+    }
+
+    std::vector<OBB<double>> doubles = { { Vector<3, double, Qualifier::Packed>(0.0, 0.0, 0.0),
+                                           { Vector<3, double, Qualifier::Packed>(1.0, 0.0, 0.0), Vector<3, double, Qualifier::Packed>(0.0, 1.0, 0.0), Vector<3, double, Qualifier::Packed>(0.0, 0.0, 1.0) },
+                                           Vector<3, double, Qualifier::Packed>(1.0, 1.0, 1.0) } };
+    doubles.push_back(doubles[0]);
+    doubles[1].center = Vector<3, double, Qualifier::Packed>(1.9, 0.0, 0.0);
+    const std::vector<CollisionPair> pairs = { { 0, 1 } };
+    std::vector<std::uint8_t> overlaps(1);
+    TestOBBPairs<double>(doubles, pairs, overlaps);
+    EXPECT_EQ(overlaps[0], 1);
+}
+
+TEST(CollisionTests, GjkSpheres)
+{
+    const SphereShape a{ Vec4(0.0f, 0.0f, 0.0f, 1.0f), 1.0f };
+    const SphereShape b{ Vec4(1.5f, 0.0f, 0.0f, 1.0f), 1.0f };
+    const SphereShape far{ Vec4(0.0f, 2.5f, 0.0f, 1.0f), 1.0f };
+    EXPECT_TRUE(GjkIntersects(a, b));
+    EXPECT_FALSE(GjkIntersects(a, far));
+
+    const Penetration penetration = GjkPenetration(a, b);
+    ASSERT_TRUE(penetration.intersecting);
+    EXPECT_NEAR(penetration.depth, 0.5f, 1e-2f);
+    EXPECT_NEAR(penetration.normal.x(), 1.0f, 1e-2f);
+    EXPECT_FALSE(GjkPenetration(a, far).intersecting);
+
+    // Concentric, the polytope inside the difference (a sphere of radius 2) gets close, but never past it
+    const Penetration concentric = GjkPenetration(a, a);
+    ASSERT_TRUE(concentric.intersecting);
+    EXPECT_GT(concentric.depth, 1.85f);
+    EXPECT_LE(concentric.depth, 2.0f);
+}
+
+TEST(CollisionTests, GjkBoxes)
+{
+    const OBBShape a{ AxisAligned(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f) };
+    const OBBShape b{ AxisAligned(1.8f, 0.5f, 0.0f, 1.0f, 1.0f, 1.0f) };
+    const Penetration penetration = GjkPenetration(a, b);
+    ASSERT_TRUE(penetration.intersecting);
+    EXPECT_NEAR(penetration.depth, 0.2f, 1e-4f);
+    EXPECT_NEAR(penetration.normal.x(), 1.0f, 1e-4f);
+    EXPECT_NEAR(penetration.normal.y(), 0.0f, 1e-4f);
+
+    // Below A, deeper along y than along x
+    const OBBShape below{ AxisAligned(-0.5f, -1.7f, 0.2f, 1.0f, 1.0f, 1.0f) };
+    const Penetration fromBelow = GjkPenetration(a, below);
+    ASSERT_TRUE(fromBelow.intersecting);
+    EXPECT_NEAR(fromBelow.depth, 0.3f, 1e-4f);
+    EXPECT_NEAR(fromBelow.normal.y(), -1.0f, 1e-4f);
+
+    // A point cloud of the corners of a box is the same shape
+    std::vector<Vec4> corners;
+    for (float x : { -1.0f, 1.0f })
+        for (float y : { -1.0f, 1.0f })
+            for (float z : { -1.0f, 1.0f })
+                corners.emplace_back(x + 1.8f, y + 0.5f, z, 1.0f);
+    const Penetration cloud = GjkPenetration(a, PointCloudShape{ corners });
+    ASSERT_TRUE(cloud.intersecting);
+    EXPECT_NEAR(cloud.depth, 0.2f, 1e-4f);
+
+    // Separating the boxes by the result leaves them touching
+    std::mt19937 random(4);
+    std::size_t intersecting = 0;
+    for (std::size_t i = 0; i < 500; ++i)
+    {
+        const OBBShape first{ RandomBox(random, 1.5f) };
+        OBBShape second{ RandomBox(random, 1.5f) };
+        const bool overlap = OBBsOverlap(first.box, second.box);
+        ASSERT_EQ(GjkIntersects(first, second), overlap) << i;
+        const Penetration result = GjkPenetration(first, second);
+        ASSERT_EQ(result.intersecting, overlap) << i;
+        if (!overlap)
+            continue;
+        ++intersecting;
+        for (std::size_t c = 0; c < 3; ++c)
+            second.box.center[c] += result.normal[c] * (result.depth + 1e-3f);
+        EXPECT_FALSE(OBBsOverlap(first.box, second.box)) << i;
+        for (std::size_t c = 0; c < 3; ++c)
+            second.box.center[c] -= result.normal[c] * 2e-3f;
+        EXPECT_TRUE(OBBsOverlap(first.box, second.box)) << i;
+    }
+    EXPECT_GT(intersecting, 50u);
+}
+
+// A hull of a thousand points on a sphere, EPA runs out of vertices and faces long before the tolerance. The face it stops at
+// is still one of a closed polytope inside the difference, so it is no farther than the difference reaches along its normal
+TEST(CollisionTests, GjkTessellated)
+{
+    std::vector<Vec4> points;
+    constexpr std::size_t count = 1000;
+    const float golden = 3.14159265f * (3.0f - std::sqrt(5.0f));
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const float y = 1.0f - 2.0f * (static_cast<float>(i) + 0.5f) / static_cast<float>(count);
+        const float radius = std::sqrt(1.0f - y * y), angle = golden * static_cast<float>(i);
+        points.emplace_back(radius * std::cos(angle), y, radius * std::sin(angle), 1.0f);
+    }
+    const PointCloudShape hull{ points };
+    const SphereShape sphere{ Vec4(0.25f, 0.0f, 0.0f, 1.0f), 1.0f };
+
+    const Penetration penetration = GjkPenetration(hull, sphere);
+    ASSERT_TRUE(penetration.intersecting);
+    EXPECT_NEAR(penetration.normal.LengthSquared(), 1.0f, 1e-4f);
+    EXPECT_GT(penetration.depth, 1.6f);
+    const float reach = hull.Support(penetration.normal).Dot(penetration.normal) - sphere.Support(-penetration.normal).Dot(penetration.normal);
+    EXPECT_LE(penetration.depth, reach + 1e-4f);
+}
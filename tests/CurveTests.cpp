@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Curve.hpp"
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    template<std::size_t N, typename T, Qualifier Q>
+    Vector<N, T, Q> MakePoint(std::size_t i)
+    {
+        Vector<N, T, Q> point;
+        for (std::size_t d = 0; d < N; ++d)
+            point[d] = static_cast<T>(std::sin(static_cast<double>(i * 5 + d * 3 + 1)) * 4.0);
+        return point;
+    }
+
+    template<std::size_t N, typename T, Qualifier Q>
+    void ExpectVectorNear(const Vector<N, T, Q>& actual, const Vector<N, T, Q>& expected, T tolerance)
+    {
+        for (std::size_t d = 0; d < N; ++d)
+            EXPECT_NEAR(actual[d], expected[d], tolerance) << "component " << d;
+    }
+
+    // The batched kernels against the scalar evaluation of the curves, which do the same operations in the same order
+    template<std::size_t N, typename T, Qualifier Q>
+    void ExpectMatchesScalar()
+    {
+        std::vector<Vector<N, T, Q>> points;
+        for (std::size_t i = 0; i < 8; ++i)
+            points.push_back(MakePoint<N, T, Q>(i));
+        const auto spline = CubicSpline<N, T, Q>::CatmullRom(points);
+
+        // An odd count, so packed vectors end with a point that is stored on its own
+        std::vector<T> parameters;
+        for (std::size_t i = 0; i < 101; ++i)
+            parameters.push_back(static_cast<T>(i) * T(0.075) - T(0.25));
+        std::vector<Vector<N, T, Q>> positions(parameters.size()), tangents(parameters.size()), positionsOnly(parameters.size());
+        spline.Evaluate(parameters, positions, tangents);
+        spline.Evaluate(parameters, positionsOnly);
+        for (std::size_t i = 0; i < parameters.size(); ++i)
+        {
+            for (std::size_t d = 0; d < N; ++d)
+            {
+                EXPECT_EQ(positions[i][d], spline.Position(parameters[i])[d]);
+                EXPECT_EQ(tangents[i][d], spline.Tangent(parameters[i])[d]);
+                EXPECT_EQ(positionsOnly[i][d], positions[i][d]);
+            }
+        }
+
+        std::vector<CubicCurve<N, T, Q>> curves;
+        std::vector<T> each;
+        for (std::size_t i = 0; i < 7; ++i)
+        {
+            curves.push_back(CubicCurve<N, T, Q>::Bezier(points[i], points[i + 1], points[(i + 2) % 8], points[(i + 3) % 8]));
+            each.push_back(static_cast<T>(i) / T(6));
+        }
+        std::vector<Vector<N, T, Q>> eachPositions(curves.size()), eachTangents(curves.size());
+        EvaluateCurves<N, T, Q>(curves, each, eachPositions, eachTangents);
+        for (std::size_t i = 0; i < curves.size(); ++i)
+        {
+            for (std::size_t d = 0; d < N; ++d)
+            {
+                EXPECT_EQ(eachPositions[i][d], curves[i].Position(each[i])[d]);
+                EXPECT_EQ(eachTangents[i][d], curves[i].Tangent(each[i])[d]);
+            }
+        }
+    }
+}
+
+TEST(CurveTests, BezierEndpoints)
+{
+    using Vector3f = Vector<3, float, Qualifier::Packed>;
+    const Vector3f p0(0.0f, 0.0f, 0.0f), p1(1.0f, 2.0f, 0.0f), p2(3.0f, 2.0f, 1.0f), p3(4.0f, 0.0f, -1.0f);
+    const auto curve = CubicCurve<3, float, Qualifier::Packed>::Bezier(p0, p1, p2, p3);
+    ExpectVectorNear(curve.Position(0.0f), p0, 1e-6f);
+    ExpectVectorNear(curve.Position(1.0f), p3, 1e-6f);
+    ExpectVectorNear(curve.Tangent(0.0f), Vector3f(3.0f, 6.0f, 0.0f), 1e-6f);
+    ExpectVectorNear(curve.Tangent(1.0f), Vector3f(3.0f, -6.0f, -6.0f), 1e-6f);
+    // The midpoint of de Casteljau, (p0 + 3 p1 + 3 p2 + p3) / 8
+    ExpectVectorNear(curve.Position(0.5f), Vector3f(2.0f, 1.5f, 0.25f), 1e-6f);
+}
+
+TEST(CurveTests, HermiteEndpoints)
+{
+    using Vector2d = Vector<2, double, Qualifier::Packed>;
+    const Vector2d p0(1.0, 2.0), m0(3.0, -1.0), p1(-2.0, 5.0), m1(0.5, 4.0);
+    const auto curve = CubicCurve<2, double, Qualifier::Packed>::Hermite(p0, m0, p1, m1);
+    ExpectVectorNear(curve.Position(0.0), p0, 1e-12);
+    ExpectVectorNear(curve.Position(1.0), p1, 1e-12);
+    ExpectVectorNear(curve.Tangent(0.0), m0, 1e-12);
+    ExpectVectorNear(curve.Tangent(1.0), m1, 1e-12);
+}
+
+TEST(CurveTests, CatmullRomPassesThroughPoints)
+{
+    using Vector4f = Vector<4, float, Qualifier::Aligned>;
+    std::vector<Vector4f> points;
+    for (std::size_t i = 0; i < 6; ++i)
+        points.push_back(MakePoint<4, float, Qualifier::Aligned>(i));
+    const auto spline = CubicSpline<4, float, Qualifier::Aligned>::CatmullRom(points);
+    ASSERT_EQ(spline.SegmentCount(), 5u);
+    for (std::size_t i = 0; i < points.size(); ++i)
+        ExpectVectorNear(spline.Position(static_cast<float>(i)), points[i], 1e-5f);
+    // The inner tangents are half the difference of the neighbors
+    for (std::size_t d = 0; d < 4; ++d)
+        EXPECT_NEAR(spline.Tangent(2.0f)[d], 0.5f * (points[3][d] - points[1][d]), 1e-5f);
+}
+
+TEST(CurveTests, BatchedMatchesScalar)
+{
+    ExpectMatchesScalar<3, float, Qualifier::Packed>();
+    ExpectMatchesScalar<3, float, Qualifier::Aligned>();
+    ExpectMatchesScalar<4, float, Qualifier::Packed>();
+    ExpectMatchesScalar<4, float, Qualifier::Aligned>();
+    ExpectMatchesScalar<3, double, Qualifier::Aligned>();
+    ExpectMatchesScalar<2, double, Qualifier::Packed>();
+}
+
+TEST(CurveTests, EvaluateSingleCurve)
+{
+    using Vector3f = Vector<3, float, Qualifier::Packed>;
+    const auto curve = CubicCurve<3, float, Qualifier::Packed>::Bezier(Vector3f(0.0f, 0.0f, 0.0f), Vector3f(1.0f, 1.0f, 0.0f), Vector3f(2.0f, -1.0f, 0.0f), Vector3f(3.0f, 0.0f, 2.0f));
+    const std::vector<float> parameters = { 0.0f, 0.25f, 0.5f, 1.0f, 1.5f };
+    std::vector<Vector3f> positions(parameters.size());
+    EvaluateCurve<3, float, Qualifier::Packed>(curve, parameters, positions);
+    for (std::size_t i = 0; i < parameters.size(); ++i)
+        ExpectVectorNear(positions[i], curve.Position(parameters[i]), 0.0f);
+}
+
+TEST(CurveTests, ArcLength)
+{
+    using Vector3d = Vector<3, double, Qualifier::Packed>;
+    // A straight line with uneven control points, so the speed isn't constant
+    const auto line = CubicSpline<3, double, Qualifier::Packed>(std::vector{ CubicCurve<3, double, Qualifier::Packed>::Bezier(
+        Vector3d(0.0, 0.0, 0.0), Vector3d(0.06, 0.08, 0.0), Vector3d(0.12, 0.16, 0.0), Vector3d(3.0, 4.0, 0.0)) });
+    const ArcLengthTable<double> lineTable(line);
+    EXPECT_NEAR(lineTable.Length(), 5.0, 1e-9);
+    EXPECT_EQ(lineTable.ParameterAt(0.0), 0.0);
+    EXPECT_EQ(lineTable.ParameterAt(10.0), 1.0);
+
+    // A circle of radius 2 through 64 points
+    std::vector<Vector3d> circle;
+    for (std::size_t i = 0; i <= 64; ++i)
+    {
+        const double angle = 2.0 * std::numbers::pi * static_cast<double>(i) / 64.0;
+        circle.emplace_back(2.0 * std::cos(angle), 2.0 * std::sin(angle), 0.0);
+    }
+    const auto spline = CubicSpline<3, double, Qualifier::Packed>::CatmullRom(circle);
+    const ArcLengthTable<double> table(spline);
+    EXPECT_NEAR(table.Length(), 4.0 * std::numbers::pi, 1e-3);
+
+    // Evenly spaced samples are evenly spaced on the circle
+    std::vector<Vector3d> samples(33);
+    SampleUniform<3, double, Qualifier::Packed>(spline, table, samples);
+    ExpectVectorNear(samples.front(), circle.front(), 1e-12);
+    ExpectVectorNear(samples.back(), circle.back(), 1e-12);
+    const double spacing = table.Length() / 32.0;
+    for (std::size_t i = 1; i < samples.size(); ++i)
+    {
+        const double dx = samples[i][0] - samples[i - 1][0], dy = samples[i][1] - samples[i - 1][1];
+        EXPECT_NEAR(std::sqrt(dx * dx + dy * dy), spacing, 1e-3);
+    }
+
+    std::vector<double> parameters(33);
+    table.UniformParameters(parameters);
+    for (std::size_t i = 0; i < parameters.size(); ++i)
+        EXPECT_NEAR(parameters[i], table.ParameterAt(spacing * static_cast<double>(i)), 1e-9);
+}
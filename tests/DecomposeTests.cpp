@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Decompose.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    template<typename T>
+    Vector<4, T, Qualifier::Aligned> AxisAngle(T x, T y, T z, T angle)
+    {
+        const T length = std::sqrt(x * x + y * y + z * z);
+        const T s = std::sin(angle / T(2)) / length;
+        return Vector<4, T, Qualifier::Aligned>(x * s, y * s, z * s, std::cos(angle / T(2)));
+    }
+
+    template<typename T>
+    std::vector<TRS<T>> MakeTransforms()
+    {
+        std::vector<TRS<T>> transforms;
+        const T angles[] = { T(0), T(0.3), T(1.7), T(3.1), T(-2.5) };
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            TRS<T> transform;
+            transform.translation = Vector<3, T, Qualifier::Aligned>(T(i), T(-2) * T(i), T(0.5));
+            transform.rotation = AxisAngle<T>(T(1), T(i) - T(2), T(0.5) + T(i), angles[i]);
+            transform.scale = Vector<3, T, Qualifier::Aligned>(T(1) + T(i), T(0.5), T(2) + T(i) * T(0.25));
+            transforms.push_back(transform);
+        }
+        return transforms;
+    }
+
+    // q and -q are the same rotation
+    template<typename T>
+    void ExpectSameRotation(const Vector<4, T, Qualifier::Aligned>& expected, const Vector<4, T, Qualifier::Aligned>& actual, T tolerance)
+    {
+        const T sign = expected[0] * actual[0] + expected[1] * actual[1] + expected[2] * actual[2] + expected[3] * actual[3] < T(0) ? T(-1) : T(1);
+        for (std::size_t i = 0; i < 4; ++i)
+            EXPECT_NEAR(expected[i], sign * actual[i], tolerance) << i;
+    }
+
+    template<std::size_t N, typename T>
+    void ExpectNear(const Matrix<N, N, T>& expected, const Matrix<N, N, T>& actual, T tolerance)
+    {
+        for (std::size_t row = 0; row < N; ++row)
+        {
+            for (std::size_t column = 0; column < N; ++column)
+                EXPECT_NEAR(expected.Get(row, column), actual.Get(row, column), tolerance) << row << " " << column;
+        }
+    }
+
+    template<typename T>
+    void ExpectRoundTrip(T tolerance)
+    {
+        const auto transforms = MakeTransforms<T>();
+        std::vector<Matrix<4, 4, T>> matrices;
+        for (const auto& transform : transforms)
+        {
+            const Matrix<4, 4, T> matrix = transform.ToMatrix();
+            matrices.push_back(matrix);
+            const TRS<T> result = Decompose<T>(matrix);
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                EXPECT_NEAR(transform.translation[i], result.translation[i], tolerance);
+                EXPECT_NEAR(transform.scale[i], result.scale[i], tolerance);
+            }
+            ExpectSameRotation<T>(transform.rotation, result.rotation, tolerance);
+            ExpectNear<4, T>(matrix, result.ToMatrix(), tolerance * T(10));
+        }
+
+        std::vector<TRS<T>> batch(matrices.size());
+        Decompose<T>(matrices, batch);
+        for (std::size_t i = 0; i < matrices.size(); ++i)
+        {
+            const TRS<T> single = Decompose<T>(matrices[i]);
+            for (std::size_t d = 0; d < 3; ++d)
+                EXPECT_EQ(single.scale[d], batch[i].scale[d]);
+            for (std::size_t d = 0; d < 4; ++d)
+                EXPECT_EQ(single.rotation[d], batch[i].rotation[d]);
+        }
+    }
+
+    template<typename T>
+    void ExpectPolar(T tolerance)
+    {
+        // A rotation times a symmetric positive definite stretch (a shear)
+        TRS<T> rotation;
+        rotation.translation = Vector<3, T, Qualifier::Aligned>(T(0), T(0), T(0));
+        rotation.rotation = AxisAngle<T>(T(0.2), T(1), T(-0.4), T(2.2));
+        rotation.scale = Vector<3, T, Qualifier::Aligned>(T(1), T(1), T(1));
+        const Matrix<4, 4, T> r4 = rotation.ToMatrix();
+        const Matrix<3, 3, T> r(r4.Get(0, 0), r4.Get(0, 1), r4.Get(0, 2), r4.Get(1, 0), r4.Get(1, 1), r4.Get(1, 2), r4.Get(2, 0), r4.Get(2, 1), r4.Get(2, 2));
+        const Matrix<3, 3, T> stretch(T(2), T(0.5), T(0.1),
+                                      T(0.5), T(1.5), T(-0.3),
+                                      T(0.1), T(-0.3), T(0.8));
+        const Matrix<3, 3, T> matrix = r * stretch;
+
+        const PolarDecomposition<T> result = PolarDecompose<T>(matrix);
+        ExpectNear<3, T>(r, result.rotation, tolerance);
+        ExpectNear<3, T>(stretch, result.stretch, tolerance);
+        ExpectNear<3, T>(matrix, result.rotation * result.stretch, tolerance);
+        ExpectNear<3, T>(Matrix<3, 3, T>(T(1)), result.rotation.Transpose() * result.rotation, tolerance);
+
+        // The 3x3 part of a 4x4 matrix, and the batched version
+        Matrix<4, 4, T> affine;
+        for (std::size_t row = 0; row < 3; ++row)
+        {
+            for (std::size_t column = 0; column < 3; ++column)
+                affine.Get(row, column) = matrix.Get(row, column);
+        }
+        affine.Get(0, 3) = T(5);
+        ExpectNear<3, T>(r, PolarDecompose<T>(affine).rotation, tolerance);
+
+        const std::vector<Matrix<3, 3, T>> matrices = { matrix, stretch, Matrix<3, 3, T>(T(3)) };
+        std::vector<PolarDecomposition<T>> batch(matrices.size());
+        PolarDecompose<T>(matrices, batch);
+        ExpectNear<3, T>(r, batch[0].rotation, tolerance);
+        ExpectNear<3, T>(Matrix<3, 3, T>(T(1)), batch[1].rotation, tolerance); // Already symmetric positive definite
+        ExpectNear<3, T>(stretch, batch[1].stretch, tolerance);
+        ExpectNear<3, T>(Matrix<3, 3, T>(T(1)), batch[2].rotation, tolerance);
+        ExpectNear<3, T>(Matrix<3, 3, T>(T(3)), batch[2].stretch, tolerance);
+    }
+}
+
+TEST(DecomposeTests, RoundTrip)
+{
+    ExpectRoundTrip<float>(2e-5f);
+    ExpectRoundTrip<double>(1e-12);
+}
+
+TEST(DecomposeTests, Mirrored)
+{
+    TRS<float> transform;
+    transform.translation = Vector<3, float, Qualifier::Aligned>(1.0f, 2.0f, 3.0f);
+    transform.rotation = AxisAngle<float>(0.0f, 0.0f, 1.0f, 0.5f);
+    transform.scale = Vector<3, float, Qualifier::Aligned>(-2.0f, 3.0f, 4.0f);
+    const TRS<float> result = Decompose<float>(transform.ToMatrix());
+    EXPECT_NEAR(-2.0f, result.scale.x(), 1e-5f);
+    EXPECT_NEAR(3.0f, result.scale.y(), 1e-5f);
+    EXPECT_NEAR(4.0f, result.scale.z(), 1e-5f);
+    ExpectSameRotation<float>(transform.rotation, result.rotation, 1e-5f);
+}
+
+TEST(DecomposeTests, Polar)
+{
+    ExpectPolar<float>(2e-5f);
+    ExpectPolar<double>(1e-12);
+}
+
+TEST(DecomposeTests, PolarOfReflection)
+{
+    const Matrix<3, 3, float> mirror(-1.0f, 0.0f, 0.0f,
+                                     0.0f, 2.0f, 0.0f,
+                                     0.0f, 0.0f, 3.0f);
+    const PolarDecomposition<float> result = PolarDecompose<float>(mirror);
+    ExpectNear<3, float>(Matrix<3, 3, float>(-1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f), result.rotation, 1e-6f);
+    ExpectNear<3, float>(Matrix<3, 3, float>(1.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 3.0f), result.stretch, 1e-6f);
+}
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Fixed.hpp"
+#include "PulsarionMath/VectorMask.hpp"
+
+#include <cstdint>
+#include <random>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    template<Qualifier Q>
+    void ExpectVectorKernelsMatchScalar()
+    {
+        using V = Vector<4, Fixed16_16, Q>;
+        using Scalar = FixedVectorFunctions<16, std::int32_t, Q>;
+        std::mt19937 random(7);
+        std::uniform_int_distribution<std::int32_t> small(-(8 << 16), 8 << 16);
+        std::uniform_int_distribution<std::int32_t> any(INT32_MIN, INT32_MAX);
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            // Mostly values whose products fit, and some that wrap
+            auto& distribution = i % 4 == 0 ? any : small;
+            V a, b;
+            for (std::size_t lane = 0; lane < 4; ++lane)
+            {
+                a[lane] = Fixed16_16::FromRaw(distribution(random));
+                b[lane] = Fixed16_16::FromRaw(distribution(random));
+            }
+            ASSERT_TRUE(Scalar::equal(a + b, Scalar::add(a, b)));
+            ASSERT_TRUE(Scalar::equal(a - b, Scalar::subtract(a, b)));
+            ASSERT_TRUE(Scalar::equal(-a, Scalar::negate(a)));
+            ASSERT_TRUE(Scalar::equal(a * b, Scalar::multiply(a, b)));
+            ASSERT_TRUE(Scalar::equal(a * b[1], Scalar::multiplyScale(a, b[1])));
+            ASSERT_TRUE(Scalar::equal(a / b, Scalar::divide(a, b)));
+            ASSERT_EQ(a.Dot(b), Scalar::dot(a, b));
+            ASSERT_EQ(a.LengthSquared(), Scalar::lengthSquared(a));
+            ASSERT_TRUE(a == a);
+            ASSERT_EQ(a != b, !Scalar::equal(a, b));
+        }
+    }
+}
+
+TEST(FixedTests, Conversions)
+{
+    EXPECT_EQ(Fixed16_16(3).Raw(), 3 << 16);
+    EXPECT_EQ(Fixed16_16(-2).Raw(), -2 * 65536);
+    EXPECT_EQ(Fixed16_16(1.5f).Raw(), 98304);
+    EXPECT_EQ(Fixed16_16(-0.25).Raw(), -16384);
+    // Ties away from zero
+    EXPECT_EQ(Fixed16_16(1.5 / 65536.0).Raw(), 2);
+    EXPECT_EQ(Fixed16_16(-1.5 / 65536.0).Raw(), -2);
+    EXPECT_EQ(Fixed32_32(0.1).Raw(), 429496730);
+
+    EXPECT_EQ(static_cast<float>(Fixed16_16(-2.75f)), -2.75f);
+    EXPECT_EQ(static_cast<double>(Fixed32_32(1234.5)), 1234.5);
+    // Toward negative infinity
+    EXPECT_EQ(static_cast<int>(Fixed16_16(2.75)), 2);
+    EXPECT_EQ(static_cast<int>(Fixed16_16(-2.25)), -3);
+}
+
+TEST(FixedTests, Arithmetic)
+{
+    EXPECT_EQ(Fixed16_16(1.5) * Fixed16_16(2.25), Fixed16_16(3.375));
+    EXPECT_EQ(Fixed16_16(-1.5) * 4, Fixed16_16(-6));
+    EXPECT_EQ(2 * Fixed16_16(0.25) + 1, Fixed16_16(1.5));
+    EXPECT_EQ(Fixed16_16::FromRaw(-1) * Fixed16_16::FromRaw(1), Fixed16_16::FromRaw(-1));
+    EXPECT_EQ((Fixed16_16(1) / Fixed16_16(3)).Raw(), 21845);
+    EXPECT_EQ((Fixed16_16(-1) / Fixed16_16(3)).Raw(), -21845);
+    EXPECT_EQ(Fixed16_16(7) / Fixed16_16(0), Fixed16_16::Max());
+    EXPECT_EQ(Fixed16_16(-7) / Fixed16_16(0), Fixed16_16::Lowest());
+    EXPECT_EQ(Fixed16_16(0) / Fixed16_16(0), Fixed16_16(0));
+    EXPECT_EQ(Fixed16_16::Max() + Fixed16_16::Epsilon(), Fixed16_16::Lowest());
+    EXPECT_LT(Fixed16_16(-0.5), Fixed16_16(0.25));
+    EXPECT_EQ(Abs(Fixed16_16(-3.5)), Fixed16_16(3.5));
+
+    Fixed16_16 value = 3;
+    value *= Fixed16_16(0.5);
+    value -= 1;
+    value /= Fixed16_16(0.25);
+    EXPECT_EQ(value, Fixed16_16(2));
+
+    // Products and quotients that need 128 bits
+    EXPECT_EQ(Fixed32_32(100000) * Fixed32_32(3.25), Fixed32_32(325000));
+    EXPECT_EQ(Fixed32_32(-7.5) * Fixed32_32(2.25), Fixed32_32(-16.875));
+    EXPECT_EQ((Fixed32_32(1) / Fixed32_32(3)).Raw(), 1431655765);
+    EXPECT_EQ((Fixed32_32(-1) / Fixed32_32(3)).Raw(), -1431655765);
+    EXPECT_EQ(Fixed32_32(1000000) / Fixed32_32(0.5), Fixed32_32(2000000));
+}
+
+TEST(FixedTests, Sqrt)
+{
+    EXPECT_EQ(Sqrt(Fixed16_16(4)), Fixed16_16(2));
+    EXPECT_EQ(Sqrt(Fixed16_16(2)).Raw(), 92681);
+    EXPECT_EQ(Sqrt(Fixed16_16(0.25)), Fixed16_16(0.5));
+    EXPECT_EQ(Sqrt(Fixed16_16(-1)), Fixed16_16(0));
+    EXPECT_EQ(Sqrt(Fixed16_16::Max()).Raw(), 11863283);
+    EXPECT_EQ(Sqrt(Fixed32_32(2)).Raw(), 6074000999);
+    EXPECT_EQ(Sqrt(Fixed32_32(1000000)), Fixed32_32(1000));
+}
+
+#ifdef __SIZEOF_INT128__
+// The fallback for compilers without 128 bit integers, against them
+TEST(FixedTests, PortableWideArithmetic)
+{
+    std::mt19937_64 random(11);
+    for (std::size_t i = 0; i < 10000; ++i)
+    {
+        const auto a = static_cast<std::int64_t>(random()) >> (i % 40);
+        auto b = static_cast<std::int64_t>(random()) >> (i % 50);
+        ASSERT_EQ(Detail::MultiplyShiftPortable<32>(a, b), Detail::MultiplyShift<32>(a, b));
+        ASSERT_EQ(Detail::MultiplyShiftPortable<16>(a, b), Detail::MultiplyShift<16>(a, b));
+        if (b == 0)
+            b = 1;
+        ASSERT_EQ(Detail::ShiftDividePortable<32>(a, b), Detail::ShiftDivide<32>(a, b));
+        ASSERT_EQ(Detail::ShiftDividePortable<16>(a, b), Detail::ShiftDivide<16>(a, b));
+    }
+    EXPECT_EQ(Detail::ShiftDividePortable<32>(INT64_MIN, -1), Detail::ShiftDivide<32>(INT64_MIN, -1));
+}
+#endif
+
+TEST(FixedTests, VectorKernelsMatchScalar)
+{
+    ExpectVectorKernelsMatchScalar<Qualifier::Aligned>();
+    ExpectVectorKernelsMatchScalar<Qualifier::Packed>();
+
+    using V = Vector<4, Fixed32_32, Qualifier::Aligned>;
+    const V a(Fixed32_32(1.5), Fixed32_32(-2), Fixed32_32(0.25), Fixed32_32(3));
+    const V b(Fixed32_32(2), Fixed32_32(0.5), Fixed32_32(-4), Fixed32_32(1));
+    EXPECT_EQ(a.Dot(b), Fixed32_32(4));
+    EXPECT_TRUE(a * b == V(Fixed32_32(3), Fixed32_32(-1), Fixed32_32(-1), Fixed32_32(3)));
+}
+
+TEST(FixedTests, Abs)
+{
+    using V = Vector<4, Fixed16_16, Qualifier::Aligned>;
+    const V abs = Abs(V(Fixed16_16(-1), Fixed16_16(2), Fixed16_16(-3.5), Fixed16_16(0)));
+    EXPECT_TRUE(abs == V(Fixed16_16(1), Fixed16_16(2), Fixed16_16(3.5), Fixed16_16(0)));
+
+    using V32 = Vector<4, Fixed32_32, Qualifier::Packed>;
+    const V32 abs32 = Abs(V32(Fixed32_32(0.25), Fixed32_32(-2), Fixed32_32(-7), Fixed32_32(4)));
+    EXPECT_TRUE(abs32 == V32(Fixed32_32(0.25), Fixed32_32(2), Fixed32_32(7), Fixed32_32(4)));
+}
+
+TEST(FixedTests, MatrixMatchesScalar)
+{
+    std::mt19937 random(3);
+    std::uniform_int_distribution<std::int32_t> distribution(-(16 << 16), 16 << 16);
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        Matrix<4, 4, Fixed16_16> left, right;
+        Vector<4, Fixed16_16, Qualifier::Aligned> vector;
+        for (std::size_t row = 0; row < 4; ++row)
+        {
+            vector[row] = Fixed16_16::FromRaw(distribution(random));
+            for (std::size_t column = 0; column < 4; ++column)
+            {
+                left.Get(row, column) = Fixed16_16::FromRaw(distribution(random));
+                right.Get(row, column) = Fixed16_16::FromRaw(distribution(random));
+            }
+        }
+        const auto product = left * right;
+        const auto expected = GenericMatrixFunctions<4, 4, Fixed16_16>::Multiply(left, right);
+        const auto transformed = left * vector;
+        const auto expectedTransformed = GenericMatrixFunctions<4, 4, Fixed16_16>::VecMultiply(left, vector);
+        for (std::size_t row = 0; row < 4; ++row)
+        {
+            ASSERT_EQ(transformed[row], expectedTransformed[row]);
+            for (std::size_t column = 0; column < 4; ++column)
+                ASSERT_EQ(product.Get(row, column), expected.Get(row, column));
+        }
+    }
+
+    const Matrix<4, 4, Fixed16_16> identity;
+    const Vector<4, Fixed16_16, Qualifier::Aligned> point(Fixed16_16(1.5), Fixed16_16(-2), Fixed16_16(3), Fixed16_16(1));
+    EXPECT_TRUE(identity * point == point);
+}
+
+#ifdef PULSARION_MATH_DETERMINISTIC
+// The SIMD dot product adds the pairs of products, the scalar order is left to right, this picks values where the two differ
+TEST(FixedTests, DeterministicFloatOrder)
+{
+    const Vector<4, float, Qualifier::Aligned> a(1.0f, 1e8f, 1.0f, -1e8f);
+    const Vector<4, float, Qualifier::Aligned> b(1.0f, 1.0f, 1.0f, 1.0f);
+    EXPECT_EQ(a.Dot(b), ((1.0f + 1e8f) + 1.0f) - 1e8f);
+}
+#endif
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Instrument.hpp"
+#include "PulsarionMath/Matrix.hpp"
+#include "PulsarionMath/Vector.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+#ifdef PULSARION_MATH_INSTRUMENT
+    Instrument::KernelStats Find(const std::string& name)
+    {
+        std::vector<Instrument::KernelStats> stats = Instrument::Snapshot();
+        auto it = std::find_if(stats.begin(), stats.end(), [&](const Instrument::KernelStats& kernel) { return kernel.name == name; });
+        return it == stats.end() ? Instrument::KernelStats{ name } : *it;
+    }
+#endif
+
+    void AddVectors(std::size_t count)
+    {
+        Vector<4, float, Qualifier::Aligned> sum(0.0f);
+        const Vector<4, float, Qualifier::Aligned> one(1.0f);
+        for (std::size_t i = 0; i < count; ++i)
+            sum = sum + one;
+        EXPECT_FLOAT_EQ(static_cast<float>(count), sum.x());
+    }
+}
+
+#ifdef PULSARION_MATH_INSTRUMENT
+TEST(InstrumentTests, CountsCalls)
+{
+    Instrument::Reset();
+    AddVectors(10);
+    Matrix<4, 4, float> a(2.0f), b(3.0f);
+    Matrix<4, 4, float> c = a * b;
+    EXPECT_FLOAT_EQ(6.0f, c[0][0]);
+
+    EXPECT_EQ(10u, Find("Vector4Aligned::add").calls);
+    EXPECT_EQ(1u, Find("Matrix4x4::Multiply").calls);
+    EXPECT_GT(Find("Matrix4x4::Multiply").cycles, 0u);
+
+    Instrument::Reset();
+    EXPECT_EQ(0u, Find("Vector4Aligned::add").calls);
+    EXPECT_EQ(0u, Find("Matrix4x4::Multiply").cycles);
+}
+
+TEST(InstrumentTests, TimingCanBeDisabled)
+{
+    Instrument::Reset();
+    Instrument::SetTimingEnabled(false);
+    AddVectors(5);
+    Instrument::SetTimingEnabled(true);
+    EXPECT_EQ(5u, Find("Vector4Aligned::add").calls);
+    EXPECT_EQ(0u, Find("Vector4Aligned::add").cycles);
+}
+
+TEST(InstrumentTests, AddsUpFinishedThreads)
+{
+    Instrument::Reset();
+    std::thread first([] { AddVectors(7); });
+    std::thread second([] { AddVectors(9); });
+    first.join();
+    second.join();
+    AddVectors(1);
+    EXPECT_EQ(17u, Find("Vector4Aligned::add").calls);
+}
+
+// The worker's counter is updated with a load and a store, a reset between them must not be undone by the store
+TEST(InstrumentTests, ResetWhileCounting)
+{
+    Instrument::Reset();
+    std::atomic<bool> stop = false;
+    std::thread worker([&] {
+        while (!stop.load())
+            AddVectors(64);
+    });
+    std::uint64_t before = 0;
+    while ((before = Find("Vector4Aligned::add").calls) < (1u << 20))
+        std::this_thread::yield();
+    Instrument::Reset();
+    stop.store(true);
+    worker.join();
+    EXPECT_LT(Find("Vector4Aligned::add").calls, before / 2);
+}
+
+TEST(InstrumentTests, Dump)
+{
+    Instrument::Reset();
+    AddVectors(3);
+    std::ostringstream stream;
+    Instrument::Dump(stream);
+    EXPECT_NE(std::string::npos, stream.str().find("Vector4Aligned::add"));
+    EXPECT_NE(std::string::npos, stream.str().find("Cycles/call"));
+}
+#else
+TEST(InstrumentTests, DisabledIsEmpty)
+{
+    AddVectors(10);
+    EXPECT_TRUE(Instrument::Snapshot().empty());
+
+    std::ostringstream stream;
+    Instrument::Dump(stream);
+    EXPECT_NE(std::string::npos, stream.str().find("disabled"));
+}
+#endif
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/KdTree.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    template<std::size_t N, typename T, Qualifier Q>
+    std::vector<Vector<N, T, Q>> MakePoints(std::size_t count, T extent, double phase = 0.0)
+    {
+        std::vector<Vector<N, T, Q>> points(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            points[i][0] = static_cast<T>(std::sin(static_cast<double>(i) * 1.7 + 0.3 + phase)) * extent;
+            points[i][1] = static_cast<T>(std::sin(static_cast<double>(i) * 2.3 + 1.1 + phase)) * extent;
+            points[i][2] = static_cast<T>(std::sin(static_cast<double>(i) * 3.1 + 2.9 + phase)) * extent;
+        }
+        return points;
+    }
+
+    template<std::size_t N, typename T, Qualifier Q>
+    T DistanceSquared(const Vector<N, T, Q>& left, const Vector<N, T, Q>& right)
+    {
+        const T dx = left[0] - right[0], dy = left[1] - right[1], dz = left[2] - right[2];
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    // The squared distances from the query to every point, nearest first
+    template<std::size_t N, typename T, Qualifier Q>
+    std::vector<T> SortedDistances(const std::vector<Vector<N, T, Q>>& points, const Vector<N, T, Q>& query)
+    {
+        std::vector<T> distances;
+        for (const auto& point : points)
+            distances.push_back(DistanceSquared(point, query));
+        std::sort(distances.begin(), distances.end());
+        return distances;
+    }
+
+    template<std::size_t N, typename T, Qualifier Q>
+    void ExpectMatchesBruteForce(std::size_t count)
+    {
+        using Tree = KdTree<N, T, Q>;
+        const auto points = MakePoints<N, T, Q>(count, T(10));
+        const auto queries = MakePoints<N, T, Q>(40, T(11), 0.5);
+        Tree tree;
+        tree.Build(points);
+        ASSERT_EQ(tree.Size(), points.size());
+
+        for (const auto& query : queries)
+        {
+            const std::vector<T> distances = SortedDistances(points, query);
+
+            const typename Tree::Neighbor nearest = tree.Nearest(query);
+            ASSERT_LT(nearest.index, points.size());
+            EXPECT_EQ(nearest.distanceSquared, distances[0]);
+            EXPECT_EQ(DistanceSquared(points[nearest.index], query), distances[0]);
+
+            for (const std::size_t k : { std::size_t(1), std::size_t(7), std::size_t(40) })
+            {
+                std::vector<typename Tree::Neighbor> neighbors(k);
+                const std::size_t found = tree.KNearest(query, neighbors);
+                ASSERT_EQ(found, std::min(k, points.size()));
+                for (std::size_t i = 0; i < found; ++i)
+                {
+                    EXPECT_EQ(neighbors[i].distanceSquared, distances[i]);
+                    EXPECT_EQ(DistanceSquared(points[neighbors[i].index], query), distances[i]);
+                }
+            }
+
+            const T radius = T(1.5);
+            std::vector<std::uint32_t> within;
+            const std::size_t count = tree.QueryRadius(query, radius, within);
+            EXPECT_EQ(count, within.size());
+            std::sort(within.begin(), within.end());
+            std::vector<std::uint32_t> expected;
+            for (std::size_t i = 0; i < points.size(); ++i)
+                if (DistanceSquared(points[i], query) <= radius * radius)
+                    expected.push_back(static_cast<std::uint32_t>(i));
+            EXPECT_EQ(within, expected);
+        }
+    }
+}
+
+TEST(KdTreeTests, MatchesBruteForce)
+{
+    ExpectMatchesBruteForce<3, float, Qualifier::Packed>(5000);
+    ExpectMatchesBruteForce<4, float, Qualifier::Aligned>(5000);
+    ExpectMatchesBruteForce<3, double, Qualifier::Aligned>(5000);
+    // A single leaf, and a count that doesn't split evenly
+    ExpectMatchesBruteForce<3, float, Qualifier::Packed>(11);
+    ExpectMatchesBruteForce<3, float, Qualifier::Packed>(1237);
+}
+
+TEST(KdTreeTests, NearestBatchMatchesNearest)
+{
+    using Tree = KdTree<3, float, Qualifier::Packed>;
+    const auto points = MakePoints<3, float, Qualifier::Packed>(20000, 10.0f);
+    const auto queries = MakePoints<3, float, Qualifier::Packed>(5000, 10.0f, 0.01);
+    Tree tree;
+    tree.Build(points);
+
+    for (const std::size_t threads : { std::size_t(1), std::size_t(4) })
+    {
+        std::vector<Tree::Neighbor> result(queries.size());
+        tree.NearestBatch(queries, result, threads);
+        for (std::size_t i = 0; i < queries.size(); ++i)
+        {
+            // Equally near points can differ, their distances can't
+            ASSERT_EQ(result[i].distanceSquared, tree.Nearest(queries[i]).distanceSquared);
+            ASSERT_EQ(DistanceSquared(points[result[i].index], queries[i]), result[i].distanceSquared);
+        }
+    }
+}
+
+// Counts just past a power of 2 times LeafSize leave leaves of different sizes, none may exceed LeafSize
+TEST(KdTreeTests, LeafSize)
+{
+    for (const std::size_t count : { std::size_t(1), KdTreeConstants::LeafSize, KdTreeConstants::LeafSize + 1, 2 * KdTreeConstants::LeafSize + 1,
+                                      4 * KdTreeConstants::LeafSize - 1, 64 * KdTreeConstants::LeafSize + 3 })
+    {
+        const auto points = MakePoints<3, float, Qualifier::Packed>(count, 10.0f);
+        KdTree<3, float, Qualifier::Packed> tree;
+        tree.Build(points);
+        const std::size_t depth = tree.Depth();
+        for (std::size_t leaf = 0; leaf < tree.LeafCount(); ++leaf)
+            EXPECT_LE(((leaf + 1) * count >> depth) - (leaf * count >> depth), KdTreeConstants::LeafSize) << count << " " << leaf;
+        // And the tree isn't deeper than it needs to be
+        if (depth > 0)
+        {
+            EXPECT_GT((count + (std::size_t(1) << (depth - 1)) - 1) >> (depth - 1), KdTreeConstants::LeafSize) << count;
+        }
+        EXPECT_EQ(tree.Nearest(points[count / 2]).distanceSquared, 0.0f) << count;
+    }
+}
+
+TEST(KdTreeTests, ParallelBuildIsDeterministic)
+{
+    const auto points = MakePoints<3, float, Qualifier::Packed>(100000, 50.0f);
+    KdTree<3, float, Qualifier::Packed> serial;
+    KdTree<3, float, Qualifier::Packed> parallel;
+    serial.Build(points, 1);
+    parallel.Build(points, 4);
+    EXPECT_EQ(serial.Depth(), parallel.Depth());
+    // The biggest leaf
+    EXPECT_LE((points.size() + (std::size_t(1) << serial.Depth()) - 1) >> serial.Depth(), KdTreeConstants::LeafSize);
+
+    const auto serialIndices = serial.SortedIndices();
+    const auto parallelIndices = parallel.SortedIndices();
+    ASSERT_EQ(serialIndices.size(), points.size());
+    EXPECT_TRUE(std::equal(serialIndices.begin(), serialIndices.end(), parallelIndices.begin(), parallelIndices.end()));
+
+    // Every point appears once
+    std::vector<std::uint32_t> sorted(serialIndices.begin(), serialIndices.end());
+    std::sort(sorted.begin(), sorted.end());
+    for (std::size_t i = 0; i < sorted.size(); ++i)
+        ASSERT_EQ(sorted[i], i);
+}
+
+TEST(KdTreeTests, EmptyAndDuplicates)
+{
+    using Vector3f = Vector<3, float, Qualifier::Packed>;
+    using Tree = KdTree<3, float, Qualifier::Packed>;
+    Tree tree;
+    tree.Build(std::span<const Vector3f>());
+    EXPECT_EQ(tree.Size(), 0u);
+    EXPECT_EQ(tree.LeafCount(), 0u);
+    EXPECT_EQ(tree.Nearest(Vector3f(0.0f, 0.0f, 0.0f)).index, Tree::InvalidIndex);
+    std::vector<Tree::Neighbor> neighbors(3);
+    EXPECT_EQ(tree.KNearest(Vector3f(0.0f, 0.0f, 0.0f), neighbors), 0u);
+    std::vector<std::uint32_t> found;
+    EXPECT_EQ(tree.QueryRadius(Vector3f(0.0f, 0.0f, 0.0f), 1.0f, found), 0u);
+
+    // Many equal points split across leaves
+    std::vector<Vector3f> points(1000, Vector3f(1.0f, 2.0f, 3.0f));
+    points[517] = Vector3f(1.0f, 2.0f, 2.5f);
+    tree.Build(points);
+    const Tree::Neighbor nearest = tree.Nearest(Vector3f(1.0f, 2.0f, 2.0f));
+    EXPECT_EQ(nearest.index, 517u);
+    EXPECT_EQ(nearest.distanceSquared, 0.25f);
+    EXPECT_EQ(tree.QueryRadius(Vector3f(1.0f, 2.0f, 3.0f), 0.0f, found), 999u);
+}
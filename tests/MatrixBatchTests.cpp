@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/MatrixBatch.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    template<std::size_t N, typename T>
+    Matrix<N, N, T> MakeMatrix(std::size_t seed)
+    {
+        Matrix<N, N, T> matrix;
+        for (std::size_t row = 0; row < N; ++row)
+        {
+            for (std::size_t column = 0; column < N; ++column)
+                matrix.Get(row, column) = static_cast<T>(std::sin(static_cast<double>(seed * 31 + row * N + column)) * 4.0);
+        }
+        return matrix;
+    }
+
+    template<std::size_t N, typename T>
+    void ExpectEqual(const Matrix<N, N, T>& expected, const Matrix<N, N, T>& actual)
+    {
+        for (std::size_t row = 0; row < N; ++row)
+        {
+            for (std::size_t column = 0; column < N; ++column)
+                ASSERT_EQ(expected.Get(row, column), actual.Get(row, column)) << row << " " << column;
+        }
+    }
+
+    // The batched products are the same operations as the single matrix ones, so they match exactly
+    template<std::size_t N, typename T>
+    void ExpectMatchesSingleProducts()
+    {
+        constexpr std::size_t count = 37;
+        std::vector<Matrix<N, N, T>> lefts, rights, results(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            lefts.push_back(MakeMatrix<N, T>(i));
+            rights.push_back(MakeMatrix<N, T>(i + 100));
+        }
+        const Matrix<N, N, T> shared = MakeMatrix<N, T>(1000);
+
+        MultiplyBatch<N, T>(shared, rights, results);
+        for (std::size_t i = 0; i < count; ++i)
+            ExpectEqual<N, T>(shared * rights[i], results[i]);
+
+        MultiplyBatch<N, T>(lefts, shared, results);
+        for (std::size_t i = 0; i < count; ++i)
+            ExpectEqual<N, T>(lefts[i] * shared, results[i]);
+
+        MultiplyBatch<N, T>(lefts, rights, results);
+        for (std::size_t i = 0; i < count; ++i)
+            ExpectEqual<N, T>(lefts[i] * rights[i], results[i]);
+
+        // In place
+        std::vector<Matrix<N, N, T>> inPlace = rights;
+        MultiplyBatch<N, T>(shared, inPlace, inPlace);
+        for (std::size_t i = 0; i < count; ++i)
+            ExpectEqual<N, T>(shared * rights[i], inPlace[i]);
+        inPlace = lefts;
+        MultiplyBatch<N, T>(inPlace, rights, inPlace);
+        for (std::size_t i = 0; i < count; ++i)
+            ExpectEqual<N, T>(lefts[i] * rights[i], inPlace[i]);
+    }
+}
+
+TEST(MatrixBatchTests, MatchesSingleProducts)
+{
+    ExpectMatchesSingleProducts<4, float>();
+    ExpectMatchesSingleProducts<3, float>();
+    ExpectMatchesSingleProducts<2, float>();
+    ExpectMatchesSingleProducts<4, double>();
+}
+
+TEST(MatrixBatchTests, Empty)
+{
+    const Matrix<4, 4, float> identity;
+    std::vector<Matrix<4, 4, float>> none;
+    MultiplyBatch<4, float>(identity, none, none);
+    MultiplyBatch<4, float>(none, identity, none);
+    MultiplyBatch<4, float>(none, none, none);
+    EXPECT_TRUE(none.empty());
+}
+
+TEST(MatrixBatchTests, ViewProjectionTimesModels)
+{
+    const Matrix<4, 4, float> viewProjection(2.0f, 0.0f, 0.0f, 0.0f,
+                                             0.0f, 3.0f, 0.0f, 0.0f,
+                                             0.0f, 0.0f, 1.0f, -1.0f,
+                                             0.0f, 0.0f, 1.0f, 0.0f);
+    std::vector<Matrix<4, 4, float>> models(5);
+    for (std::size_t i = 0; i < models.size(); ++i)
+        models[i].Get(0, 3) = static_cast<float>(i); // Translated along x
+    std::vector<Matrix<4, 4, float>> results(models.size());
+    MultiplyBatch<4, float>(viewProjection, models, results);
+    for (std::size_t i = 0; i < models.size(); ++i)
+    {
+        EXPECT_EQ(2.0f * static_cast<float>(i), results[i].Get(0, 3));
+        EXPECT_EQ(3.0f, results[i].Get(1, 1));
+        EXPECT_EQ(-1.0f, results[i].Get(2, 3));
+        EXPECT_EQ(1.0f, results[i].Get(3, 2));
+    }
+}
@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Matrix.hpp"
+
+using namespace Pulsarion::Math;
+
+TEST(MatrixTests, DefaultConstructor)
+{
+    Matrix<3, 3, float> m3;
+    Matrix<2, 3, float> m23;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        for (std::size_t j = 0; j < 3; ++j)
+            EXPECT_FLOAT_EQ(i == j ? 1.0f : 0.0f, m3.Get(i, j));
+    }
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        for (std::size_t j = 0; j < 3; ++j)
+            EXPECT_FLOAT_EQ(i == j ? 1.0f : 0.0f, m23.Get(i, j));
+    }
+}
+
+TEST(MatrixTests, ConstructorWithValues)
+{
+    Matrix<2, 3, float> m(1.0f, 2.0f, 3.0f,
+                          4.0f, 5.0f, 6.0f);
+    EXPECT_FLOAT_EQ(1.0f, m.Get(0, 0));
+    EXPECT_FLOAT_EQ(2.0f, m.Get(0, 1));
+    EXPECT_FLOAT_EQ(3.0f, m.Get(0, 2));
+    EXPECT_FLOAT_EQ(4.0f, m.Get(1, 0));
+    EXPECT_FLOAT_EQ(5.0f, m.Get(1, 1));
+    EXPECT_FLOAT_EQ(6.0f, m.Get(1, 2));
+
+    EXPECT_FLOAT_EQ(2.0f, m.Row(0)[1]);
+    EXPECT_FLOAT_EQ(5.0f, m.Column(1)[1]);
+}
+
+TEST(MatrixTests, Size)
+{
+    EXPECT_EQ(16u, sizeof(Matrix<2, 2, float>));
+    EXPECT_EQ(48u, sizeof(Matrix<3, 3, float>));
+}
+
+TEST(MatrixTests, Transpose)
+{
+    Matrix<2, 3, float> m(1.0f, 2.0f, 3.0f,
+                          4.0f, 5.0f, 6.0f);
+    Matrix<3, 2, float> t = m.Transpose();
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        for (std::size_t j = 0; j < 3; ++j)
+            EXPECT_FLOAT_EQ(m.Get(i, j), t.Get(j, i));
+    }
+
+    Matrix<3, 3, float> m3(1.0f, 2.0f, 3.0f,
+                           4.0f, 5.0f, 6.0f,
+                           7.0f, 8.0f, 9.0f);
+    Matrix<3, 3, float> t3 = m3;
+    t3.TransposeInPlace();
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        for (std::size_t j = 0; j < 3; ++j)
+            EXPECT_FLOAT_EQ(m3.Get(i, j), t3.Get(j, i));
+    }
+
+    Matrix<2, 2, float> m2(1.0f, 2.0f,
+                           3.0f, 4.0f);
+    m2.TransposeInPlace();
+    EXPECT_FLOAT_EQ(1.0f, m2.Get(0, 0));
+    EXPECT_FLOAT_EQ(3.0f, m2.Get(0, 1));
+    EXPECT_FLOAT_EQ(2.0f, m2.Get(1, 0));
+    EXPECT_FLOAT_EQ(4.0f, m2.Get(1, 1));
+}
+
+TEST(MatrixTests, Multiply3x3)
+{
+    Matrix<3, 3, float> m1(1.0f, 2.0f, 3.0f,
+                           4.0f, 5.0f, 6.0f,
+                           7.0f, 8.0f, 9.0f);
+    Matrix<3, 3, float> m2(9.0f, 8.0f, 7.0f,
+                           6.0f, 5.0f, 4.0f,
+                           3.0f, 2.0f, 1.0f);
+    Matrix<3, 3, float> result = m1 * m2;
+
+    EXPECT_FLOAT_EQ(30.0f, result.Get(0, 0));
+    EXPECT_FLOAT_EQ(24.0f, result.Get(0, 1));
+    EXPECT_FLOAT_EQ(18.0f, result.Get(0, 2));
+    EXPECT_FLOAT_EQ(84.0f, result.Get(1, 0));
+    EXPECT_FLOAT_EQ(69.0f, result.Get(1, 1));
+    EXPECT_FLOAT_EQ(54.0f, result.Get(1, 2));
+    EXPECT_FLOAT_EQ(138.0f, result.Get(2, 0));
+    EXPECT_FLOAT_EQ(114.0f, result.Get(2, 1));
+    EXPECT_FLOAT_EQ(90.0f, result.Get(2, 2));
+
+    Vector<3, float, Qualifier::Aligned> v = m1 * Vector<3, float, Qualifier::Aligned>(1.0f, 2.0f, 3.0f);
+    EXPECT_FLOAT_EQ(14.0f, v.x());
+    EXPECT_FLOAT_EQ(32.0f, v.y());
+    EXPECT_FLOAT_EQ(50.0f, v.z());
+}
+
+TEST(MatrixTests, Multiply2x2)
+{
+    Matrix<2, 2, float> m1(1.0f, 2.0f,
+                           3.0f, 4.0f);
+    Matrix<2, 2, float> m2(5.0f, 6.0f,
+                           7.0f, 8.0f);
+    Matrix<2, 2, float> result = m1 * m2;
+
+    EXPECT_FLOAT_EQ(19.0f, result.Get(0, 0));
+    EXPECT_FLOAT_EQ(22.0f, result.Get(0, 1));
+    EXPECT_FLOAT_EQ(43.0f, result.Get(1, 0));
+    EXPECT_FLOAT_EQ(50.0f, result.Get(1, 1));
+
+    Vector<2, float, Qualifier::Aligned> v = m1 * Vector<2, float, Qualifier::Aligned>(1.0f, 2.0f);
+    EXPECT_FLOAT_EQ(5.0f, v.x());
+    EXPECT_FLOAT_EQ(11.0f, v.y());
+}
+
+TEST(MatrixTests, MultiplyRectangular)
+{
+    Matrix<2, 3, float> m1(1.0f, 2.0f, 3.0f,
+                           4.0f, 5.0f, 6.0f);
+    Matrix<3, 2, float> m2(7.0f, 8.0f,
+                           9.0f, 10.0f,
+                           11.0f, 12.0f);
+    Matrix<2, 2, float> result = m1 * m2;
+
+    EXPECT_FLOAT_EQ(58.0f, result.Get(0, 0));
+    EXPECT_FLOAT_EQ(64.0f, result.Get(0, 1));
+    EXPECT_FLOAT_EQ(139.0f, result.Get(1, 0));
+    EXPECT_FLOAT_EQ(154.0f, result.Get(1, 1));
+
+    Vector<2, float, Qualifier::Aligned> v = m1 * Vector<3, float, Qualifier::Aligned>(1.0f, 0.0f, -1.0f);
+    EXPECT_FLOAT_EQ(-2.0f, v.x());
+    EXPECT_FLOAT_EQ(-2.0f, v.y());
+}
+
+// The general 3x4, not the affine one (Affine3x4)
+TEST(MatrixTests, Multiply3x4)
+{
+    Matrix<3, 3, float> m1(1.0f, 2.0f, 3.0f,
+                           4.0f, 5.0f, 6.0f,
+                           7.0f, 8.0f, 9.0f);
+    Matrix<3, 4, float> m2(1.0f, 0.0f, 0.0f, 1.0f,
+                           0.0f, 1.0f, 0.0f, 2.0f,
+                           0.0f, 0.0f, 1.0f, 3.0f);
+    Matrix<3, 4, float> result = m1 * m2;
+
+    EXPECT_FLOAT_EQ(1.0f, result.Get(0, 0));
+    EXPECT_FLOAT_EQ(14.0f, result.Get(0, 3));
+    EXPECT_FLOAT_EQ(32.0f, result.Get(1, 3));
+    EXPECT_FLOAT_EQ(50.0f, result.Get(2, 3));
+    EXPECT_FLOAT_EQ(9.0f, result.Get(2, 2));
+
+    Matrix<4, 3, float> t = m2.Transpose();
+    EXPECT_FLOAT_EQ(3.0f, t.Get(3, 2));
+    Vector<3, float, Qualifier::Aligned> v = m2 * Vector<4, float, Qualifier::Aligned>(1.0f, 1.0f, 1.0f, 1.0f);
+    EXPECT_FLOAT_EQ(2.0f, v.x());
+    EXPECT_FLOAT_EQ(3.0f, v.y());
+    EXPECT_FLOAT_EQ(4.0f, v.z());
+}
+
+TEST(MatrixTests, MultiplyDouble)
+{
+    Matrix<4, 4, double> m1(1.0, 2.0, 3.0, 4.0,
+                            5.0, 6.0, 7.0, 8.0,
+                            9.0, 10.0, 11.0, 12.0,
+                            13.0, 14.0, 15.0, 16.0);
+    Matrix<4, 4, double> result = m1 * Matrix<4, 4, double>();
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+            EXPECT_DOUBLE_EQ(m1.Get(i, j), result.Get(i, j));
+    }
+}
+
+TEST(MatrixTests, Constexpr)
+{
+    constexpr Matrix<2, 3, int> m1(1, 2, 3,
+                                   4, 5, 6);
+    constexpr Matrix<3, 2, int> m2 = GenericMatrixFunctions<2, 3, int>::Transpose(m1);
+    constexpr Matrix<2, 2, int> result = GenericMatrixFunctions<2, 3, int>::Multiply(m1, m2);
+    static_assert(result.Get(0, 0) == 14);
+    static_assert(result.Get(1, 1) == 77);
+    EXPECT_EQ(32, result.Get(0, 1));
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/MatrixX.hpp"
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    template<typename T>
+    MatrixX<T> MakeMatrix(std::size_t rows, std::size_t columns, int seed)
+    {
+        MatrixX<T> result(rows, columns);
+        for (std::size_t j = 0; j < columns; ++j)
+        {
+            for (std::size_t i = 0; i < rows; ++i)
+                result.Get(i, j) = static_cast<T>(static_cast<int>((i * 7 + j * 13 + seed) % 17) - 8) / T(4);
+        }
+        return result;
+    }
+
+    template<typename T>
+    void ExpectNaiveProduct(const MatrixX<T>& left, const MatrixX<T>& right, const MatrixX<T>& result)
+    {
+        ASSERT_EQ(left.Rows(), result.Rows());
+        ASSERT_EQ(right.Columns(), result.Columns());
+        for (std::size_t i = 0; i < result.Rows(); ++i)
+        {
+            for (std::size_t j = 0; j < result.Columns(); ++j)
+            {
+                double expected = 0;
+                for (std::size_t k = 0; k < left.Columns(); ++k)
+                    expected += static_cast<double>(left.Get(i, k)) * static_cast<double>(right.Get(k, j));
+                // The inputs are multiples of 1/4, so every partial sum is exact
+                ASSERT_EQ(static_cast<T>(expected), result.Get(i, j)) << i << ", " << j;
+            }
+        }
+    }
+}
+
+TEST(MatrixXTests, Constructor)
+{
+    MatrixX<float> m(5, 3, 2.0f);
+    EXPECT_EQ(5u, m.Rows());
+    EXPECT_EQ(3u, m.Columns());
+    EXPECT_EQ(16u, m.Stride());
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(m.Column(1)) % 64);
+    EXPECT_FLOAT_EQ(2.0f, m.Get(4, 2));
+}
+
+TEST(MatrixXTests, MultiplySmall)
+{
+    MatrixX<float> left = MakeMatrix<float>(13, 7, 1);
+    MatrixX<float> right = MakeMatrix<float>(7, 9, 2);
+    ExpectNaiveProduct(left, right, left * right);
+}
+
+TEST(MatrixXTests, MultiplyAcrossBlocks)
+{
+    // Bigger than one cache block in every dimension, and not a multiple of the register block
+    MatrixX<float> left = MakeMatrix<float>(141, 301, 3);
+    MatrixX<float> right = MakeMatrix<float>(301, 67, 4);
+    ExpectNaiveProduct(left, right, MatrixXFunctions<float>::Multiply(left, right, 1));
+    ExpectNaiveProduct(left, right, MatrixXFunctions<float>::Multiply(left, right, 4));
+}
+
+TEST(MatrixXTests, MultiplyDouble)
+{
+    MatrixX<double> left = MakeMatrix<double>(70, 90, 5);
+    MatrixX<double> right = MakeMatrix<double>(90, 50, 6);
+    ExpectNaiveProduct(left, right, MatrixXFunctions<double>::Multiply(left, right, 3));
+}
+
+TEST(MatrixXTests, Transpose)
+{
+    MatrixX<float> m = MakeMatrix<float>(77, 45, 7);
+    MatrixX<float> t = m.Transpose();
+    ASSERT_EQ(45u, t.Rows());
+    ASSERT_EQ(77u, t.Columns());
+    for (std::size_t i = 0; i < m.Rows(); ++i)
+    {
+        for (std::size_t j = 0; j < m.Columns(); ++j)
+            EXPECT_EQ(m.Get(i, j), t.Get(j, i));
+    }
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Noise.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    template<std::size_t N>
+    std::vector<Vector<N, float, Qualifier::Packed>> MakePoints(std::size_t count, float scale)
+    {
+        std::vector<Vector<N, float, Qualifier::Packed>> points(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            for (std::size_t d = 0; d < N; ++d)
+                points[i][d] = std::sin(static_cast<float>(i * (d + 3) + d)) * scale;
+        }
+        return points;
+    }
+
+    template<std::size_t N>
+    void ExpectBatchMatchesScalar()
+    {
+        // Not a multiple of 4, so the padded last group is covered
+        auto points = MakePoints<N>(103, 20.0f);
+        std::vector<float> perlin(points.size()), simplex(points.size());
+        Perlin<N, Qualifier::Packed>(points, perlin, 17);
+        Simplex<N, Qualifier::Packed>(points, simplex, 17);
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            EXPECT_EQ(Perlin(points[i], 17), perlin[i]);
+            EXPECT_EQ(Simplex(points[i], 17), simplex[i]);
+            EXPECT_LE(std::abs(perlin[i]), 1.0f);
+            EXPECT_LE(std::abs(simplex[i]), 1.0f);
+        }
+    }
+}
+
+TEST(NoiseTests, BatchMatchesScalar)
+{
+    ExpectBatchMatchesScalar<2>();
+    ExpectBatchMatchesScalar<3>();
+    ExpectBatchMatchesScalar<4>();
+}
+
+TEST(NoiseTests, LatticePointsAreZero)
+{
+    // Perlin noise is zero on the integer lattice, where every gradient is dotted with a zero offset
+    EXPECT_EQ(0.0f, Perlin(Vector<2, float, Qualifier::Packed>(3.0f, -7.0f)));
+    EXPECT_EQ(0.0f, Perlin(Vector<3, float, Qualifier::Packed>(1.0f, 2.0f, -5.0f)));
+    EXPECT_EQ(0.0f, Perlin(Vector<4, float, Qualifier::Aligned>(0.0f, 4.0f, 8.0f, -1.0f)));
+}
+
+TEST(NoiseTests, ContinuousAndSeeded)
+{
+    const Vector<3, float, Qualifier::Packed> point(0.3f, 1.7f, -2.2f);
+    const Vector<3, float, Qualifier::Packed> nearby(0.3001f, 1.7f, -2.2f);
+    EXPECT_NEAR(Simplex(point), Simplex(nearby), 1e-3f);
+    EXPECT_NEAR(Perlin(point), Perlin(nearby), 1e-3f);
+    EXPECT_NE(Simplex(point, 1), Simplex(point, 2));
+
+    // Not degenerate, the noise actually varies
+    auto points = MakePoints<3>(256, 10.0f);
+    std::vector<float> values(points.size());
+    Simplex<3, Qualifier::Packed>(points, values);
+    float min = 1.0f, max = -1.0f;
+    for (float value : values)
+    {
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+    EXPECT_LT(min, -0.3f);
+    EXPECT_GT(max, 0.3f);
+}
+
+TEST(NoiseTests, Fbm)
+{
+    auto points = MakePoints<2>(37, 5.0f);
+    std::vector<float> single(points.size()), perlin(points.size()), fbm(points.size());
+
+    // One octave is the noise itself
+    Fbm<2, Qualifier::Packed>(NoiseType::Perlin, points, single, 1, 2.0f, 0.5f, 4);
+    Perlin<2, Qualifier::Packed>(points, perlin, 4);
+    for (std::size_t i = 0; i < points.size(); ++i)
+        EXPECT_FLOAT_EQ(perlin[i], single[i]);
+
+    Fbm<2, Qualifier::Packed>(NoiseType::Simplex, points, fbm, 6, 2.0f, 0.5f, 4);
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        float expected = 0.0f, amplitude = 1.0f, frequency = 1.0f;
+        for (std::uint32_t octave = 0; octave < 6; ++octave)
+        {
+            expected += amplitude * Simplex(Vector<2, float, Qualifier::Packed>(points[i].x() * frequency, points[i].y() * frequency), 4 + octave);
+            amplitude *= 0.5f;
+            frequency *= 2.0f;
+        }
+        EXPECT_NEAR(expected / 1.96875f, fbm[i], 1e-5f);
+        EXPECT_LE(std::abs(fbm[i]), 1.0f);
+    }
+}
@@ -0,0 +1,248 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Particle.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    template<typename T>
+    struct Streams
+    {
+        std::vector<T> x, y, z;
+
+        explicit Streams(std::size_t count, T value = T(0)) : x(count, value), y(count, value), z(count, value) {}
+
+        ParticleStream<T> Stream() { return { x, y, z }; }
+    };
+
+    // A width x height grid of particles, spacing 1 apart, with a constraint to the right and below neighbors of each
+    template<typename T>
+    std::vector<DistanceConstraint<T>> GridConstraints(std::uint32_t width, std::uint32_t height)
+    {
+        std::vector<DistanceConstraint<T>> constraints;
+        for (std::uint32_t row = 0; row < height; ++row)
+        {
+            for (std::uint32_t column = 0; column < width; ++column)
+            {
+                const std::uint32_t i = row * width + column;
+                if (column + 1 < width)
+                    constraints.push_back({ i, i + 1, T(1) });
+                if (row + 1 < height)
+                    constraints.push_back({ i, i + width, T(1) });
+            }
+        }
+        return constraints;
+    }
+
+    template<typename T>
+    T Length(const Streams<T>& positions, const DistanceConstraint<T>& constraint)
+    {
+        const T dx = positions.x[constraint.b] - positions.x[constraint.a];
+        const T dy = positions.y[constraint.b] - positions.y[constraint.a];
+        const T dz = positions.z[constraint.b] - positions.z[constraint.a];
+        return std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    template<typename T>
+    void ExpectIntegrators()
+    {
+        // 19 particles, so the SIMD kernels have a remainder. Every third one is pinned
+        const std::size_t count = 19;
+        IntegrationSettings<T> settings;
+        settings.timeStep = T(0.1);
+        settings.gravity = Vector<3, T, Qualifier::Packed>(T(0), T(-10), T(0));
+        settings.boundsMin = Vector<3, T, Qualifier::Packed>(T(-100), T(-1), T(-100));
+        std::vector<T> inverseMasses(count, T(0.5));
+        for (std::size_t i = 0; i < count; i += 3)
+            inverseMasses[i] = T(0);
+        Streams<T> forces(count);
+        for (std::size_t i = 0; i < count; ++i)
+            forces.x[i] = T(2);
+
+        Streams<T> positions(count), velocities(count);
+        Streams<T> verlet(count), previous(count);
+        for (std::size_t step = 0; step < 5; ++step)
+        {
+            IntegrateSemiImplicitEuler<T>(positions.Stream(), velocities.Stream(), forces.Stream(), inverseMasses, settings);
+            IntegrateVerlet<T>(verlet.Stream(), previous.Stream(), forces.Stream(), inverseMasses, settings);
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (inverseMasses[i] == T(0))
+            {
+                EXPECT_EQ(positions.x[i], T(0));
+                EXPECT_EQ(positions.y[i], T(0));
+                EXPECT_EQ(verlet.y[i], T(0));
+                continue;
+            }
+            // Constant acceleration of 1 along x: after n steps v = n dt, p = dt^2 n (n + 1) / 2 (semi-implicit Euler and Verlet from rest agree)
+            EXPECT_NEAR(velocities.x[i], T(0.5), T(1e-5));
+            EXPECT_NEAR(positions.x[i], T(0.15), T(1e-5));
+            EXPECT_NEAR(verlet.x[i], T(0.15), T(1e-5));
+            // Falling at 10, the floor at -1 is reached during step 4, the velocity into it is removed
+            EXPECT_EQ(positions.y[i], T(-1));
+            EXPECT_EQ(velocities.y[i], T(0));
+            EXPECT_EQ(verlet.y[i], T(-1));
+            EXPECT_EQ(positions.z[i], T(0));
+        }
+    }
+}
+
+TEST(ParticleTests, Integrators)
+{
+    ExpectIntegrators<float>();
+    ExpectIntegrators<double>();
+}
+
+TEST(ParticleTests, DampingAndAbsentStreams)
+{
+    // No forces and unit masses: only gravity and damping
+    const std::size_t count = 10;
+    IntegrationSettings<float> settings;
+    settings.timeStep = 0.5f;
+    settings.damping = 1.0f;
+    settings.gravity = Vector<3, float, Qualifier::Packed>(0.0f, 0.0f, 4.0f);
+    Streams<float> positions(count), velocities(count, 1.0f);
+    IntegrateSemiImplicitEuler<float>(positions.Stream(), velocities.Stream(), {}, {}, settings);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(velocities.x[i], 0.5f);
+        EXPECT_EQ(velocities.z[i], 1.5f);
+        EXPECT_EQ(positions.x[i], 0.25f);
+        EXPECT_EQ(positions.z[i], 0.75f);
+    }
+
+    // Verlet keeps the velocity implied by the previous positions, damped
+    Streams<float> current(count, 1.0f), previous(count, 0.0f);
+    settings.gravity = Vector<3, float, Qualifier::Packed>(0.0f, 0.0f, 0.0f);
+    IntegrateVerlet<float>(current.Stream(), previous.Stream(), {}, {}, settings);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(current.x[i], 1.5f);
+        EXPECT_EQ(previous.x[i], 1.0f);
+    }
+}
+
+TEST(ParticleTests, BatchesShareNoParticle)
+{
+    const auto constraints = GridConstraints<float>(37, 23);
+    const auto batches = BatchConstraints<float>(constraints, 37 * 23);
+    ASSERT_EQ(batches.constraints.size(), constraints.size());
+    // Every particle has at most 4 constraints, a greedy coloring needs at most 7 batches
+    EXPECT_LE(batches.BatchCount(), 7u);
+
+    for (std::size_t batch = 0; batch < batches.BatchCount(); ++batch)
+    {
+        std::vector<bool> used(37 * 23, false);
+        for (const auto& constraint : batches.Batch(batch))
+        {
+            EXPECT_FALSE(used[constraint.a]);
+            EXPECT_FALSE(used[constraint.b]);
+            used[constraint.a] = used[constraint.b] = true;
+        }
+    }
+
+    // Every constraint is in a batch once
+    const auto key = [](const DistanceConstraint<float>& constraint) { return std::uint64_t(constraint.a) << 32 | constraint.b; };
+    std::vector<std::uint64_t> expected, found;
+    for (const auto& constraint : constraints)
+        expected.push_back(key(constraint));
+    for (const auto& constraint : batches.constraints)
+        found.push_back(key(constraint));
+    std::sort(expected.begin(), expected.end());
+    std::sort(found.begin(), found.end());
+    EXPECT_EQ(found, expected);
+
+    // A star needs a batch per constraint, more than the 64 of a mask
+    std::vector<DistanceConstraint<float>> star;
+    for (std::uint32_t i = 1; i <= 100; ++i)
+        star.push_back({ 0, i, 1.0f });
+    EXPECT_EQ(BatchConstraints<float>(star, 101).BatchCount(), 100u);
+}
+
+TEST(ParticleTests, ProjectionConverges)
+{
+    // A perturbed cloth hanging from its two top corners (at their rest distance)
+    const std::uint32_t width = 30, height = 30;
+    const std::size_t count = width * height;
+    const auto constraints = GridConstraints<float>(width, height);
+    const auto batches = BatchConstraints<float>(constraints, count);
+    std::vector<float> inverseMasses(count, 1.0f);
+    inverseMasses[0] = inverseMasses[width - 1] = 0.0f;
+
+    Streams<float> positions(count);
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        const bool pinned = inverseMasses[i] == 0.0f;
+        positions.x[i] = static_cast<float>(i % width) + (pinned ? 0.0f : std::sin(static_cast<float>(i) * 1.7f) * 0.2f);
+        positions.y[i] = -static_cast<float>(i / width) + (pinned ? 0.0f : std::sin(static_cast<float>(i) * 2.3f) * 0.2f);
+        positions.z[i] = pinned ? 0.0f : std::sin(static_cast<float>(i) * 3.1f) * 0.2f;
+    }
+    Streams<float> parallel = positions;
+    const float pinnedX = positions.x[width - 1];
+
+    float before = 0.0f;
+    for (const auto& constraint : constraints)
+        before = std::max(before, std::abs(Length(positions, constraint) - 1.0f));
+    for (std::size_t iteration = 0; iteration < 100; ++iteration)
+    {
+        ProjectDistanceConstraints<float>(positions.Stream(), inverseMasses, batches, 1.0f);
+        ProjectDistanceConstraints<float>(parallel.Stream(), inverseMasses, batches, 1.0f, 4);
+    }
+    float after = 0.0f;
+    for (const auto& constraint : constraints)
+        after = std::max(after, std::abs(Length(positions, constraint) - 1.0f));
+    EXPECT_GT(before, 0.3f);
+    EXPECT_LT(after, 0.03f);
+    EXPECT_EQ(positions.x[width - 1], pinnedX);
+    EXPECT_EQ(positions.y[0], 0.0f);
+
+    // The constraints of a batch are independent, the threads don't change the result
+    EXPECT_EQ(positions.x, parallel.x);
+    EXPECT_EQ(positions.y, parallel.y);
+    EXPECT_EQ(positions.z, parallel.z);
+}
+
+TEST(ParticleTests, ProjectSingleConstraint)
+{
+    // Stiffness 1 satisfies a lone constraint in one projection, split by the inverse masses
+    Streams<double> positions(2);
+    positions.x[1] = 3.0;
+    const std::vector<double> inverseMasses = { 1.0, 3.0 };
+    const std::vector<DistanceConstraint<double>> constraints = { { 0, 1, 1.0 } };
+    ProjectDistanceConstraints<double>(positions.Stream(), inverseMasses, BatchConstraints<double>(constraints, 2), 1.0);
+    EXPECT_DOUBLE_EQ(positions.x[0], 0.5);
+    EXPECT_DOUBLE_EQ(positions.x[1], 1.5);
+}
+
+TEST(ParticleTests, ProjectionWithoutMasses)
+{
+    // No inverse masses is the same as unit masses, with a remainder after the groups of 4
+    const std::uint32_t width = 9, height = 7;
+    const std::size_t count = width * height;
+    const auto batches = BatchConstraints<float>(GridConstraints<float>(width, height), count);
+    Streams<float> positions(count);
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        positions.x[i] = static_cast<float>(i % width) * 1.2f;
+        positions.y[i] = -static_cast<float>(i / width) * 0.9f;
+        positions.z[i] = std::sin(static_cast<float>(i)) * 0.3f;
+    }
+    Streams<float> unit = positions;
+    const std::vector<float> ones(count, 1.0f);
+    for (std::size_t iteration = 0; iteration < 5; ++iteration)
+    {
+        ProjectDistanceConstraints<float>(positions.Stream(), {}, batches, 0.8f);
+        ProjectDistanceConstraints<float>(unit.Stream(), ones, batches, 0.8f);
+    }
+    EXPECT_EQ(positions.x, unit.x);
+    EXPECT_EQ(positions.y, unit.y);
+    EXPECT_EQ(positions.z, unit.z);
+}
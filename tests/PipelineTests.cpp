@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Pipeline.hpp"
+#include "PulsarionMath/Transform.hpp"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    const Matrix<4, 4, float> TestMatrix(0.5f, -1.0f, 2.0f, 10.0f,
+                                         1.5f, 0.25f, -0.5f, -4.0f,
+                                         -2.0f, 1.0f, 0.75f, 2.5f,
+                                         0.0f, 0.0f, 0.0f, 1.0f);
+
+    // The stages one at a time, each as its own pass
+    template<std::size_t N, Qualifier Q>
+    std::vector<Vector<N, float, Q>> Reference(const std::vector<Vector<N, float, Q>>& points, float low, float high)
+    {
+        std::vector<Vector<N, float, Q>> result(points.size());
+        TransformPoints<N, float, Q>(TestMatrix, points, result);
+        for (auto& point : result)
+        {
+            float lengthSquared = 0.0f;
+            for (std::size_t c = 0; c < N; ++c)
+                lengthSquared += point[c] * point[c];
+            for (std::size_t c = 0; c < N; ++c)
+                point[c] = lengthSquared > 0.0f ? point[c] / std::sqrt(lengthSquared) : 0.0f;
+        }
+        for (auto& point : result)
+            for (std::size_t c = 0; c < N; ++c)
+                point[c] = std::min(std::max(point[c] * 2.0f + 0.25f, low), high);
+        return result;
+    }
+
+    template<std::size_t N, Qualifier Q>
+    void ExpectMatchesReference()
+    {
+        std::mt19937 random(N * 2 + static_cast<unsigned>(Q));
+        std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+        for (std::size_t count : { 0u, 1u, 2u, 3u, 5u, 17u, 40000u })
+        {
+            std::vector<Vector<N, float, Q>> points(count);
+            for (auto& point : points)
+                for (std::size_t c = 0; c < N; ++c)
+                    point[c] = distribution(random);
+            if constexpr (N == 4)
+                for (auto& point : points)
+                    point.w() = 1.0f;
+
+            const auto expected = Reference<N, Q>(points, -1.0f, 1.5f);
+            std::vector<Vector<N, float, Q>> result(count);
+            for (std::size_t threadCount : { 1u, 4u })
+            {
+                Pipeline(points).Transform(TestMatrix).Normalize().Scale(2.0f).Add(Vector<N, float, Q>(0.25f)).Clamp(-1.0f, 1.5f).Into(result, threadCount);
+                for (std::size_t i = 0; i < count; ++i)
+                    for (std::size_t c = 0; c < N; ++c)
+                        ASSERT_NEAR(expected[i][c], result[i][c], 1e-5f) << count << " " << i << " " << c;
+            }
+
+            // In place gives the same result
+            Pipeline(points).Transform(TestMatrix).Normalize().Scale(2.0f).Add(Vector<N, float, Q>(0.25f)).Clamp(-1.0f, 1.5f).Into(points);
+            for (std::size_t i = 0; i < count; ++i)
+                for (std::size_t c = 0; c < N; ++c)
+                    ASSERT_EQ(result[i][c], points[i][c]);
+        }
+    }
+}
+
+TEST(PipelineTests, MatchesSeparatePasses)
+{
+    ExpectMatchesReference<4, Qualifier::Aligned>();
+    ExpectMatchesReference<4, Qualifier::Packed>();
+    ExpectMatchesReference<3, Qualifier::Aligned>();
+    ExpectMatchesReference<3, Qualifier::Packed>();
+}
+
+TEST(PipelineTests, EdgeCases)
+{
+    using Vec3 = Vector<3, float, Qualifier::Aligned>;
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const std::vector<Vec3> points = { Vec3(0.0f, 0.0f, 0.0f), Vec3(3.0f, 0.0f, 4.0f), Vec3(nan, 5.0f, -5.0f) };
+    std::vector<Vec3> result(points.size());
+    Pipeline(points).Normalize().Into(result);
+    EXPECT_EQ(result[0].x(), 0.0f);
+    EXPECT_EQ(result[0].z(), 0.0f);
+    EXPECT_FLOAT_EQ(result[1].x(), 0.6f);
+    EXPECT_FLOAT_EQ(result[1].z(), 0.8f);
+
+    Pipeline(points).Clamp(Vec3(-1.0f, -2.0f, -3.0f), Vec3(1.0f, 2.0f, 3.0f)).Into(result);
+    EXPECT_EQ(result[2].x(), -1.0f);
+    EXPECT_EQ(result[2].y(), 2.0f);
+    EXPECT_EQ(result[2].z(), -3.0f);
+    EXPECT_EQ(result[1].x(), 1.0f);
+    EXPECT_EQ(result[1].data.padding, 0.0f);
+
+    // Without stages Into copies
+    Pipeline(points).Into(result);
+    EXPECT_EQ(result[1].z(), 4.0f);
+
+    // Packed 3 component vectors: the one after the output is not written
+    using Vec3P = Vector<3, float, Qualifier::Packed>;
+    std::vector<Vec3P> packed = { Vec3P(1.0f, 2.0f, 3.0f), Vec3P(4.0f, 5.0f, 6.0f) };
+    Pipeline(std::span<const Vec3P>(packed).first(1)).Scale(10.0f).Into(std::span<Vec3P>(packed).first(1));
+    EXPECT_EQ(packed[0].z(), 30.0f);
+    EXPECT_EQ(packed[1].x(), 4.0f);
+}
+
+TEST(PipelineTests, OtherTypes)
+{
+    const Matrix<4, 4, double> translation(1.0, 0.0, 0.0, 1.0,
+                                           0.0, 1.0, 0.0, 2.0,
+                                           0.0, 0.0, 1.0, 3.0,
+                                           0.0, 0.0, 0.0, 1.0);
+    std::vector<Vector<3, double, Qualifier::Packed>> points = { { 1.0, 1.0, 1.0 }, { -1.0, 0.0, 0.5 } };
+    Pipeline(points).Transform(translation).Scale(2.0).Into(points);
+    EXPECT_EQ(4.0, points[0].x());
+    EXPECT_EQ(6.0, points[0].y());
+    EXPECT_EQ(8.0, points[0].z());
+    EXPECT_EQ(7.0, points[1].z());
+
+    using Vec4I = Vector<4, int, Qualifier::Aligned>;
+    const std::vector<Vec4I> integers = { Vec4I(1, -20, 3, 40) };
+    std::vector<Vec4I> clamped(1);
+    Pipeline(integers).Add(Vec4I(1)).Clamp(-5, 5).Into(clamped);
+    EXPECT_EQ(clamped[0].x(), 2);
+    EXPECT_EQ(clamped[0].y(), -5);
+    EXPECT_EQ(clamped[0].w(), 5);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/PointStream.hpp"
+#include "PulsarionMath/BinaryArray.hpp"
+#include "PulsarionMath/Reduce.hpp"
+
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    using Point = Vector<3, float, Qualifier::Packed>;
+
+    const Matrix<4, 4, float> Translation(1.0f, 0.0f, 0.0f, 100.0f,
+                                          0.0f, 1.0f, 0.0f, -50.0f,
+                                          0.0f, 0.0f, 1.0f, 0.0f,
+                                          0.0f, 0.0f, 0.0f, 1.0f);
+
+    std::vector<Point> MakePoints(std::size_t count)
+    {
+        std::vector<Point> points(count);
+        for (std::size_t i = 0; i < count; ++i)
+            points[i] = Point(static_cast<float>(i), static_cast<float>(i % 7), -static_cast<float>(i % 13));
+        return points;
+    }
+}
+
+TEST(PointStreamTests, TransformsEveryChunk)
+{
+    const auto points = MakePoints(10007);
+    for (std::size_t chunkSize : { 1u, 64u, 1000u, 10007u, 20000u })
+    {
+        SpanPointSource<3, float, Qualifier::Packed> source(points);
+        std::vector<Point> output;
+        const PointStreamStats stats = StreamTransform<3, float, Qualifier::Packed>(Translation, source, [&output](std::span<const Point> chunk) {
+            output.insert(output.end(), chunk.begin(), chunk.end());
+        }, KeepAllPoints{}, chunkSize);
+
+        EXPECT_EQ(points.size(), stats.pointsRead);
+        EXPECT_EQ(points.size(), stats.pointsWritten);
+        EXPECT_EQ((points.size() + chunkSize - 1) / chunkSize, stats.chunks);
+        EXPECT_GE(stats.PointsPerSecond(), 0.0);
+        ASSERT_EQ(points.size(), output.size());
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            ASSERT_EQ(points[i].x() + 100.0f, output[i].x());
+            ASSERT_EQ(points[i].y() - 50.0f, output[i].y());
+            ASSERT_EQ(points[i].z(), output[i].z());
+        }
+    }
+}
+
+TEST(PointStreamTests, FilterAndReduce)
+{
+    const auto points = MakePoints(5000);
+    SpanPointSource<3, float, Qualifier::Packed> source(points);
+    // Bounds of the kept points, reduced chunk by chunk
+    float min[3] = { 1e30f, 1e30f, 1e30f }, max[3] = { -1e30f, -1e30f, -1e30f };
+    std::size_t received = 0;
+    const PointStreamStats stats = StreamTransform<3, float, Qualifier::Packed>(Translation, source, [&](std::span<const Point> chunk) {
+        received += chunk.size();
+        ReduceFunctions<3, float, Qualifier::Packed>::MinMax(chunk, min, max);
+    }, [](const Point& point) { return point.y() > -50.0f; }, 333);
+
+    // y is i % 7 - 50, so one in seven points is dropped
+    std::size_t expected = 0;
+    for (const Point& point : points)
+        expected += point.y() > 0.0f;
+    EXPECT_EQ(points.size(), stats.pointsRead);
+    EXPECT_EQ(expected, stats.pointsWritten);
+    EXPECT_EQ(expected, received);
+    EXPECT_EQ(101.0f, min[0]);
+    EXPECT_EQ(5099.0f, max[0]);
+    EXPECT_EQ(-49.0f, min[1]);
+    EXPECT_EQ(-44.0f, max[1]);
+}
+
+TEST(PointStreamTests, FileToFile)
+{
+    const auto input = std::filesystem::temp_directory_path() / "PulsarionMathStreamIn.bin";
+    const auto output = std::filesystem::temp_directory_path() / "PulsarionMathStreamOut.bin";
+    const auto points = MakePoints(4321);
+    ASSERT_EQ(BinaryArrayStatus::Ok, WriteBinaryArray<Point>(input, points));
+
+    {
+        FilePointSource<3, float, Qualifier::Packed> source(input, sizeof(BinaryArrayHeader));
+        ASSERT_TRUE(source.IsOpen());
+        FilePointSink<3, float, Qualifier::Packed> sink(output);
+        const PointStreamStats stats = StreamTransform<3, float, Qualifier::Packed>(Translation, source, sink, KeepAllPoints{}, 1000);
+        EXPECT_EQ(points.size(), stats.pointsRead);
+        EXPECT_FALSE(source.Failed());
+        EXPECT_FALSE(sink.Failed());
+    }
+
+    ASSERT_EQ(points.size() * sizeof(Point), std::filesystem::file_size(output));
+    FilePointSource<3, float, Qualifier::Packed> result(output);
+    std::vector<Point> transformed(points.size() + 1);
+    ASSERT_EQ(points.size(), result.Read(transformed));
+    for (std::size_t i = 0; i < points.size(); ++i)
+        ASSERT_EQ(points[i].x() + 100.0f, transformed[i].x());
+
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+}
+
+TEST(PointStreamTests, SinkExceptionStopsTheReader)
+{
+    const auto points = MakePoints(10000);
+    SpanPointSource<3, float, Qualifier::Packed> source(points);
+    std::size_t calls = 0;
+    EXPECT_THROW((StreamTransform<3, float, Qualifier::Packed>(Translation, source, [&calls](std::span<const Point>) {
+        if (++calls == 3)
+            throw std::runtime_error("Disk full");
+    }, KeepAllPoints{}, 100)), std::runtime_error);
+    EXPECT_EQ(3u, calls);
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Random.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+TEST(RandomTests, ReferenceSequence)
+{
+    // xoshiro128+ seeded with SplitMix64(42), lane i jumped i * 2^64 steps
+    Random<4> random(42);
+    std::uint32_t values[4];
+    random.Next(values);
+    EXPECT_EQ(0x58db51c8u, values[0]);
+    EXPECT_EQ(0x62c17b34u, values[1]);
+    EXPECT_EQ(0x7478d4a4u, values[2]);
+    EXPECT_EQ(0x13929fc2u, values[3]);
+    random.Next(values);
+    EXPECT_EQ(0x815c6c29u, values[0]);
+    EXPECT_EQ(0xb2687ef5u, values[1]);
+    EXPECT_EQ(0xd554f701u, values[2]);
+    EXPECT_EQ(0xdf2b55ceu, values[3]);
+}
+
+TEST(RandomTests, EightLanesExtendFour)
+{
+    Random<4> four(7);
+    Random<8> eight(7);
+    for (int i = 0; i < 10; ++i)
+    {
+        std::uint32_t a[4], b[8];
+        four.Next(a);
+        eight.Next(b);
+        for (std::size_t j = 0; j < 4; ++j)
+            EXPECT_EQ(a[j], b[j]);
+    }
+}
+
+TEST(RandomTests, Streams)
+{
+    Random<4> jumped(3);
+    jumped.Jump();
+    jumped.Jump();
+    Random<4> stream = Random<4>::ForStream(3, 2);
+    Random<4> other = Random<4>::ForStream(3, 1);
+
+    std::uint32_t a[4], b[4], c[4];
+    jumped.Next(a);
+    stream.Next(b);
+    other.Next(c);
+    for (std::size_t j = 0; j < 4; ++j)
+    {
+        EXPECT_EQ(a[j], b[j]);
+        EXPECT_NE(a[j], c[j]);
+    }
+}
+
+TEST(RandomTests, Uniform)
+{
+    Random<8> random(11);
+    std::vector<float> values(10001);
+    random.FillUniform(values, -2.0f, 6.0f);
+
+    double sum = 0;
+    for (float value : values)
+    {
+        ASSERT_GE(value, -2.0f);
+        ASSERT_LT(value, 6.0f);
+        sum += value;
+    }
+    EXPECT_NEAR(2.0, sum / values.size(), 0.1);
+
+    std::vector<Vector<3, float, Qualifier::Packed>> vectors(333);
+    random.FillUniform<3, Qualifier::Packed>(vectors, 1.0f, 2.0f);
+    for (const auto& vector : vectors)
+    {
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+            EXPECT_GE(vector[c], 1.0f);
+            EXPECT_LT(vector[c], 2.0f);
+        }
+    }
+}
+
+TEST(RandomTests, Samples)
+{
+    Random<4> random(5);
+    std::vector<Vector<4, float, Qualifier::Aligned>> sphere(1001), hemisphere(1001), cosine(1001), disc(1001);
+    random.FillUnitSphere<4, Qualifier::Aligned>(sphere);
+    random.FillHemisphere<4, Qualifier::Aligned>(hemisphere);
+    random.FillCosineHemisphere<4, Qualifier::Aligned>(cosine);
+    random.FillDisc<4, Qualifier::Aligned>(disc);
+
+    float meanZ = 0, meanCosineZ = 0;
+    for (std::size_t i = 0; i < sphere.size(); ++i)
+    {
+        EXPECT_NEAR(1.0f, sphere[i].LengthSquared(), 1e-5f);
+        EXPECT_EQ(0.0f, sphere[i].w());
+        EXPECT_NEAR(1.0f, hemisphere[i].LengthSquared(), 1e-5f);
+        EXPECT_GT(hemisphere[i].z(), 0.0f);
+        EXPECT_NEAR(1.0f, cosine[i].LengthSquared(), 1e-5f);
+        EXPECT_GE(cosine[i].z(), 0.0f);
+        EXPECT_LE(disc[i].LengthSquared(), 1.0f + 1e-6f);
+        EXPECT_EQ(0.0f, disc[i].z());
+        meanZ += sphere[i].z();
+        meanCosineZ += cosine[i].z();
+    }
+    EXPECT_NEAR(0.0f, meanZ / sphere.size(), 0.1f);
+    // E[cos(theta)] of a cosine weighted hemisphere is 2 / 3
+    EXPECT_NEAR(2.0f / 3.0f, meanCosineZ / cosine.size(), 0.05f);
+
+    // Structure of arrays output is the same sequence
+    Random<4> first(9), second(9);
+    std::vector<float> x(13), y(13), z(13);
+    std::vector<Vector<3, float, Qualifier::Packed>> vectors(13);
+    first.FillUnitSphere(x, y, z);
+    second.FillUnitSphere<3, Qualifier::Packed>(vectors);
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        EXPECT_EQ(x[i], vectors[i].x());
+        EXPECT_EQ(y[i], vectors[i].y());
+        EXPECT_EQ(z[i], vectors[i].z());
+    }
+}
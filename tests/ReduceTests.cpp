@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Reduce.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    template<std::size_t N, typename T, Qualifier Q>
+    std::vector<Vector<N, T, Q>> MakePoints(std::size_t count, T offset = T(0))
+    {
+        std::vector<Vector<N, T, Q>> points(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            for (std::size_t d = 0; d < N; ++d)
+                points[i][d] = offset + static_cast<T>(std::sin(static_cast<double>(i * (d + 2) + d)) * 10.0 + static_cast<double>(d));
+        }
+        return points;
+    }
+
+    // Every reduction against a double precision reference, for sizes that leave every kind of tail
+    template<std::size_t N, typename T, Qualifier Q>
+    void ExpectMatchesReference(T tolerance)
+    {
+        for (std::size_t count : { 0u, 1u, 3u, 7u, 8u, 13u, 4097u, 10001u })
+        {
+            const auto points = MakePoints<N, T, Q>(count);
+            double sum[N] = {}, min[N], max[N];
+            std::fill(std::begin(min), std::end(min), std::numeric_limits<double>::infinity());
+            std::fill(std::begin(max), std::end(max), -std::numeric_limits<double>::infinity());
+            for (const auto& point : points)
+            {
+                for (std::size_t d = 0; d < N; ++d)
+                {
+                    sum[d] += static_cast<double>(point[d]);
+                    min[d] = std::min(min[d], static_cast<double>(point[d]));
+                    max[d] = std::max(max[d], static_cast<double>(point[d]));
+                }
+            }
+
+            const Vector<N, T, Q> total = Sum<N, T, Q>(points);
+            const Vector<N, T, Q> mean = Mean<N, T, Q>(points);
+            const Bounds<N, T, Q> bounds = ComputeBounds<N, T, Q>(points);
+            EXPECT_EQ(count == 0, bounds.IsEmpty());
+            for (std::size_t d = 0; d < N; ++d)
+            {
+                EXPECT_NEAR(sum[d], total[d], tolerance * static_cast<double>(count)) << count;
+                EXPECT_NEAR(count == 0 ? 0.0 : sum[d] / static_cast<double>(count), mean[d], tolerance) << count;
+                EXPECT_EQ(static_cast<T>(min[d]), bounds.min[d]) << count;
+                EXPECT_EQ(static_cast<T>(max[d]), bounds.max[d]) << count;
+            }
+
+            if constexpr (N >= 3)
+            {
+                const Matrix<3, 3, T> covariance = Covariance<N, T, Q>(points);
+                for (std::size_t i = 0; i < 3; ++i)
+                {
+                    for (std::size_t j = 0; j < 3; ++j)
+                    {
+                        double expected = 0.0;
+                        for (const auto& point : points)
+                            expected += (point[i] - sum[i] / static_cast<double>(count)) * (point[j] - sum[j] / static_cast<double>(count));
+                        expected = count == 0 ? 0.0 : expected / static_cast<double>(count);
+                        EXPECT_NEAR(expected, covariance.Get(i, j), tolerance * 100.0) << count << " " << i << j;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(ReduceTests, MatchesReference)
+{
+    ExpectMatchesReference<4, float, Qualifier::Aligned>(1e-5f);
+    ExpectMatchesReference<4, float, Qualifier::Packed>(1e-5f);
+    ExpectMatchesReference<3, float, Qualifier::Aligned>(1e-5f);
+    ExpectMatchesReference<3, float, Qualifier::Packed>(1e-5f);
+    ExpectMatchesReference<3, double, Qualifier::Packed>(1e-12);
+    ExpectMatchesReference<2, float, Qualifier::Packed>(1e-5f);
+}
+
+// Four accumulators (point i goes to i % 4, the tail to the first) added as (0 + 1) + (2 + 3), the same bits with or without SIMD
+TEST(ReduceTests, SumOrder)
+{
+    const auto points = MakePoints<4, float, Qualifier::Aligned>(1003, 1000.0f);
+    float total[4][4] = {};
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        for (std::size_t d = 0; d < 4; ++d)
+            total[i < 1000 ? i % 4 : 0][d] += points[i][d];
+    }
+    const auto sum = Sum<4, float, Qualifier::Aligned>(points);
+    for (std::size_t d = 0; d < 4; ++d)
+        EXPECT_EQ((total[0][d] + total[1][d]) + (total[2][d] + total[3][d]), sum[d]) << d;
+}
+
+TEST(ReduceTests, Integers)
+{
+    const std::vector<Vector<2, int, Qualifier::Packed>> points = { { 3, -4 }, { -7, 10 }, { 5, 2 }, { 0, 0 }, { 1, 1 } };
+    const auto sum = Sum<2, int, Qualifier::Packed>(points);
+    EXPECT_EQ(2, sum.x());
+    EXPECT_EQ(9, sum.y());
+    const auto bounds = ComputeBounds<2, int, Qualifier::Packed>(points);
+    EXPECT_EQ(-7, bounds.min.x());
+    EXPECT_EQ(-4, bounds.min.y());
+    EXPECT_EQ(5, bounds.max.x());
+    EXPECT_EQ(10, bounds.max.y());
+}
+
+TEST(ReduceTests, BoundsSkipNaN)
+{
+    constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+    std::vector<Vector<3, float, Qualifier::Packed>> points = MakePoints<3, float, Qualifier::Packed>(11);
+    points[0] = Vector<3, float, Qualifier::Packed>(NaN, 100.0f, NaN);
+    points[6] = Vector<3, float, Qualifier::Packed>(-100.0f, NaN, NaN);
+    points[10] = Vector<3, float, Qualifier::Packed>(NaN, NaN, 50.0f);
+    const auto bounds = ComputeBounds<3, float, Qualifier::Packed>(points);
+    EXPECT_EQ(-100.0f, bounds.min.x());
+    EXPECT_EQ(100.0f, bounds.max.y());
+    EXPECT_EQ(50.0f, bounds.max.z());
+    EXPECT_FALSE(std::isnan(bounds.min.y()));
+    EXPECT_FALSE(std::isnan(bounds.min.z()));
+}
+
+TEST(ReduceTests, CovarianceFarFromOrigin)
+{
+    // A thin cloud around (1e4, -1e4, 5e3), which the one pass formula would lose to cancellation
+    std::vector<Vector<4, float, Qualifier::Aligned>> points;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const float t = static_cast<float>(i % 10) - 4.5f;
+        points.emplace_back(1e4f + t, -1e4f + 2.0f * t, 5e3f, 1.0f);
+    }
+    const Matrix<3, 3, float> covariance = Covariance<4, float, Qualifier::Aligned>(points);
+    EXPECT_NEAR(8.25f, covariance.Get(0, 0), 1e-3f);
+    EXPECT_NEAR(16.5f, covariance.Get(0, 1), 1e-3f);
+    EXPECT_NEAR(16.5f, covariance.Get(1, 0), 1e-3f);
+    EXPECT_NEAR(33.0f, covariance.Get(1, 1), 1e-3f);
+    EXPECT_EQ(0.0f, covariance.Get(2, 2));
+    EXPECT_EQ(0.0f, covariance.Get(0, 2));
+}
+
+TEST(ReduceTests, ParallelMatchesSingleThreaded)
+{
+    const auto points = MakePoints<3, float, Qualifier::Packed>(300001, 1000.0f);
+    const auto sum = Sum<3, float, Qualifier::Packed>(points);
+    const auto parallelSum = ParallelSum<3, float, Qualifier::Packed>(points, 4);
+    const auto bounds = ComputeBounds<3, float, Qualifier::Packed>(points);
+    const auto parallelBounds = ParallelBounds<3, float, Qualifier::Packed>(points, 4);
+    const auto covariance = Covariance<3, float, Qualifier::Packed>(points);
+    const auto parallelCovariance = ParallelCovariance<3, float, Qualifier::Packed>(points, 4);
+    for (std::size_t d = 0; d < 3; ++d)
+    {
+        EXPECT_NEAR(sum[d], parallelSum[d], std::abs(sum[d]) * 1e-6f);
+        EXPECT_EQ(bounds.min[d], parallelBounds.min[d]);
+        EXPECT_EQ(bounds.max[d], parallelBounds.max[d]);
+        for (std::size_t j = 0; j < 3; ++j)
+            EXPECT_NEAR(covariance.Get(d, j), parallelCovariance.Get(d, j), 1e-3f);
+    }
+
+    // The same thread count gives the same result every time
+    const auto again = ParallelSum<3, float, Qualifier::Packed>(points, 4);
+    for (std::size_t d = 0; d < 3; ++d)
+        EXPECT_EQ(parallelSum[d], again[d]);
+}
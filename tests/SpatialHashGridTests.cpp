@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/SpatialHashGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    template<std::size_t N, typename T, Qualifier Q>
+    std::vector<Vector<N, T, Q>> MakeParticles(std::size_t count, T extent)
+    {
+        std::vector<Vector<N, T, Q>> particles(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            particles[i][0] = static_cast<T>(std::sin(static_cast<double>(i) * 1.7 + 0.3)) * extent;
+            particles[i][1] = static_cast<T>(std::sin(static_cast<double>(i) * 2.3 + 1.1)) * extent;
+            particles[i][2] = static_cast<T>(std::sin(static_cast<double>(i) * 3.1 + 2.9)) * extent;
+        }
+        return particles;
+    }
+
+    template<std::size_t N, typename T, Qualifier Q>
+    std::vector<std::uint32_t> BruteForce(const std::vector<Vector<N, T, Q>>& particles, const Vector<N, T, Q>& center, T radius)
+    {
+        std::vector<std::uint32_t> result;
+        for (std::size_t i = 0; i < particles.size(); ++i)
+        {
+            const T dx = particles[i][0] - center[0], dy = particles[i][1] - center[1], dz = particles[i][2] - center[2];
+            if (dx * dx + dy * dy + dz * dz <= radius * radius)
+                result.push_back(static_cast<std::uint32_t>(i));
+        }
+        return result;
+    }
+
+    template<std::size_t N, typename T, Qualifier Q>
+    void ExpectMatchesBruteForce(T cellSize)
+    {
+        const auto particles = MakeParticles<N, T, Q>(5000, T(10));
+        SpatialHashGrid<N, T, Q> grid(cellSize);
+        grid.Build(particles);
+        ASSERT_EQ(grid.Size(), particles.size());
+
+        const T radii[] = { T(0.25), T(1), T(2.5) };
+        for (std::size_t query = 0; query < 50; ++query)
+        {
+            const T radius = radii[query % 3];
+            const Vector<N, T, Q>& center = particles[query * 97];
+            std::vector<std::uint32_t> found;
+            const std::size_t count = grid.QueryRadius(center, radius, found);
+            EXPECT_EQ(count, found.size());
+            std::sort(found.begin(), found.end());
+            EXPECT_EQ(found, BruteForce(particles, center, radius));
+        }
+    }
+}
+
+TEST(SpatialHashGridTests, MatchesBruteForce)
+{
+    ExpectMatchesBruteForce<3, float, Qualifier::Packed>(1.0f);
+    ExpectMatchesBruteForce<4, float, Qualifier::Aligned>(1.0f);
+    ExpectMatchesBruteForce<3, double, Qualifier::Aligned>(1.0);
+    // Radii much bigger and smaller than the cells
+    ExpectMatchesBruteForce<3, float, Qualifier::Packed>(0.3f);
+    ExpectMatchesBruteForce<3, float, Qualifier::Packed>(4.0f);
+}
+
+TEST(SpatialHashGridTests, QueryReportsDistances)
+{
+    using Vector3f = Vector<3, float, Qualifier::Packed>;
+    const std::vector<Vector3f> particles = { Vector3f(0.0f, 0.0f, 0.0f), Vector3f(1.0f, 0.0f, 0.0f), Vector3f(0.0f, 2.0f, 0.0f), Vector3f(0.0f, 0.0f, -3.0f) };
+    SpatialHashGrid<3, float, Qualifier::Packed> grid(1.0f);
+    grid.Build(particles);
+
+    std::vector<std::pair<std::uint32_t, float>> hits;
+    grid.QueryRadius(Vector3f(0.0f, 0.0f, 0.0f), 2.0f, [&hits](std::uint32_t index, float distanceSquared) { hits.emplace_back(index, distanceSquared); });
+    std::sort(hits.begin(), hits.end());
+    ASSERT_EQ(hits.size(), 3u);
+    EXPECT_EQ(hits[0], std::make_pair(0u, 0.0f));
+    EXPECT_EQ(hits[1], std::make_pair(1u, 1.0f));
+    EXPECT_EQ(hits[2], std::make_pair(2u, 4.0f));
+}
+
+// A table of 8 buckets, so most cells of a query share a bucket with others: small queries (sorted buckets) and big ones
+// (every cell searched) must still report each particle once
+TEST(SpatialHashGridTests, SharedBuckets)
+{
+    const auto particles = MakeParticles<3, float, Qualifier::Packed>(8, 3.0f);
+    SpatialHashGrid<3, float, Qualifier::Packed> grid(1.0f);
+    grid.Build(particles);
+    ASSERT_EQ(grid.BucketCount(), 8u);
+    for (const float radius : { 0.5f, 1.5f, 6.0f, 20.0f })
+    {
+        std::vector<std::uint32_t> found;
+        grid.QueryRadius(particles[3], radius, found);
+        std::sort(found.begin(), found.end());
+        EXPECT_EQ(found, BruteForce(particles, particles[3], radius)) << radius;
+    }
+}
+
+TEST(SpatialHashGridTests, ParallelBuildIsDeterministic)
+{
+    const auto particles = MakeParticles<3, float, Qualifier::Packed>(100000, 50.0f);
+    SpatialHashGrid<3, float, Qualifier::Packed> serial(1.0f);
+    SpatialHashGrid<3, float, Qualifier::Packed> parallel(1.0f);
+    serial.Build(particles, 1);
+    parallel.Build(particles, 4);
+
+    const auto serialIndices = serial.SortedIndices();
+    const auto parallelIndices = parallel.SortedIndices();
+    ASSERT_EQ(serialIndices.size(), particles.size());
+    EXPECT_TRUE(std::equal(serialIndices.begin(), serialIndices.end(), parallelIndices.begin(), parallelIndices.end()));
+
+    // Every particle appears once
+    std::vector<std::uint32_t> sorted(serialIndices.begin(), serialIndices.end());
+    std::sort(sorted.begin(), sorted.end());
+    for (std::size_t i = 0; i < sorted.size(); ++i)
+        ASSERT_EQ(sorted[i], i);
+}
+
+TEST(SpatialHashGridTests, RebuildAndEmpty)
+{
+    using Vector3f = Vector<3, float, Qualifier::Packed>;
+    SpatialHashGrid<3, float, Qualifier::Packed> grid(1.0f);
+    std::vector<std::uint32_t> found;
+    EXPECT_EQ(grid.QueryRadius(Vector3f(0.0f, 0.0f, 0.0f), 1.0f, found), 0u);
+
+    const auto particles = MakeParticles<3, float, Qualifier::Packed>(1000, 5.0f);
+    grid.Build(particles);
+    EXPECT_GT(grid.QueryRadius(particles[0], 1.0f, found), 0u);
+
+    grid.Build(std::span<const Vector3f>());
+    EXPECT_EQ(grid.Size(), 0u);
+    found.clear();
+    EXPECT_EQ(grid.QueryRadius(particles[0], 1.0f, found), 0u);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Swizzle.hpp"
+
+#include <utility>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    using Vec4 = Vector<4, float, Qualifier::Aligned>;
+    using Vec4P = Vector<4, float, Qualifier::Packed>;
+    using Vec3 = Vector<3, float, Qualifier::Aligned>;
+    using Vec3P = Vector<3, float, Qualifier::Packed>;
+    using Vec4I = Vector<4, int, Qualifier::Packed>;
+
+    template<std::size_t... I, std::size_t N, Qualifier Q>
+    void ExpectSwizzle(const Vector<N, float, Q>& vector)
+    {
+        const auto result = Swizzle<I...>(vector);
+        constexpr std::size_t indices[] = { I... };
+        for (std::size_t i = 0; i < sizeof...(I); ++i)
+        {
+            ASSERT_EQ(result[i], vector[indices[i]]) << "component " << i;
+        }
+        if constexpr (sizeof...(I) == 3 && Q == Qualifier::Aligned)
+        {
+            ASSERT_EQ(result.data.padding, 0.0f);
+        }
+    }
+
+    // Every combination of M indices below N, the combination number written in base N
+    template<std::size_t M, std::size_t N, Qualifier Q, std::size_t... C>
+    void ExpectAllSwizzles(const Vector<N, float, Q>& vector, std::index_sequence<C...>)
+    {
+        if constexpr (M == 4)
+            (ExpectSwizzle<C % N, C / N % N, C / (N * N) % N, C / (N * N * N)>(vector), ...);
+        else if constexpr (M == 3)
+            (ExpectSwizzle<C % N, C / N % N, C / (N * N)>(vector), ...);
+        else
+            (ExpectSwizzle<C % N, C / N>(vector), ...);
+    }
+
+    template<std::size_t M, std::size_t N, Qualifier Q>
+    void ExpectAllSwizzles(const Vector<N, float, Q>& vector)
+    {
+        constexpr std::size_t count = M == 4 ? N * N * N * N : M == 3 ? N * N * N : N * N;
+        ExpectAllSwizzles<M>(vector, std::make_index_sequence<count>());
+    }
+}
+
+TEST(SwizzleTests, AllCombinations)
+{
+    const Vec4 aligned(1.0f, -2.0f, 3.5f, 4.25f);
+    const Vec4P packed(1.0f, -2.0f, 3.5f, 4.25f);
+    const Vec3 aligned3(5.0f, 6.5f, -7.0f);
+    const Vec3P packed3(5.0f, 6.5f, -7.0f);
+
+    ExpectAllSwizzles<4>(aligned);
+    ExpectAllSwizzles<3>(aligned);
+    ExpectAllSwizzles<2>(aligned);
+    ExpectAllSwizzles<4>(packed);
+    ExpectAllSwizzles<3>(packed);
+    ExpectAllSwizzles<4>(aligned3);
+    ExpectAllSwizzles<3>(aligned3);
+    ExpectAllSwizzles<2>(aligned3);
+    ExpectAllSwizzles<4>(packed3);
+    ExpectAllSwizzles<3>(packed3);
+}
+
+TEST(SwizzleTests, PackedStoresStayInBounds)
+{
+    // The component after a packed 3 component result must not be written
+    struct
+    {
+        Vec3P vector;
+        float after;
+    } result = { Vec3P(0.0f, 0.0f, 0.0f), 42.0f };
+    result.vector = ZYX(Vec3P(1.0f, 2.0f, 3.0f));
+    EXPECT_EQ(result.vector.x(), 3.0f);
+    EXPECT_EQ(result.vector.y(), 2.0f);
+    EXPECT_EQ(result.vector.z(), 1.0f);
+    EXPECT_EQ(result.after, 42.0f);
+}
+
+TEST(SwizzleTests, NamedSwizzles)
+{
+    const Vec4 v(1.0f, 2.0f, 3.0f, 4.0f);
+    EXPECT_TRUE(XXXX(v) == Vec4(1.0f));
+    EXPECT_TRUE(WWWW(v) == Vec4(4.0f));
+    EXPECT_TRUE(Broadcast<2>(v) == ZZZZ(v));
+    EXPECT_TRUE(ZYXW(v) == Vec4(3.0f, 2.0f, 1.0f, 4.0f));
+    EXPECT_TRUE(WZYX(v) == Vec4(4.0f, 3.0f, 2.0f, 1.0f));
+    EXPECT_TRUE(XXYY(v) == Vec4(1.0f, 1.0f, 2.0f, 2.0f));
+    EXPECT_TRUE(ZWZW(v) == Vec4(3.0f, 4.0f, 3.0f, 4.0f));
+    EXPECT_TRUE(YZXW(v) == Vec4(2.0f, 3.0f, 1.0f, 4.0f));
+    EXPECT_TRUE(ZXYW(v) == Vec4(3.0f, 1.0f, 2.0f, 4.0f));
+
+    const Vector<3, float, Qualifier::Aligned> xyz = XYZ(v);
+    EXPECT_EQ(xyz.x(), 1.0f);
+    EXPECT_EQ(xyz.z(), 3.0f);
+    const auto xy = XY(v);
+    EXPECT_EQ(xy.y(), 2.0f);
+
+    // a x b = a.yzx * b.zxy - a.zxy * b.yzx
+    const Vec4 a(1.0f, 0.0f, 0.0f, 0.0f);
+    const Vec4 b(0.0f, 1.0f, 0.0f, 0.0f);
+    EXPECT_TRUE(YZXW(a) * ZXYW(b) - ZXYW(a) * YZXW(b) == Vec4(0.0f, 0.0f, 1.0f, 0.0f));
+}
+
+TEST(SwizzleTests, ConstantEvaluation)
+{
+    constexpr Vec4I integers(1, 2, 3, 4);
+    static_assert(Swizzle<3, 3, 0>(integers)[0] == 4);
+    static_assert(Swizzle<3, 3, 0>(integers)[2] == 1);
+
+    constexpr Vec4 floats(1.0f, 2.0f, 3.0f, 4.0f);
+    static_assert(WZYX(floats)[0] == 4.0f);
+    static_assert(Broadcast<1>(floats)[3] == 2.0f);
+    const auto yx = Swizzle<1, 0>(integers);
+    EXPECT_EQ(yx.x(), 2);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/SymmetricEigen.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    template<typename T>
+    std::vector<Matrix<3, 3, T>> MakeSymmetricMatrices(std::size_t count)
+    {
+        std::vector<Matrix<3, 3, T>> matrices;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            T values[6];
+            for (std::size_t k = 0; k < 6; ++k)
+                values[k] = static_cast<T>(std::sin(static_cast<double>(i * 7 + k * 3 + 1)) * 5.0);
+            matrices.emplace_back(values[0], values[1], values[2],
+                                  values[1], values[3], values[4],
+                                  values[2], values[4], values[5]);
+        }
+        return matrices;
+    }
+
+    // A * v = value * v for every pair, the vectors are orthonormal and the values sorted
+    template<typename T>
+    void ExpectDecomposes(const Matrix<3, 3, T>& matrix, const EigenDecomposition<T>& result, T tolerance)
+    {
+        EXPECT_GE(result.values[0], result.values[1]);
+        EXPECT_GE(result.values[1], result.values[2]);
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            for (std::size_t row = 0; row < 3; ++row)
+            {
+                T product = T(0);
+                for (std::size_t k = 0; k < 3; ++k)
+                    product += matrix.Get(row, k) * result.vectors.Get(k, i);
+                EXPECT_NEAR(result.values[i] * result.vectors.Get(row, i), product, tolerance) << i << " " << row;
+            }
+            for (std::size_t j = 0; j < 3; ++j)
+            {
+                T dot = T(0);
+                for (std::size_t k = 0; k < 3; ++k)
+                    dot += result.vectors.Get(k, i) * result.vectors.Get(k, j);
+                EXPECT_NEAR(i == j ? T(1) : T(0), dot, tolerance) << i << " " << j;
+            }
+        }
+    }
+
+    template<typename T>
+    void ExpectMatchesReference(T tolerance)
+    {
+        const auto matrices = MakeSymmetricMatrices<T>(37);
+        std::vector<EigenDecomposition<T>> results(matrices.size());
+        SymmetricEigen<T>(matrices, results);
+        for (std::size_t i = 0; i < matrices.size(); ++i)
+        {
+            ExpectDecomposes<T>(matrices[i], results[i], tolerance);
+            const EigenDecomposition<T> reference = SymmetricEigenReference<T>(matrices[i]);
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                EXPECT_NEAR(reference.values[k], results[i].values[k], tolerance);
+                // An eigenvector is only defined up to its sign
+                T dot = T(0);
+                for (std::size_t row = 0; row < 3; ++row)
+                    dot += reference.vectors.Get(row, k) * results[i].vectors.Get(row, k);
+                EXPECT_NEAR(T(1), std::abs(dot), tolerance);
+            }
+        }
+    }
+}
+
+TEST(SymmetricEigenTests, MatchesReference)
+{
+    ExpectMatchesReference<float>(1e-4f);
+    ExpectMatchesReference<double>(1e-12);
+}
+
+TEST(SymmetricEigenTests, Single)
+{
+    const Matrix<3, 3, float> matrix(2.0f, 1.0f, 0.0f,
+                                     1.0f, 2.0f, 0.0f,
+                                     0.0f, 0.0f, 5.0f);
+    const EigenDecomposition<float> result = SymmetricEigen<float>(matrix);
+    EXPECT_NEAR(5.0f, result.values[0], 1e-6f);
+    EXPECT_NEAR(3.0f, result.values[1], 1e-6f);
+    EXPECT_NEAR(1.0f, result.values[2], 1e-6f);
+    EXPECT_NEAR(1.0f, std::abs(result.vectors.Get(2, 0)), 1e-6f);
+    EXPECT_NEAR(std::sqrt(0.5f), std::abs(result.vectors.Get(0, 1)), 1e-6f);
+    EXPECT_NEAR(std::sqrt(0.5f), std::abs(result.vectors.Get(1, 2)), 1e-6f);
+    ExpectDecomposes<float>(matrix, result, 1e-5f);
+}
+
+TEST(SymmetricEigenTests, Degenerate)
+{
+    // Already diagonal, repeated values, and zero
+    const std::vector<Matrix<3, 3, float>> matrices = {
+        Matrix<3, 3, float>(1.0f, 0.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f, 0.0f, 2.0f),
+        Matrix<3, 3, float>(4.0f),
+        Matrix<3, 3, float>(0.0f),
+        Matrix<3, 3, float>(1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f),
+        Matrix<3, 3, float>(1e-20f, 0.0f, 1e-20f, 0.0f, 1e20f, 0.0f, 1e-20f, 0.0f, 1.0f),
+    };
+    std::vector<EigenDecomposition<float>> results(matrices.size());
+    SymmetricEigen<float>(matrices, results);
+    EXPECT_EQ(3.0f, results[0].values[0]);
+    EXPECT_EQ(2.0f, results[0].values[1]);
+    EXPECT_EQ(1.0f, results[0].values[2]);
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(4.0f, results[1].values[i]);
+        EXPECT_EQ(0.0f, results[2].values[i]);
+    }
+    EXPECT_NEAR(3.0f, results[3].values[0], 1e-5f);
+    EXPECT_NEAR(0.0f, results[3].values[2], 1e-5f);
+    EXPECT_EQ(1e20f, results[4].values[0]);
+    for (std::size_t i = 0; i < 4; ++i)
+        ExpectDecomposes<float>(matrices[i], results[i], 1e-5f);
+}
+
+TEST(SymmetricEigenTests, FixedSweepsConverge)
+{
+    // The off diagonal of V^T A V is at the rounding error after the default number of sweeps
+    for (const auto& matrix : MakeSymmetricMatrices<double>(100))
+        ExpectDecomposes<double>(matrix, SymmetricEigenReference<double>(matrix), 1e-12);
+}
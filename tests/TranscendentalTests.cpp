@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Transcendental.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    using Vec4 = Vector<4, float, Qualifier::Aligned>;
+    using Vec4P = Vector<4, float, Qualifier::Packed>;
+    using Vec3 = Vector<3, double, Qualifier::Packed>;
+
+    // Relative to the magnitude of the expected value, or absolute below 1
+    template<typename T>
+    void ExpectNear(T expected, T actual, T tolerance)
+    {
+        EXPECT_NEAR(expected, actual, tolerance * std::max(T(1), std::abs(expected))) << "expected " << expected;
+    }
+
+    template<std::size_t N, typename T, Qualifier Q, typename F, typename R>
+    void ExpectMatches(F function, R reference, T from, T to, T tolerance)
+    {
+        constexpr int steps = 1000;
+        for (int i = 0; i < steps; i += N)
+        {
+            Vector<N, T, Q> input;
+            for (std::size_t k = 0; k < N; ++k)
+                input[k] = from + (to - from) * static_cast<T>(i + k) / steps;
+            Vector<N, T, Q> output = function(input);
+            for (std::size_t k = 0; k < N; ++k)
+                ExpectNear<T>(static_cast<T>(reference(static_cast<long double>(input[k]))), output[k], tolerance);
+        }
+    }
+}
+
+TEST(TranscendentalTests, SinCos)
+{
+    ExpectMatches<4, float, Qualifier::Aligned>([](const Vec4& v) { return Sin(v); }, [](long double x) { return std::sin(x); }, -100.0f, 100.0f, 2e-7f);
+    ExpectMatches<4, float, Qualifier::Aligned>([](const Vec4& v) { return Cos(v); }, [](long double x) { return std::cos(x); }, -100.0f, 100.0f, 2e-7f);
+    ExpectMatches<4, float, Qualifier::Packed>([](const Vec4P& v) { return Sin(v); }, [](long double x) { return std::sin(x); }, -8000.0f, 8000.0f, 2e-7f);
+    ExpectMatches<3, double, Qualifier::Packed>([](const Vec3& v) { return Cos(v); }, [](long double x) { return std::cos(x); }, -8000.0, 8000.0, 1e-15);
+
+    Vec4 sin, cos;
+    SinCos(Vec4(0.0f, 1.0f, -2.0f, 3.0f), sin, cos);
+    for (std::size_t i = 0; i < 4; ++i)
+        EXPECT_NEAR(1.0f, sin[i] * sin[i] + cos[i] * cos[i], 1e-6f);
+    EXPECT_EQ(0.0f, sin[0]);
+    EXPECT_EQ(1.0f, cos[0]);
+}
+
+TEST(TranscendentalTests, Tan)
+{
+    ExpectMatches<4, float, Qualifier::Aligned>([](const Vec4& v) { return Tan(v); }, [](long double x) { return std::tan(x); }, -1.5f, 1.5f, 5e-7f);
+    ExpectMatches<3, double, Qualifier::Packed>([](const Vec3& v) { return Tan(v); }, [](long double x) { return std::tan(x); }, -1.5, 1.5, 1e-15);
+}
+
+TEST(TranscendentalTests, Atan2)
+{
+    const float values[] = { 0.0f, -0.0f, 1.0f, -1.0f, 0.5f, -3.0f, 1e-20f, 7e5f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() };
+    for (float y : values)
+    {
+        for (float x : values)
+        {
+            Vec4 result = Atan2(Vec4(y), Vec4(x));
+            EXPECT_NEAR(std::atan2(y, x), result[0], 5e-7f) << y << ", " << x;
+            EXPECT_EQ(std::signbit(std::atan2(y, x)), std::signbit(result[0])) << y << ", " << x;
+        }
+    }
+    EXPECT_TRUE(std::isnan(Atan2(Vec4(std::numeric_limits<float>::quiet_NaN()), Vec4(1.0f))[0]));
+    EXPECT_NEAR(std::atan2(-0.3, -2.0), Atan2(Vec3(-0.3), Vec3(-2.0))[1], 1e-15);
+}
+
+TEST(TranscendentalTests, Exp)
+{
+    ExpectMatches<4, float, Qualifier::Aligned>([](const Vec4& v) { return Exp(v); }, [](long double x) { return std::exp(x); }, -87.0f, 88.0f, 3e-7f);
+    ExpectMatches<3, double, Qualifier::Packed>([](const Vec3& v) { return Exp(v); }, [](long double x) { return std::exp(x); }, -700.0, 700.0, 5e-16);
+
+    Vec4 result = Exp(Vec4(100.0f, -200.0f, 0.0f, std::numeric_limits<float>::quiet_NaN()));
+    EXPECT_EQ(std::numeric_limits<float>::infinity(), result[0]);
+    EXPECT_EQ(0.0f, result[1]);
+    EXPECT_EQ(1.0f, result[2]);
+    EXPECT_TRUE(std::isnan(result[3]));
+    // Denormal results
+    EXPECT_NEAR(std::exp(-100.0f), Exp(Vec4(-100.0f))[0], 1e-45f);
+}
+
+TEST(TranscendentalTests, Log)
+{
+    ExpectMatches<4, float, Qualifier::Aligned>([](const Vec4& v) { return Log(v); }, [](long double x) { return std::log(x); }, 1e-3f, 1e3f, 2e-7f);
+    ExpectMatches<3, double, Qualifier::Packed>([](const Vec3& v) { return Log(v); }, [](long double x) { return std::log(x); }, 1e-3, 1e6, 3e-16);
+
+    Vec4 result = Log(Vec4(0.0f, -1.0f, std::numeric_limits<float>::infinity(), 1e-40f));
+    EXPECT_EQ(-std::numeric_limits<float>::infinity(), result[0]);
+    EXPECT_TRUE(std::isnan(result[1]));
+    EXPECT_EQ(std::numeric_limits<float>::infinity(), result[2]);
+    EXPECT_NEAR(std::log(1e-40f), result[3], 1e-4f);
+}
+
+TEST(TranscendentalTests, Pow)
+{
+    Vec4 result = Pow(Vec4(2.0f, 9.0f, 0.5f, -3.0f), Vec4(10.0f, 0.5f, -3.0f, 0.0f));
+    EXPECT_NEAR(1024.0f, result[0], 1024.0f * 4e-6f);
+    EXPECT_NEAR(3.0f, result[1], 3.0f * 1e-6f);
+    EXPECT_NEAR(8.0f, result[2], 8.0f * 1e-6f);
+    EXPECT_EQ(1.0f, result[3]);
+    EXPECT_EQ(1.0f, Pow(Vec4(1.0f), Vec4(std::numeric_limits<float>::quiet_NaN()))[0]);
+    EXPECT_TRUE(std::isnan(Pow(Vec4(-2.0f), Vec4(2.0f))[0]));
+}
+
+TEST(TranscendentalTests, Fast)
+{
+    ExpectMatches<4, float, Qualifier::Aligned>([](const Vec4& v) { return FastSin(v); }, [](long double x) { return std::sin(x); }, -100.0f, 100.0f, 2e-5f);
+    ExpectMatches<4, float, Qualifier::Aligned>([](const Vec4& v) { return FastCos(v); }, [](long double x) { return std::cos(x); }, -100.0f, 100.0f, 2e-5f);
+    ExpectMatches<4, float, Qualifier::Aligned>([](const Vec4& v) { return FastExp(v); }, [](long double x) { return std::exp(x); }, -80.0f, 80.0f, 1e-5f);
+    ExpectMatches<4, float, Qualifier::Aligned>([](const Vec4& v) { return FastLog(v); }, [](long double x) { return std::log(x); }, 1e-3f, 1e3f, 3e-7f);
+    ExpectMatches<3, double, Qualifier::Packed>([](const Vec3& v) { return FastSin(v); }, [](long double x) { return std::sin(x); }, -100.0, 100.0, 2e-5);
+}
+
+TEST(TranscendentalTests, Batch)
+{
+    std::vector<Vec4> input;
+    for (int i = 0; i < 9; ++i)
+        input.emplace_back(0.1f * i, 0.2f * i, 0.3f * i, 0.4f * i);
+
+    std::vector<Vec4> sin(input.size()), cos(input.size()), exp(input.size());
+    SinCos<4, float, Qualifier::Aligned>(input, sin, cos);
+    Exp<4, float, Qualifier::Aligned>(input, exp);
+    for (std::size_t i = 0; i < input.size(); ++i)
+    {
+        EXPECT_EQ(Sin(input[i]), sin[i]);
+        EXPECT_EQ(Cos(input[i]), cos[i]);
+        EXPECT_EQ(Exp(input[i]), exp[i]);
+    }
+
+    // In place
+    Log<4, float, Qualifier::Aligned>(exp, exp);
+    for (std::size_t i = 0; i < input.size(); ++i)
+    {
+        for (std::size_t k = 0; k < 4; ++k)
+            EXPECT_NEAR(input[i][k], exp[i][k], 1e-6f);
+    }
+}
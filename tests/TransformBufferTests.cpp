@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/TransformBuffer.hpp"
+
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    using Buffer = TransformBuffer<4, 4, float>;
+    using Transform = Buffer::Transform;
+
+    Transform Translation(float x)
+    {
+        Transform transform;
+        transform.Get(0, 3) = x;
+        return transform;
+    }
+
+    bool Equal(std::span<const Transform> left, std::span<const Transform> right)
+    {
+        for (std::size_t i = 0; i < left.size(); ++i)
+            for (std::size_t column = 0; column < 4; ++column)
+                for (std::size_t row = 0; row < 4; ++row)
+                    if (left[i].Get(row, column) != right[i].Get(row, column))
+                        return false;
+        return true;
+    }
+}
+
+TEST(TransformBufferTests, PublishAndAcquire)
+{
+    Buffer buffer(100);
+    EXPECT_EQ(buffer.Size(), 100u);
+    EXPECT_FALSE(buffer.Acquire());
+    EXPECT_EQ(buffer.Front()[5].Get(0, 3), 0.0f);
+
+    buffer.Set(5, Translation(1.0f));
+    buffer.Set(7, Translation(2.0f));
+    EXPECT_FALSE(buffer.Acquire());
+    buffer.Publish();
+    ASSERT_TRUE(buffer.Acquire());
+    EXPECT_EQ(buffer.Front()[5].Get(0, 3), 1.0f);
+    EXPECT_EQ(buffer.Front()[7].Get(0, 3), 2.0f);
+    EXPECT_EQ(buffer.Changed().begin, 5u);
+    EXPECT_EQ(buffer.Changed().end, 8u);
+    EXPECT_FALSE(buffer.Acquire());
+    EXPECT_TRUE(buffer.Changed().Empty());
+
+    // The back copy the writer gets back is brought up to date
+    buffer.Publish();
+    buffer.Publish();
+    EXPECT_EQ(buffer.Back()[5].Get(0, 3), 1.0f);
+    EXPECT_EQ(buffer.Back()[7].Get(0, 3), 2.0f);
+}
+
+TEST(TransformBufferTests, SkippedFramesAreMerged)
+{
+    Buffer buffer(50);
+    std::vector<Transform> destination(50);
+    for (auto& transform : buffer.Write(10, 5))
+        transform = Translation(3.0f);
+    buffer.Publish();
+    buffer.Set(40, Translation(4.0f));
+    buffer.Publish();
+    buffer.Set(20, Translation(5.0f));
+    buffer.Publish();
+
+    // The reader never took the first two frames, their writes come with the third
+    ASSERT_TRUE(buffer.CopyChanged(destination));
+    EXPECT_EQ(buffer.Changed().begin, 10u);
+    EXPECT_EQ(buffer.Changed().end, 41u);
+    EXPECT_TRUE(Equal(destination, buffer.Front()));
+    EXPECT_EQ(destination[12].Get(0, 3), 3.0f);
+    EXPECT_EQ(destination[40].Get(0, 3), 4.0f);
+    EXPECT_EQ(destination[20].Get(0, 3), 5.0f);
+    EXPECT_FALSE(buffer.CopyChanged(destination));
+}
+
+TEST(TransformBufferTests, ConcurrentWriterAndReader)
+{
+    constexpr std::size_t count = 4096;
+    constexpr int frames = 3000;
+    Buffer buffer(count);
+    std::atomic<bool> done = false;
+
+    std::thread writer([&] {
+        std::mt19937 random(5);
+        std::uniform_int_distribution<std::size_t> index(0, count - 1);
+        for (int frame = 1; frame <= frames; ++frame)
+        {
+            // Index 0 stamps the frame, a random block changes with it
+            buffer.Set(0, Translation(static_cast<float>(frame)));
+            const std::size_t begin = index(random);
+            const std::size_t size = std::min<std::size_t>(count - begin, index(random) % 64 + 1);
+            for (auto& transform : buffer.Write(begin, size))
+                transform = Translation(static_cast<float>(frame));
+            buffer.Publish();
+        }
+        done = true;
+    });
+
+    std::vector<Transform> destination(count);
+    float lastFrame = 0.0f;
+    std::size_t acquired = 0;
+    bool consistent = true;
+    while (true)
+    {
+        const bool finished = done;
+        if (buffer.CopyChanged(destination))
+        {
+            ++acquired;
+            const float frame = buffer.Front()[0].Get(0, 3);
+            consistent = consistent && frame > lastFrame && Equal(destination, buffer.Front());
+            lastFrame = frame;
+        }
+        else if (finished)
+            break;
+    }
+    writer.join();
+
+    EXPECT_TRUE(consistent);
+    EXPECT_GT(acquired, 0u);
+    EXPECT_EQ(lastFrame, static_cast<float>(frames));
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Transform.hpp"
+#include "PulsarionMath/VectorMask.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    const Matrix<4, 4, float> TestMatrix(0.36f, 0.48f, -0.8f, 10.0f,
+                                         -0.8f, 0.6f, 0.0f, -5.0f,
+                                         0.48f, 0.64f, 0.6f, 2.5f,
+                                         0.1f, 0.2f, 0.3f, 1.5f);
+
+    // Every size leaves a different tail after the groups of 4 points
+    template<std::size_t N, Qualifier Q>
+    void ExpectMatchesReference()
+    {
+        for (std::size_t count : { 0u, 1u, 3u, 4u, 5u, 11u, 1000u })
+        {
+            std::vector<Vector<N, float, Q>> points(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                for (std::size_t d = 0; d < N; ++d)
+                    points[i][d] = static_cast<float>(std::sin(static_cast<double>(i * 3 + d))) * 20.0f;
+            }
+
+            std::vector<Vector<N, float, Q>> result(count);
+            TransformPoints<N, float, Q>(TestMatrix, points, result);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const double w = N == 4 ? points[i][N - 1] : 1.0;
+                for (std::size_t row = 0; row < N; ++row)
+                {
+                    const double expected = TestMatrix.Get(row, 0) * static_cast<double>(points[i][0]) + TestMatrix.Get(row, 1) * static_cast<double>(points[i][1])
+                                          + TestMatrix.Get(row, 2) * static_cast<double>(points[i][2]) + TestMatrix.Get(row, 3) * w;
+                    ASSERT_NEAR(expected, result[i][row], 1e-4) << count << " " << i << " " << row;
+                }
+            }
+
+            // In place gives the same result
+            TransformPointsInPlace<N, float, Q>(TestMatrix, points);
+            for (std::size_t i = 0; i < count; ++i)
+                EXPECT_TRUE(All(Equal(result[i], points[i])));
+        }
+    }
+}
+
+TEST(TransformTests, MatchesReference)
+{
+    ExpectMatchesReference<4, Qualifier::Aligned>();
+    ExpectMatchesReference<4, Qualifier::Packed>();
+    ExpectMatchesReference<3, Qualifier::Aligned>();
+    ExpectMatchesReference<3, Qualifier::Packed>();
+}
+
+TEST(TransformTests, MatchesMatrixMultiplication)
+{
+    const Vector<4, float, Qualifier::Aligned> point(1.0f, -2.0f, 3.0f, 1.0f);
+    const Vector<4, float, Qualifier::Aligned> expected = TestMatrix * point;
+    Vector<4, float, Qualifier::Aligned> result;
+    TransformPoints<4, float, Qualifier::Aligned>(TestMatrix, std::span(&point, 1), std::span(&result, 1));
+    for (std::size_t d = 0; d < 4; ++d)
+        EXPECT_FLOAT_EQ(expected[d], result[d]);
+}
+
+TEST(TransformTests, Double)
+{
+    const Matrix<4, 4, double> translation(1.0, 0.0, 0.0, 1.0,
+                                           0.0, 1.0, 0.0, 2.0,
+                                           0.0, 0.0, 1.0, 3.0,
+                                           0.0, 0.0, 0.0, 1.0);
+    std::vector<Vector<3, double, Qualifier::Packed>> points = { { 1.0, 1.0, 1.0 }, { -1.0, 0.0, 0.5 } };
+    TransformPointsInPlace<3, double, Qualifier::Packed>(translation, points);
+    EXPECT_EQ(2.0, points[0].x());
+    EXPECT_EQ(3.0, points[0].y());
+    EXPECT_EQ(4.0, points[0].z());
+    EXPECT_EQ(0.0, points[1].x());
+    EXPECT_EQ(2.0, points[1].y());
+    EXPECT_EQ(3.5, points[1].z());
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/Curve.hpp"
+#include "PulsarionMath/Pipeline.hpp"
+#include "PulsarionMath/Reduce.hpp"
+#include "PulsarionMath/Swizzle.hpp"
+#include "PulsarionMath/Transform.hpp"
+
+#include <span>
+#include <vector>
+
+using namespace Pulsarion::Math;
+
+// Packed 3 component vectors are only aligned to 4 bytes. These run the SSE kernels over spans starting at every 4 byte offset
+// modulo 16, and are built with AddressSanitizer and UndefinedBehaviorSanitizer (PulsarionMathSanitizerTests), which fail on
+// a misaligned access through a wider type or a read past the span
+namespace
+{
+    using Vec3P = Vector<3, float, Qualifier::Packed>;
+
+    std::vector<Vec3P> MakePoints(std::size_t count)
+    {
+        std::vector<Vec3P> points(count);
+        for (std::size_t i = 0; i < count; ++i)
+            points[i] = Vec3P(static_cast<float>(i), -0.5f * static_cast<float>(i), 2.0f + static_cast<float>(i % 7));
+        return points;
+    }
+
+    // The spans, 12 bytes per vector, start at offsets 0, 12, 24 and 36 of the allocation, so at every 4 byte offset modulo 16
+    template<typename F>
+    void ForEachOffset(std::size_t count, F&& test)
+    {
+        for (std::size_t offset = 0; offset < 4; ++offset)
+        {
+            // Exactly sized, so the sanitizer sees any access past the end
+            std::vector<Vec3P> points = MakePoints(count + offset);
+            test(std::span<Vec3P>(points).subspan(offset), offset);
+        }
+    }
+}
+
+TEST(UnalignedTests, Swizzle)
+{
+    ForEachOffset(9, [](std::span<Vec3P> points, std::size_t) {
+        for (Vec3P& point : points)
+        {
+            const Vec3P expected(point.z(), point.x(), point.y());
+            point = Swizzle<2, 0, 1>(point);
+            for (std::size_t d = 0; d < 3; ++d)
+                EXPECT_EQ(expected[d], point[d]);
+        }
+    });
+}
+
+TEST(UnalignedTests, Curve)
+{
+    const auto curve = CubicCurve<3, float, Qualifier::Packed>::Bezier(Vec3P(0.0f, 0.0f, 0.0f), Vec3P(1.0f, 2.0f, 0.0f), Vec3P(3.0f, 2.0f, 1.0f),
+                                                                       Vec3P(4.0f, 0.0f, -1.0f));
+    std::vector<float> parameters(7);
+    for (std::size_t i = 0; i < parameters.size(); ++i)
+        parameters[i] = static_cast<float>(i) / 6.0f;
+    ForEachOffset(7, [&](std::span<Vec3P> points, std::size_t offset) {
+        std::vector<Vec3P> tangents(offset + 7);
+        EvaluateCurve<3, float, Qualifier::Packed>(curve, parameters, points, std::span<Vec3P>(tangents).subspan(offset));
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            for (std::size_t d = 0; d < 3; ++d)
+            {
+                EXPECT_NEAR(curve.Position(parameters[i])[d], points[i][d], 1e-5f) << offset;
+                EXPECT_NEAR(curve.Tangent(parameters[i])[d], tangents[offset + i][d], 1e-5f) << offset;
+            }
+        }
+    });
+}
+
+TEST(UnalignedTests, Pipeline)
+{
+    ForEachOffset(11, [](std::span<Vec3P> points, std::size_t offset) {
+        const std::vector<Vec3P> input(points.begin(), points.end());
+        Pipeline(std::span<const Vec3P>(input)).Scale(2.0f).Add(Vec3P(1.0f, 1.0f, 1.0f)).Clamp(-100.0f, 100.0f).Into(points);
+        for (std::size_t i = 0; i < points.size(); ++i)
+            EXPECT_EQ(input[i].y() * 2.0f + 1.0f, points[i].y()) << offset;
+    });
+}
+
+TEST(UnalignedTests, Transform)
+{
+    const Matrix<4, 4, float> translation(1.0f, 0.0f, 0.0f, 1.0f,
+                                          0.0f, 1.0f, 0.0f, 2.0f,
+                                          0.0f, 0.0f, 1.0f, 3.0f,
+                                          0.0f, 0.0f, 0.0f, 1.0f);
+    ForEachOffset(11, [&](std::span<Vec3P> points, std::size_t offset) {
+        const std::vector<Vec3P> input(points.begin(), points.end());
+        TransformPointsInPlace<3, float, Qualifier::Packed>(translation, points);
+        for (std::size_t i = 0; i < points.size(); ++i)
+            EXPECT_EQ(input[i].z() + 3.0f, points[i].z()) << offset;
+    });
+}
+
+TEST(UnalignedTests, Reduce)
+{
+    ForEachOffset(13, [](std::span<Vec3P> points, std::size_t offset) {
+        const Vec3P sum = Sum<3, float, Qualifier::Packed>(points);
+        const Bounds<3, float, Qualifier::Packed> bounds = ComputeBounds<3, float, Qualifier::Packed>(points);
+        EXPECT_FLOAT_EQ(points.front().x() * 13.0f + 78.0f, sum.x()) << offset;
+        EXPECT_EQ(points.back().x(), bounds.max.x()) << offset;
+        EXPECT_EQ(points.back().y(), bounds.min.y()) << offset;
+    });
+}
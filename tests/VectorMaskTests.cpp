@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include "PulsarionMath/VectorMask.hpp"
+
+#include <cmath>
+#include <limits>
+
+using namespace Pulsarion::Math;
+
+namespace
+{
+    using Vec4 = Vector<4, float, Qualifier::Aligned>;
+    using Vec4P = Vector<4, float, Qualifier::Packed>;
+    using Vec3D = Vector<3, double, Qualifier::Packed>;
+    using Vec2I = Vector<2, int, Qualifier::Packed>;
+
+    constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+}
+
+TEST(VectorMaskTests, Reductions)
+{
+    const VectorMask<4> mask(true, false, true, false);
+    EXPECT_EQ(0b0101, MoveMask(mask));
+    EXPECT_TRUE(Any(mask));
+    EXPECT_FALSE(All(mask));
+    EXPECT_FALSE(None(mask));
+    EXPECT_TRUE(mask[0]);
+    EXPECT_FALSE(mask[1]);
+
+    EXPECT_TRUE(All(VectorMask<4>(true)));
+    EXPECT_TRUE(None(VectorMask<4>()));
+    EXPECT_TRUE(All(VectorMask<3>(true, true, true)));
+    EXPECT_EQ(0b10, MoveMask(VectorMask<2>(false, true)));
+}
+
+TEST(VectorMaskTests, Logic)
+{
+    const VectorMask<4> a(true, true, false, false);
+    const VectorMask<4> b(true, false, true, false);
+    EXPECT_EQ(0b0001, MoveMask(a & b));
+    EXPECT_EQ(0b0111, MoveMask(a | b));
+    EXPECT_EQ(0b0110, MoveMask(a ^ b));
+    EXPECT_EQ(0b1100, MoveMask(~a));
+
+    // Only the lanes that exist are flipped
+    EXPECT_EQ(0b100, MoveMask(~VectorMask<3>(true, true, false)));
+    EXPECT_TRUE(All(~VectorMask<3>()));
+}
+
+TEST(VectorMaskTests, Comparisons)
+{
+    const Vec4 a(1.0f, 2.0f, 3.0f, NaN);
+    const Vec4 b(2.0f, 2.0f, 1.0f, 0.0f);
+    EXPECT_EQ(0b0001, MoveMask(LessThan(a, b)));
+    EXPECT_EQ(0b0011, MoveMask(LessEqual(a, b)));
+    EXPECT_EQ(0b0100, MoveMask(GreaterThan(a, b)));
+    EXPECT_EQ(0b0110, MoveMask(GreaterEqual(a, b)));
+    EXPECT_EQ(0b0010, MoveMask(Equal(a, b)));
+    // NaN is only ever not equal
+    EXPECT_EQ(0b1101, MoveMask(NotEqual(a, b)));
+    EXPECT_EQ(0b0011, MoveMask(NearEqual(a, b, 1.0f)));
+    EXPECT_EQ(0b0111, MoveMask(NearEqual(a, b, 2.0f)));
+
+    // -0 == 0
+    EXPECT_TRUE(All(Equal(Vec4P(-0.0f), Vec4P(0.0f))));
+    EXPECT_EQ(0b1001, MoveMask(LessThan(Vec4P(-1.0f, 0.0f, 5.0f, -1e-30f), Vec4P(0.0f))));
+
+    // The whole vector comparisons agree with the masks
+    EXPECT_TRUE(Vec4(1.0f, 2.0f, 3.0f, 4.0f) == Vec4(1.0f, 2.0f, 3.0f, 4.0f));
+    EXPECT_FALSE(a == a);
+    EXPECT_TRUE(a != a);
+    EXPECT_FALSE(Vec4P(-0.0f) != Vec4P(0.0f));
+
+    EXPECT_EQ(0b010, MoveMask(LessThan(Vec3D(1.0, -2.0, 3.0), Vec3D(0.0))));
+    EXPECT_EQ(0b11, MoveMask(NearEqual(Vector<2, unsigned, Qualifier::Packed>(3u, 5u), Vector<2, unsigned, Qualifier::Packed>(5u, 3u), 2u)));
+    EXPECT_EQ(0b01, MoveMask(GreaterEqual(Vec2I(4, -4), Vec2I(4, 0))));
+}
+
+TEST(VectorMaskTests, Select)
+{
+    const Vec4 a(1.0f, 2.0f, 3.0f, 4.0f);
+    const Vec4 b(-1.0f, -2.0f, -3.0f, -4.0f);
+    EXPECT_EQ(Vec4(1.0f, -2.0f, 3.0f, -4.0f), Select(VectorMask<4>(true, false, true, false), a, b));
+    EXPECT_EQ(a, Select(VectorMask<4>(true), a, b));
+    EXPECT_EQ(b, Select(VectorMask<4>(), a, b));
+
+    // Branchless abs, the lanes below zero negated
+    const Vec4P v(-3.0f, 2.0f, -0.5f, 7.0f);
+    EXPECT_EQ(Vec4P(3.0f, 2.0f, 0.5f, 7.0f), Select(LessThan(v, Vec4P(0.0f)), -v, v));
+
+    EXPECT_TRUE(All(Equal(Vec3D(1.0, 0.0, 3.0), Select(VectorMask<3>(true, false, true), Vec3D(1.0, 2.0, 3.0), Vec3D(0.0)))));
+}
+
+TEST(VectorMaskTests, MinMaxClamp)
+{
+    const Vec4 a(1.0f, 5.0f, -3.0f, NaN);
+    const Vec4 b(2.0f, 4.0f, -3.0f, 1.0f);
+    EXPECT_EQ(Vec4(1.0f, 4.0f, -3.0f, 1.0f), Min(a, b));
+    EXPECT_EQ(Vec4(2.0f, 5.0f, -3.0f, 1.0f), Max(a, b));
+
+    // NaN goes to the lower bound
+    EXPECT_EQ(Vec4(1.0f, 2.0f, -1.0f, -1.0f), Clamp(a, -1.0f, 2.0f));
+    EXPECT_EQ(Vec4(1.0f, 4.5f, -2.0f, 0.0f), Clamp(a, Vec4(0.0f, 0.0f, -2.0f, 0.0f), Vec4(3.0f, 4.5f, 3.0f, 3.0f)));
+    EXPECT_EQ(Vec4P(0.0f, 0.25f, 1.0f, 0.0f), Saturate(Vec4P(-2.0f, 0.25f, 7.0f, NaN)));
+
+    EXPECT_TRUE(All(Equal(Vec3D(0.0, 0.5, 1.0), Saturate(Vec3D(-1.0, 0.5, 3.0)))));
+    EXPECT_TRUE(All(Equal(Vec2I(-1, 3), Clamp(Vec2I(-5, 10), -1, 3))));
+    EXPECT_TRUE(All(Equal(Vec2I(-5, 3), Min(Vec2I(-5, 10), Vec2I(0, 3)))));
+}
+
+TEST(VectorMaskTests, Abs)
+{
+    const Vec4 result = Abs(Vec4(-1.5f, 2.0f, -0.0f, -NaN));
+    EXPECT_EQ(1.5f, result[0]);
+    EXPECT_EQ(2.0f, result[1]);
+    EXPECT_FALSE(std::signbit(result[2]));
+    EXPECT_TRUE(std::isnan(result[3]));
+    EXPECT_FALSE(std::signbit(result[3]));
+
+    EXPECT_EQ(Vec4P(std::numeric_limits<float>::infinity()), Abs(Vec4P(-std::numeric_limits<float>::infinity())));
+    EXPECT_TRUE(All(Equal(Vec3D(1.0, 2.0, 3.0), Abs(Vec3D(-1.0, 2.0, -3.0)))));
+    EXPECT_TRUE(All(Equal(Vec2I(7, 0), Abs(Vec2I(-7, 0)))));
+}